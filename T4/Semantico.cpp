@@ -6,12 +6,9 @@
 #include <algorithm>
 #include <string>
 
-static std::string g_ultimoIdVisto;
-static std::string g_ultimoIdAntesDaAtrib;
-static bool        g_inParamList = false;
-static bool        g_nextBraceIsFuncBody = false;
-static std::string g_funcEmConstrucao;
-static std::vector<Simbolo> g_paramBuffer;
+// Monta e registra a mensagem só com o nível ativo (Semantico::logAtivo)
+#define SEM_LOG(sem, nivel, msg) \
+    do { if ((sem).logAtivo(NivelLog::nivel)) (sem).log(msg); } while (0)
 
 // --------- utilitários ---------
 std::ostream& operator<<(std::ostream& os, const Simbolo& s) {
@@ -24,21 +21,29 @@ std::ostream& operator<<(std::ostream& os, const Simbolo& s) {
     return os;
 }
 
+// Os símbolos são alterados por edit, que copia o bloco se uma cópia do
+// Semantico (ponto de retomada) ainda o divide; por isso só se altera o que
+// muda de fato
+
 // Promove o último ID declarado para FUNÇÃO (modalidade/escopo)
 static void promoverParaFuncao(
     const std::string& nomeFunc,
-    std::vector<std::vector<Simbolo>>& pilhaEscopos,
-    std::vector<Simbolo>& tabelaSimbolo
+    std::vector<SharedVector<Simbolo>>& pilhaEscopos,
+    TabelaSimbolos& tabelaSimbolo
     ){
     if (nomeFunc.empty() || pilhaEscopos.empty()) return;
-    for (auto& s : pilhaEscopos.back()) {
-        if (s.nome == nomeFunc) {
+    auto& escopo = pilhaEscopos.back();
+    for (size_t i = 0; i < escopo.size(); ++i) {
+        if (escopo[i].nome == nomeFunc) {
+            Simbolo& s = escopo.edit(i);
             s.modalidade = "funcao";
             s.escopo = "global";
             s.inicializado = true;
-            for (auto& t : tabelaSimbolo)
+            for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                const Simbolo& t = tabelaSimbolo[j];
                 if (t.nome == s.nome && t.tipo == s.tipo && t.escopo == "global")
-                { t.modalidade = "funcao"; t.inicializado = true; }
+                { Simbolo& u = tabelaSimbolo.edit(j); u.modalidade = "funcao"; u.inicializado = true; }
+            }
             return;
         }
     }
@@ -47,17 +52,20 @@ static void promoverParaFuncao(
 // *** CORREÇÃO: percorrer da pilha mais interna para a mais externa ***
 static void marcarUsadoPorNome(
     const std::string& nome,
-    std::vector<std::vector<Simbolo>>& pilhaEscopos,
-    std::vector<Simbolo>& tabelaSimbolo
+    std::vector<SharedVector<Simbolo>>& pilhaEscopos,
+    TabelaSimbolos& tabelaSimbolo
     ) {
     if (nome.empty()) return;
     for (auto it = pilhaEscopos.rbegin(); it != pilhaEscopos.rend(); ++it) {
-        for (auto& simbolo : *it) {
-            if (simbolo.nome == nome) {
-                simbolo.usado = true;
-                for (auto& s : tabelaSimbolo)
-                    if (s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo)
-                        s.usado = true;
+        for (size_t i = 0; i < it->size(); ++i) {
+            if ((*it)[i].nome == nome) {
+                if (!(*it)[i].usado) it->edit(i).usado = true;
+                const Simbolo& simbolo = (*it)[i];
+                for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                    const Simbolo& s = tabelaSimbolo[j];
+                    if (!s.usado && s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo)
+                        tabelaSimbolo.edit(j).usado = true;
+                }
                 return;
             }
         }
@@ -66,18 +74,22 @@ static void marcarUsadoPorNome(
 
 static void marcarInicializadoPorNome(
     const std::string& nome,
-    std::vector<std::vector<Simbolo>>& pilhaEscopos,
-    std::vector<Simbolo>& tabelaSimbolo
+    std::vector<SharedVector<Simbolo>>& pilhaEscopos,
+    TabelaSimbolos& tabelaSimbolo,
+    const Semantico& sem
     ) {
     if (nome.empty()) return;
     for (auto it = pilhaEscopos.rbegin(); it != pilhaEscopos.rend(); ++it) {
-        for (auto& simbolo : *it) {
-            if (simbolo.nome == nome) {
-                simbolo.inicializado = true;
-                std::cerr << "Marcando " << nome << " como inicializado no escopo " << simbolo.escopo << std::endl;
-                for (auto& s : tabelaSimbolo)
-                    if (s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo)
-                        s.inicializado = true;
+        for (size_t i = 0; i < it->size(); ++i) {
+            if ((*it)[i].nome == nome) {
+                if (!(*it)[i].inicializado) it->edit(i).inicializado = true;
+                const Simbolo& simbolo = (*it)[i];
+                SEM_LOG(sem, Debug, "Marcando " + nome + " como inicializado no escopo " + simbolo.escopo);
+                for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                    const Simbolo& s = tabelaSimbolo[j];
+                    if (!s.inicializado && s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo)
+                        tabelaSimbolo.edit(j).inicializado = true;
+                }
                 return;
             }
         }
@@ -88,18 +100,22 @@ static void marcarInicializadoPorNome(
 static void marcarElementoVetorInicializado(
     const std::string& nome,
     int /*indice*/,
-    std::vector<std::vector<Simbolo>>& pilhaEscopos,
-    std::vector<Simbolo>& tabelaSimbolo
+    std::vector<SharedVector<Simbolo>>& pilhaEscopos,
+    TabelaSimbolos& tabelaSimbolo,
+    const Semantico& sem
     ) {
     if (nome.empty()) return;
     for (auto it = pilhaEscopos.rbegin(); it != pilhaEscopos.rend(); ++it) {
-        for (auto& simbolo : *it) {
-            if (simbolo.nome == nome && simbolo.modalidade == "vetor") {
-                simbolo.inicializado = true;
-                std::cerr << "Marcando elemento de " << nome << " como inicializado no escopo " << simbolo.escopo << std::endl;
-                for (auto& s : tabelaSimbolo)
-                    if (s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo)
-                        s.inicializado = true;
+        for (size_t i = 0; i < it->size(); ++i) {
+            if ((*it)[i].nome == nome && (*it)[i].modalidade == "vetor") {
+                if (!(*it)[i].inicializado) it->edit(i).inicializado = true;
+                const Simbolo& simbolo = (*it)[i];
+                SEM_LOG(sem, Debug, "Marcando elemento de " + nome + " como inicializado no escopo " + simbolo.escopo);
+                for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                    const Simbolo& s = tabelaSimbolo[j];
+                    if (!s.inicializado && s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo)
+                        tabelaSimbolo.edit(j).inicializado = true;
+                }
                 return;
             }
         }
@@ -138,12 +154,15 @@ bool Semantico::existeNoEscopoDaFuncaoAtual(const std::string& nome) const {
 void Semantico::marcarUltimoDeclaradoComoVetor(const std::string& nome) {
     if (nome.empty() || pilhaEscopos.empty()) return;
     auto& escopoAtualRef = pilhaEscopos.back();
-    for (auto& sim : escopoAtualRef) {
-        if (sim.nome == nome) {
-            sim.modalidade = "vetor";
-            for (auto& s : tabelaSimbolo)
-                if (s.nome == sim.nome && s.tipo == sim.tipo && s.escopo == sim.escopo)
-                    s.modalidade = "vetor";
+    for (size_t i = 0; i < escopoAtualRef.size(); ++i) {
+        if (escopoAtualRef[i].nome == nome) {
+            if (escopoAtualRef[i].modalidade != "vetor") escopoAtualRef.edit(i).modalidade = "vetor";
+            const Simbolo& sim = escopoAtualRef[i];
+            for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                const Simbolo& s = tabelaSimbolo[j];
+                if (s.modalidade != "vetor" && s.nome == sim.nome && s.tipo == sim.tipo && s.escopo == sim.escopo)
+                    tabelaSimbolo.edit(j).modalidade = "vetor";
+            }
             return;
         }
     }
@@ -156,7 +175,7 @@ std::string Semantico::escopoAtual() const {
 }
 
 // ====== IMPLEMENTAÇÕES QUE FALTAVAM (linker) ======
-void Semantico::beginDeclaracao(const std::string& tipo) {
+void Semantico::beginDeclaracao(std::string_view tipo) {
     modoDeclaracao   = true;
     tipoAtual        = tipo;
     lastDeclaredPos  = -1;
@@ -180,11 +199,11 @@ void Semantico::endDeclaracao() {
 
 // --------- Semantico: declarar/usar/fechar ---------
 void Semantico::declarar(const Token* tok) {
-    warn("Declarando símbolo: " + tok->getLexeme() + " na posição: " + std::to_string(tok->getPosition()));
+    SEM_LOG(*this, Debug, "Declarando símbolo: " + std::string(tok->getLexeme()) + " na posição: " + posicao(tok->getPosition()));
     if (!tok) return;
     if (tok->getId() != t_ID) return;
 
-    const std::string nome = tok->getLexeme();
+    const std::string nome(tok->getLexeme());
     if (nome.empty()) return;
 
     if (pilhaEscopos.empty()) abrirEscopo();
@@ -219,33 +238,36 @@ void Semantico::declarar(const Token* tok) {
     pilhaEscopos.back().push_back(sim);
     tabelaSimbolo.push_back(sim);
 
-    g_ultimoIdVisto = nome;
-    g_ultimoIdAntesDaAtrib = nome;
+    ultimoIdVisto = nome;
+    ultimoIdAntesDaAtrib = nome;
     ultimoDeclaradoNome = nome;
-    warn("Símbolo declarado: " + sim.nome + ", inicializado: " + std::to_string(sim.inicializado));
+    SEM_LOG(*this, Debug, "Símbolo declarado: " + sim.nome + ", inicializado: " + std::to_string(sim.inicializado));
 }
 
 // *** CORREÇÃO: busca do símbolo deve respeitar sombreamento (rbegin -> rend) ***
 void Semantico::usar(const Token* tok) {
-    warn("Usando símbolo: " + tok->getLexeme());
-    const std::string nome = tok->getLexeme();
+    SEM_LOG(*this, Debug, "Usando símbolo: " + std::string(tok->getLexeme()));
+    const std::string_view nome = tok->getLexeme();
     if (nome.empty()) return;
 
     bool encontrado = false;
     for (auto it = pilhaEscopos.rbegin(); it != pilhaEscopos.rend(); ++it) {
-        for (auto& simbolo : *it) {
-            if (simbolo.nome == nome) {
+        for (size_t i = 0; i < it->size(); ++i) {
+            if ((*it)[i].nome == nome) {
+                if (!(*it)[i].usado) it->edit(i).usado = true;
+                const Simbolo& simbolo = (*it)[i];
                 if (!simbolo.inicializado) {
-                    warn("Aviso: Símbolo '" + nome +
-                         "' (tipo: " + simbolo.tipo +
-                         ", escopo: " + simbolo.escopo +
-                         ") usado sem inicialização na posição " +
-                         std::to_string(tok->getPosition()));
+                    SEM_LOG(*this, Aviso, "Aviso: Símbolo '" + std::string(nome) +
+                                          "' (tipo: " + simbolo.tipo +
+                                          ", escopo: " + simbolo.escopo +
+                                          ") usado sem inicialização na posição " +
+                                          posicao(tok->getPosition()));
+                }
+                for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                    const Simbolo& s = tabelaSimbolo[j];
+                    if (!s.usado && s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo)
+                        tabelaSimbolo.edit(j).usado = true;
                 }
-                simbolo.usado = true;
-                for (auto& s : tabelaSimbolo)
-                    if (s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo)
-                        s.usado = true;
                 encontrado = true;
                 break;
             }
@@ -253,7 +275,7 @@ void Semantico::usar(const Token* tok) {
         if (encontrado) break;
     }
     if (!encontrado) {
-        throw SemanticError("Símbolo '" + nome + "' não declarado neste escopo", tok->getPosition());
+        throw SemanticError("Símbolo '" + std::string(nome) + "' não declarado neste escopo", tok->getPosition());
     }
 }
 
@@ -262,10 +284,10 @@ void Semantico::fecharEscopo() {
 
     for (const auto& simbolo : pilhaEscopos.back()) {
         if (!simbolo.usado) {
-            warn("Aviso: Símbolo '" + simbolo.nome +
-                 "' (tipo: " + simbolo.tipo +
-                 ", escopo: " + simbolo.escopo +
-                 ") declarado mas não usado.");
+            SEM_LOG(*this, Aviso, "Aviso: Símbolo '" + simbolo.nome +
+                                  "' (tipo: " + simbolo.tipo +
+                                  ", escopo: " + simbolo.escopo +
+                                  ") declarado mas não usado.");
         }
     }
     pilhaEscopos.pop_back();
@@ -281,44 +303,48 @@ void Semantico::fecharEscopo() {
 void Semantico::verificarNaoUsados() const {
     for (const auto& simbolo : tabelaSimbolo) {
         if (!simbolo.usado) {
-            warn("Aviso: Símbolo '" + simbolo.nome +
-                 "' (tipo: " + simbolo.tipo +
-                 ", escopo: " + simbolo.escopo +
-                 ") declarado mas não usado.");
+            SEM_LOG(*this, Aviso, "Aviso: Símbolo '" + simbolo.nome +
+                                  "' (tipo: " + simbolo.tipo +
+                                  ", escopo: " + simbolo.escopo +
+                                  ") declarado mas não usado.");
         }
     }
 }
 
-void Semantico::warn(const std::string& msg) const {
-    std::cerr << msg << std::endl;
+void Semantico::log(const std::string& msg) const {
+    std::cerr << msg << '\n';
     mensagens_.push_back(msg);
     if (logger_) logger_(msg);
 }
 
+std::string Semantico::posicao(long long pos) const {
+    return positionFormatter_ ? positionFormatter_(pos) : std::to_string(pos);
+}
+
 void Semantico::executeAction(int action, const Token* token)
 {
-    warn("Ação #" + std::to_string(action) + ", Token: " + (token ? token->getLexeme() : "null") +
-         ", Posição: " + (token ? std::to_string(token->getPosition()) : "-1") +
-         ", modoDeclaracao: " + std::to_string(modoDeclaracao) +
-         ", ultimoDeclaradoNome: " + ultimoDeclaradoNome);
+    SEM_LOG(*this, Trace, "Ação #" + std::to_string(action) + ", Token: " + std::string(token ? token->getLexeme() : "null") +
+                          ", Posição: " + (token ? posicao(token->getPosition()) : "-1") +
+                          ", modoDeclaracao: " + std::to_string(modoDeclaracao) +
+                          ", ultimoDeclaradoNome: " + ultimoDeclaradoNome);
     switch (action) {
     case 2:
         if (token && modoDeclaracao && lastDeclaredPos != token->getPosition()) {
             declarar(token);
             lastDeclaredPos = token->getPosition();
-            g_ultimoIdVisto = token->getLexeme();
-            g_ultimoIdAntesDaAtrib = g_ultimoIdVisto;
-            ultimoDeclaradoNome = g_ultimoIdVisto;
+            ultimoIdVisto = token->getLexeme();
+            ultimoIdAntesDaAtrib = ultimoIdVisto;
+            ultimoDeclaradoNome = ultimoIdVisto;
         }
         return;
     case 4:
-        warn("Ação #4: Usando ID " + token->getLexeme());
+        SEM_LOG(*this, Debug, "Ação #4: Usando ID " + std::string(token->getLexeme()));
         usar(token);
         return;
     case 3:
-        warn("Finalizando declaração. modoDeclaracao = " + std::to_string(modoDeclaracao));
+        SEM_LOG(*this, Debug, "Finalizando declaração. modoDeclaracao = " + std::to_string(modoDeclaracao));
         endDeclaracao();
-        warn("Após endDeclaracao: modoDeclaracao = " + std::to_string(modoDeclaracao));
+        SEM_LOG(*this, Debug, "Após endDeclaracao: modoDeclaracao = " + std::to_string(modoDeclaracao));
         return;
 
     case 10:  // ID[expr] -> vetor
@@ -327,27 +353,27 @@ void Semantico::executeAction(int action, const Token* token)
         return;
 
     case 11:
-        warn("Ação #11: Marcando inicialização de " + ultimoDeclaradoNome);
+        SEM_LOG(*this, Debug, "Ação #11: Marcando inicialização de " + ultimoDeclaradoNome);
         if (!ultimoDeclaradoNome.empty()) {
-            marcarInicializadoPorNome(ultimoDeclaradoNome, pilhaEscopos, tabelaSimbolo);
+            marcarInicializadoPorNome(ultimoDeclaradoNome, pilhaEscopos, tabelaSimbolo, *this);
         }
         return;
 
     case 12:  // ID[...] = { ... }
         if (!ultimoDeclaradoNome.empty())
-            marcarInicializadoPorNome(ultimoDeclaradoNome, pilhaEscopos, tabelaSimbolo);
+            marcarInicializadoPorNome(ultimoDeclaradoNome, pilhaEscopos, tabelaSimbolo, *this);
         inInitList = false; initListDepth = 0; pendingInitList = false;
         return;
 
     case 13:  // Marcar inicialização após atribuição
-        warn("Ação #13: Marcando inicialização após atribuição de " + g_ultimoIdAntesDaAtrib);
-        if (!g_ultimoIdAntesDaAtrib.empty()) {
-            if (g_ultimoIdVisto.find('[') != std::string::npos) {
+        SEM_LOG(*this, Debug, "Ação #13: Marcando inicialização após atribuição de " + ultimoIdAntesDaAtrib);
+        if (!ultimoIdAntesDaAtrib.empty()) {
+            if (ultimoIdVisto.find('[') != std::string::npos) {
                 // Trata atribuição a elemento de vetor (ex.: v[0] = 3)
-                std::string nomeVetor = g_ultimoIdAntesDaAtrib;
-                marcarElementoVetorInicializado(nomeVetor, -1, pilhaEscopos, tabelaSimbolo);
+                std::string nomeVetor = ultimoIdAntesDaAtrib;
+                marcarElementoVetorInicializado(nomeVetor, -1, pilhaEscopos, tabelaSimbolo, *this);
             } else {
-                marcarInicializadoPorNome(g_ultimoIdAntesDaAtrib, pilhaEscopos, tabelaSimbolo);
+                marcarInicializadoPorNome(ultimoIdAntesDaAtrib, pilhaEscopos, tabelaSimbolo, *this);
             }
         }
         return;
@@ -375,26 +401,26 @@ void Semantico::executeAction(int action, const Token* token)
     // PARENTS (assinatura)
     case t_DELIM_PARENTESESE:
         if (modoDeclaracao) {
-            g_inParamList = true;
-            g_paramBuffer.clear();
-            g_funcEmConstrucao = g_ultimoIdVisto;
-            promoverParaFuncao(g_funcEmConstrucao, pilhaEscopos, tabelaSimbolo);
+            inParamList = true;
+            paramBuffer.clear();
+            funcEmConstrucao = ultimoIdVisto;
+            promoverParaFuncao(funcEmConstrucao, pilhaEscopos, tabelaSimbolo);
         }
         break;
 
     case t_DELIM_PARENTESESD:
-        if (g_inParamList) {
-            g_inParamList = false;
-            g_nextBraceIsFuncBody = true;
+        if (inParamList) {
+            inParamList = false;
+            nextBraceIsFuncBody = true;
         }
         endDeclaracao();
         break;
 
     // IDENTIFICADORES
     case t_ID:
-        warn("Processando ID: " + token->getLexeme() + ", Posição: " + std::to_string(token->getPosition()) +
-             ", modoDeclaracao: " + std::to_string(modoDeclaracao));
-        if (g_inParamList) {
+        SEM_LOG(*this, Trace, "Processando ID: " + std::string(token->getLexeme()) + ", Posição: " + posicao(token->getPosition()) +
+                              ", modoDeclaracao: " + std::to_string(modoDeclaracao));
+        if (inParamList) {
             if (tipoAtual.empty())
                 throw SemanticError("Parâmetro sem tipo declarado", token->getPosition());
             if (lastDeclaredPos != token->getPosition()) {
@@ -402,27 +428,27 @@ void Semantico::executeAction(int action, const Token* token)
                 p.tipo = tipoAtual; p.nome = token->getLexeme();
                 p.usado = false; p.inicializado = true;
                 p.modalidade = "parametro";
-                p.escopo = g_funcEmConstrucao.empty() ? "global" : g_funcEmConstrucao;
-                g_paramBuffer.push_back(p);
+                p.escopo = funcEmConstrucao.empty() ? "global" : funcEmConstrucao;
+                paramBuffer.push_back(p);
                 tabelaSimbolo.push_back(p);
                 lastDeclaredPos = token->getPosition();
             }
         } else if (modoDeclaracao && lastDeclaredPos != token->getPosition()) {
             declarar(token);
             lastDeclaredPos = token->getPosition();
-            g_ultimoIdVisto = token->getLexeme();
-            g_ultimoIdAntesDaAtrib = g_ultimoIdVisto;
-            ultimoDeclaradoNome = g_ultimoIdVisto;
+            ultimoIdVisto = token->getLexeme();
+            ultimoIdAntesDaAtrib = ultimoIdVisto;
+            ultimoDeclaradoNome = ultimoIdVisto;
         } else {
             usar(token);
-            g_ultimoIdVisto = token->getLexeme();
-            g_ultimoIdAntesDaAtrib = g_ultimoIdVisto; // Atualiza antes da atribuição
+            ultimoIdVisto = token->getLexeme();
+            ultimoIdAntesDaAtrib = ultimoIdVisto; // Atualiza antes da atribuição
         }
         break;
 
     // VÍRGULA
     case t_DELIM_VIRGULA:
-        if (modoDeclaracao || g_inParamList) {
+        if (modoDeclaracao || inParamList) {
             lastDeclaredPos = -1;
             ultimoDeclaradoNome.clear();
         }
@@ -430,10 +456,10 @@ void Semantico::executeAction(int action, const Token* token)
 
     // PONTO E VÍRGULA
     case t_DELIM_PONTOVIRGULA:
-        warn("Finalizando declaração. modoDeclaracao = " + std::to_string(modoDeclaracao));
+        SEM_LOG(*this, Debug, "Finalizando declaração. modoDeclaracao = " + std::to_string(modoDeclaracao));
         endDeclaracao();
-        g_ultimoIdVisto.clear();
-        g_ultimoIdAntesDaAtrib.clear();
+        ultimoIdVisto.clear();
+        ultimoIdAntesDaAtrib.clear();
         break;
 
     // CHAVES
@@ -446,19 +472,19 @@ void Semantico::executeAction(int action, const Token* token)
 
         abrirEscopo();
         bool ehFunc = false;
-        if (g_nextBraceIsFuncBody) {
+        if (nextBraceIsFuncBody) {
             ehFunc = true;
-            g_nextBraceIsFuncBody = false;
-            if (!g_funcEmConstrucao.empty())
-                pilhaFuncoes.push_back(g_funcEmConstrucao);
+            nextBraceIsFuncBody = false;
+            if (!funcEmConstrucao.empty())
+                pilhaFuncoes.push_back(funcEmConstrucao);
 
             auto& escopoAtual = pilhaEscopos.back();
-            for (const auto& p : g_paramBuffer) {
+            for (const auto& p : paramBuffer) {
                 bool dup = std::any_of(escopoAtual.begin(), escopoAtual.end(),
                                        [&](const Simbolo& s){ return s.nome == p.nome; });
                 if (!dup) escopoAtual.push_back(p);
             }
-            g_paramBuffer.clear();
+            paramBuffer.clear();
             ultimoDeclaradoNome.clear();
         }
         pilhaEscopoEhFuncao.push_back(ehFunc);
@@ -471,14 +497,14 @@ void Semantico::executeAction(int action, const Token* token)
             if (initListDepth == 0) {
                 inInitList = false; pendingInitList = false;
                 if (!ultimoDeclaradoNome.empty())
-                    marcarInicializadoPorNome(ultimoDeclaradoNome, pilhaEscopos, tabelaSimbolo);
+                    marcarInicializadoPorNome(ultimoDeclaradoNome, pilhaEscopos, tabelaSimbolo, *this);
             }
             break;
         }
 
         fecharEscopo();
-        g_ultimoIdVisto.clear();
-        g_ultimoIdAntesDaAtrib.clear();
+        ultimoIdVisto.clear();
+        ultimoIdAntesDaAtrib.clear();
         break;
 
     // '='
@@ -486,9 +512,9 @@ void Semantico::executeAction(int action, const Token* token)
         if (modoDeclaracao) {
             pendingInitList = true;
             if (!ultimoDeclaradoNome.empty()) {
-                marcarInicializadoPorNome(ultimoDeclaradoNome, pilhaEscopos, tabelaSimbolo);
-            } else if (!g_ultimoIdVisto.empty()) {
-                marcarInicializadoPorNome(g_ultimoIdVisto, pilhaEscopos, tabelaSimbolo);
+                marcarInicializadoPorNome(ultimoDeclaradoNome, pilhaEscopos, tabelaSimbolo, *this);
+            } else if (!ultimoIdVisto.empty()) {
+                marcarInicializadoPorNome(ultimoIdVisto, pilhaEscopos, tabelaSimbolo, *this);
             }
         }
         break;
@@ -496,15 +522,15 @@ void Semantico::executeAction(int action, const Token* token)
     // '['
     case t_DELIM_COLCHETESE:
         if (modoDeclaracao) {
-            const std::string alvo = !ultimoDeclaradoNome.empty() ? ultimoDeclaradoNome : g_ultimoIdVisto;
+            const std::string alvo = !ultimoDeclaradoNome.empty() ? ultimoDeclaradoNome : ultimoIdVisto;
             marcarUltimoDeclaradoComoVetor(alvo);
         } else {
-            marcarUsadoPorNome(g_ultimoIdVisto, pilhaEscopos, tabelaSimbolo);
+            marcarUsadoPorNome(ultimoIdVisto, pilhaEscopos, tabelaSimbolo);
         }
         break;
 
     default:
-        warn("Token inesperado: " + token->getLexeme() + " na posição " + std::to_string(token->getPosition()));
+        SEM_LOG(*this, Debug, "Token inesperado: " + std::string(token->getLexeme()) + " na posição " + posicao(token->getPosition()));
         if (id != t_DELIM_PONTOVIRGULA && id != t_DELIM_CHAVEE && id != t_DELIM_CHAVED) {
             return; // Ignorar e continuar
         }
@@ -2,12 +2,26 @@
 #define SEMANTICO_H
 #include "Token.h"
 #include "SemanticError.h"
+#include "SharedVector.h"
 #include <vector>
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <algorithm>
 #include <functional>
 
+// Níveis das mensagens do analisador, do mais ao menos importante: Aviso
+// são os avisos ao usuário (símbolo não usado, usado sem inicialização);
+// Debug acompanha declarações e usos; Trace mostra cada ação semântica.
+enum class NivelLog { Nenhum, Aviso, Debug, Trace };
+
+// Nível máximo compilado (0 a 3, como NivelLog). Mensagens acima dele nem
+// chegam ao executável; até ele, setNivelLog escolhe em execução. Uma
+// mensagem desligada não é montada: nada é formatado, alocado ou escrito.
+#ifndef SEMANTICO_NIVEL_LOG
+#define SEMANTICO_NIVEL_LOG 3
+#endif
+
 class Simbolo {
 public:
     std::string tipo;
@@ -22,6 +36,8 @@ public:
     friend std::ostream& operator<<(std::ostream& os, const Simbolo& s);
 };
 
+typedef SharedVector<Simbolo> TabelaSimbolos;
+
 class Semantico {
 private:
     // ===== Helpers de busca/escopo =====
@@ -35,16 +51,27 @@ private:
     // ===== Estado do analisador =====
     bool        modoDeclaracao = false;
     std::string tipoAtual;
-    int         lastDeclaredPos = -1;
+    long long   lastDeclaredPos = -1;
     std::string ultimoDeclaradoNome;
 
+    // identificadores recentes (vetor [ ] e lado esquerdo de '=') e a
+    // função cujos parâmetros estão sendo lidos. Ficam no objeto, e não em
+    // variáveis globais, para que uma cópia (ponto de retomada do Sintatico)
+    // leve todo o estado da análise
+    std::string          ultimoIdVisto;
+    std::string          ultimoIdAntesDaAtrib;
+    bool                 inParamList = false;
+    bool                 nextBraceIsFuncBody = false;
+    std::string          funcEmConstrucao;
+    std::vector<Simbolo> paramBuffer;
+
     // pilhas de escopos/blocos e funções
-    std::vector<std::vector<Simbolo>> pilhaEscopos;
-    std::vector<std::string>          pilhaFuncoes;
-    std::vector<bool>                 pilhaEscopoEhFuncao;
+    std::vector<SharedVector<Simbolo>> pilhaEscopos;
+    std::vector<std::string>           pilhaFuncoes;
+    std::vector<bool>                  pilhaEscopoEhFuncao;
 
     // tabela linear opcional (histórico/relatório)
-    std::vector<Simbolo>              tabelaLinear;
+    std::vector<Simbolo>               tabelaLinear;
 
     // controle de listas de inicialização
     bool inInitList      = false;
@@ -52,21 +79,22 @@ private:
     bool pendingInitList = false;
 
     // ===== logging/mensagens =====
-    void warn(const std::string& msg) const;
+    std::string posicao(long long pos) const;
     void info(const std::string& msg) const;
     void error(const std::string& msg) const;
     void addMsg(const std::string& msg) const;
 
     // ===== declar/acabamento de declaração =====
     void endDeclaracao();
-    void beginDeclaracao(const std::string& tipo);
+    void beginDeclaracao(std::string_view tipo);
 
     // usado no case 10/colchetes: promove último declarado a "vetor"
     void marcarUltimoDeclaradoComoVetor(const std::string& nome);
 
 public:
-    // tabela “global” que você já usa
-    std::vector<Simbolo> tabelaSimbolo;
+    // tabela “global” que você já usa (em blocos compartilhados entre as
+    // cópias do Semantico: ver SharedVector)
+    TabelaSimbolos tabelaSimbolo;
 
     // API principal
     void executeAction(int action, const Token* token);
@@ -80,12 +108,24 @@ public:
 
     // logging/mensagens
     void setLogger(std::function<void(const std::string&)> fn) { logger_ = std::move(fn); }
+    // Mensagens até este nível (padrão: só os avisos)
+    void setNivelLog(NivelLog nivel) { nivelLog_ = nivel; }
+    bool logAtivo(NivelLog nivel) const {
+        return static_cast<int>(nivel) <= SEMANTICO_NIVEL_LOG && nivel <= nivelLog_;
+    }
+    // Escreve msg no cerr, em mensagens() e no logger. Use pela macro
+    // SEM_LOG (Semantico.cpp), que só monta a mensagem quando logAtivo
+    void log(const std::string& msg) const;
+    // Como as posições aparecem nas mensagens (padrão: deslocamento em bytes)
+    void setPositionFormatter(std::function<std::string(long long)> fn) { positionFormatter_ = std::move(fn); }
     void clearMensagens() { mensagens_.clear(); }
-    const std::vector<std::string>& mensagens() const { return mensagens_; }
+    const SharedVector<std::string>& mensagens() const { return mensagens_; }
 
 private:
     mutable std::function<void(const std::string&)> logger_;
-    mutable std::vector<std::string> mensagens_;
+    NivelLog nivelLog_ = NivelLog::Aviso;
+    std::function<std::string(long long)> positionFormatter_;
+    mutable SharedVector<std::string> mensagens_;
 };
 
 #endif
@@ -57,7 +57,7 @@ bool CodeGeneratorBIP::isGlobalDataCandidate(const Simbolo& s) {
 }
 
 // =================== .data ===================
-std::string CodeGeneratorBIP::buildDataSection(const std::vector<Simbolo>& tabela) const {
+std::string CodeGeneratorBIP::buildDataSection(const TabelaSimbolos& tabela) const {
     std::vector<const Simbolo*> cand;
     cand.reserve(tabela.size());
     for (const auto& s : tabela)
@@ -96,7 +96,7 @@ std::string CodeGeneratorBIP::buildDataSection(const std::vector<Simbolo>& tabel
 }
 
 bool CodeGeneratorBIP::emitDataToFile(const std::string& outPath,
-                                      const std::vector<Simbolo>& tabela,
+                                      const TabelaSimbolos& tabela,
                                       std::function<void(const std::string&)> logger) const {
     const std::string text = buildDataSection(tabela);
     std::ofstream ofs(outPath, std::ios::binary);
@@ -264,7 +264,7 @@ std::string CodeGeneratorBIP::buildTextSection() const {
     return oss.str();
 }
 
-std::string CodeGeneratorBIP::buildProgram(const std::vector<Simbolo>& tabela) const {
+std::string CodeGeneratorBIP::buildProgram(const TabelaSimbolos& tabela) const {
     std::ostringstream oss;
     oss << buildDataSection(tabela);
     oss << buildTextSection();
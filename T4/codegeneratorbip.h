@@ -36,7 +36,7 @@ public:
     explicit CodeGeneratorBIP(const Options& opt = Options());
 
     // ========= .data =========
-    std::string buildDataSection(const std::vector<Simbolo>& tabela) const;
+    std::string buildDataSection(const TabelaSimbolos& tabela) const;
 
     // ========= .text – API de emissão =========
     void clearText();                               // limpa buffer de texto
@@ -84,11 +84,11 @@ public:
 
     // ========= Programa completo =========
     std::string buildTextSection() const;
-    std::string buildProgram(const std::vector<Simbolo>& tabela) const;
+    std::string buildProgram(const TabelaSimbolos& tabela) const;
 
     // ========= utilitários =========
     bool emitDataToFile(const std::string& outPath,
-                        const std::vector<Simbolo>& tabela,
+                        const TabelaSimbolos& tabela,
                         std::function<void(const std::string&)> logger = nullptr) const;
 
 private:
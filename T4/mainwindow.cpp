@@ -7,6 +7,7 @@
 #include <QDockWidget>
 #include <QRegularExpression>
 #include <QFile>
+#include <algorithm>
 #include <sstream>
 
 // GALS
@@ -23,7 +24,7 @@
 // ---------------------------------------------
 // Helper: preenche a QTableView da Tabela de Símbolos
 // ---------------------------------------------
-void MainWindow::preencherTabelaSimbolos(const std::vector<Simbolo>& tabela)
+void MainWindow::preencherTabelaSimbolos(const TabelaSimbolos& tabela)
 {
     // limpa conteúdo anterior
     modelSimbolos->removeRows(0, modelSimbolos->rowCount());
@@ -159,6 +160,12 @@ MainWindow::MainWindow(QWidget *parent)
     // Conecta o botão "Compilar" ao slot
     connect(ui->Compilar, &QPushButton::clicked, this, &MainWindow::tratarCliqueBotao);
 
+    // Cada compilação recomeça do último ponto antes da primeira mudança
+    sint.setCheckpoints(true);
+
+    // Mostra até 20 erros léxicos e sintáticos por compilação
+    sint.setMaxErrors(20);
+
     // --- Tabela de Símbolos (QTableView) ---
     modelSimbolos = new QStandardItemModel(this);
     modelSimbolos->setColumnCount(6);
@@ -189,6 +196,12 @@ MainWindow::~MainWindow() {
     delete ui;
 }
 
+void MainWindow::mostrarMensagens()
+{
+    for (const std::string& msg : sem.mensagens())
+        ui->Console->appendPlainText(QString::fromStdString(msg));
+}
+
 void MainWindow::tratarCliqueBotao()
 {
     // Limpa a saída anterior
@@ -202,28 +215,55 @@ void MainWindow::tratarCliqueBotao()
         return;
     }
 
-    // Instancia o pipeline GALS
-    Lexico    lex;      // constrói vazio
-    Sintatico sint;
-    Semantico sem;
-
-    // alimenta o léxico com o código-fonte
-    const QByteArray fonteUtf8 = fonte.toUtf8();   // mantém buffer vivo neste escopo
-    lex.setInput(fonteUtf8.constData());
-
-    // Logger: envia avisos/erros semânticos para o Console
-    sem.setLogger([this](const std::string& msg) {
-        ui->Console->appendPlainText(QString::fromStdString(msg));
-    });
+    // alimenta o léxico com o código-fonte; fonteCompilada mantém o buffer
+    // vivo até a próxima compilação (QByteArray termina em '\0')
+    const QByteArray fonteUtf8 = fonte.toUtf8();
+    const std::size_t comum = std::min(fonteUtf8.size(), fonteCompilada.size());
+    const std::size_t alterado =
+        std::mismatch(fonteUtf8.constData(), fonteUtf8.constData() + comum, fonteCompilada.constData()).first
+        - fonteUtf8.constData();
+    fonteCompilada = fonteUtf8;
+    lex.setInput(InputSource::borrow(fonteCompilada.constData(), fonteCompilada.size(), true));
+
+    // Durante a análise as mensagens só são guardadas: as do trecho
+    // reaproveitado vêm da cópia do semântico no ponto de retomada
+    sem.setLogger(nullptr);
+
+    // Posições como linha/coluna, pelo índice de linhas do léxico
+    auto linhaColuna = [this](long long pos) {
+        LineColumn lc = lex.lineColumn(pos);
+        return "linha " + std::to_string(lc.line) + ", coluna " + std::to_string(lc.column);
+    };
+    sem.setPositionFormatter(linhaColuna);
+
+    // Erros léxicos e sintáticos: todos os que o parser guardou, em ordem
+    auto mostrarErros = [this, &linhaColuna](const AnalysisError &primeiro, bool lexico) {
+        std::vector<Sintatico::Error> erros = sint.getErrors();
+        if (erros.empty())
+            erros.push_back(Sintatico::Error{lexico, primeiro});
+        for (const Sintatico::Error &e : erros) {
+            ui->Console->appendPlainText(
+                QString(e.lexical ? "Erro Léxico: %1 - %2" : "Erro Sintático: %1 - %2")
+                    .arg(toQString(e.error.getMessage()))
+                    .arg(QString::fromStdString(linhaColuna(e.error.getPosition()))));
+        }
+    };
 
     try {
         // Dispara a análise
-        sint.parse(&lex, &sem);
+        sint.reparse(&lex, &sem, alterado);
+        mostrarMensagens();
+
+        // Daqui em diante os avisos vão direto para o Console
+        sem.setLogger([this](const std::string& msg) {
+            ui->Console->appendPlainText(QString::fromStdString(msg));
+        });
 
         // Marcar 'main' como usada (ponto de entrada)
-        for (auto& s : sem.tabelaSimbolo) {
+        for (size_t i = 0; i < sem.tabelaSimbolo.size(); ++i) {
+            const Simbolo& s = sem.tabelaSimbolo[i];
             if (s.nome == "main" && s.modalidade == "funcao") {
-                s.usado = true;
+                sem.tabelaSimbolo.edit(i).usado = true;
                 break;
             }
         }
@@ -260,21 +300,18 @@ void MainWindow::tratarCliqueBotao()
         qDebug() << "Compilado com sucesso";
     }
     catch (const LexicalError &err) {
-        ui->Console->appendPlainText(
-            QString("Erro Léxico: %1 - posição: %2")
-                .arg(toQString(err.getMessage()))
-                .arg(err.getPosition()));
+        mostrarMensagens();
+        mostrarErros(err, true);
     }
     catch (const SyntacticError &err) {
-        ui->Console->appendPlainText(
-            QString("Erro Sintático: %1 - posição: %2")
-                .arg(toQString(err.getMessage()))
-                .arg(err.getPosition()));
+        mostrarMensagens();
+        mostrarErros(err, false);
     }
     catch (const SemanticError &err) {
+        mostrarMensagens();
         ui->Console->appendPlainText(
-            QString("Erro Semântico: %1 - posição: %2")
+            QString("Erro Semântico: %1 - %2")
                 .arg(toQString(err.getMessage()))
-                .arg(err.getPosition()));
+                .arg(QString::fromStdString(linhaColuna(err.getPosition()))));
     }
 }
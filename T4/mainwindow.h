@@ -32,8 +32,19 @@ private:
     // Modelo da Tabela de Símbolos (renderizado no ui->tableView)
     QStandardItemModel *modelSimbolos = nullptr;
 
+    // Análise incremental: o texto da última compilação (o léxico aponta
+    // para ele) e os analisadores, que guardam os pontos de retomada do
+    // sintático de um clique para o outro
+    QByteArray fonteCompilada;
+    Lexico    lex;
+    Sintatico sint;
+    Semantico sem;
+
+    // Mensagens do semântico, inclusive as do trecho reaproveitado
+    void mostrarMensagens();
+
     // Helper para preencher o QTableView com os símbolos do semântico
-    void preencherTabelaSimbolos(const std::vector<Simbolo>& tabela);
+    void preencherTabelaSimbolos(const TabelaSimbolos& tabela);
 
     // Converte mensagens/strings para QString
     static QString toQString(const QString &s) { return s; }
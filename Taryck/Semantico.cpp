@@ -6,12 +6,6 @@
 #include <algorithm>
 #include <string>
 
-static std::string g_ultimoIdVisto;
-static std::string g_ultimoIdAntesDaAtrib;
-static bool        g_inParamList = false;
-static bool        g_nextBraceIsFuncBody = false;
-static std::string g_funcEmConstrucao;
-static std::vector<Simbolo> g_paramBuffer;
 
 // --------- utilitários ---------
 std::ostream& operator<<(std::ostream& os, const Simbolo& s) {
@@ -24,18 +18,24 @@ std::ostream& operator<<(std::ostream& os, const Simbolo& s) {
     return os;
 }
 
+// Os símbolos são alterados por edit, que copia o bloco se uma cópia do
+// Semantico (ponto de retomada) ainda o divide; por isso só se altera o que
+// muda de fato
+
 // Promove o último ID declarado para FUNÇÃO (modalidade/escopo)
 // e, se for 'main', marca como USADA (ponto de entrada)
 static void promoverParaFuncao(
     const std::string& nomeFunc,
-    std::vector<std::vector<Simbolo>>& pilhaEscopos,
-    std::vector<Simbolo>& tabelaSimbolo
+    std::vector<SharedVector<Simbolo>>& pilhaEscopos,
+    TabelaSimbolos& tabelaSimbolo
     ){
     if (nomeFunc.empty() || pilhaEscopos.empty()) return;
 
     // no escopo atual (global neste ponto)
-    for (auto& s : pilhaEscopos.back()) {
-        if (s.nome == nomeFunc) {
+    auto& escopo = pilhaEscopos.back();
+    for (size_t i = 0; i < escopo.size(); ++i) {
+        if (escopo[i].nome == nomeFunc) {
+            Simbolo& s = escopo.edit(i);
             s.modalidade   = "funcao";
             s.escopo       = "global";
             s.inicializado = true; // “existe”
@@ -46,8 +46,9 @@ static void promoverParaFuncao(
             }
 
             // refletir na tabela de exibição
-            for (auto& t : tabelaSimbolo) {
-                if (t.nome == s.nome && t.tipo == s.tipo && t.escopo == "global") {
+            for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                if (tabelaSimbolo[j].nome == s.nome && tabelaSimbolo[j].tipo == s.tipo && tabelaSimbolo[j].escopo == "global") {
+                    Simbolo& t = tabelaSimbolo.edit(j);
                     t.modalidade   = "funcao";
                     t.inicializado = true;
                     if (nomeFunc == "main") t.usado = true; // espelha
@@ -60,17 +61,20 @@ static void promoverParaFuncao(
 
 static void marcarUsadoPorNome(
     const std::string& nome,
-    std::vector<std::vector<Simbolo>>& pilhaEscopos,
-    std::vector<Simbolo>& tabelaSimbolo
+    std::vector<SharedVector<Simbolo>>& pilhaEscopos,
+    TabelaSimbolos& tabelaSimbolo
     ) {
     if (nome.empty()) return;
     for (auto& escopo : pilhaEscopos) {
-        for (auto& simbolo : escopo) {
-            if (simbolo.nome == nome) {
-                simbolo.usado = true;
-                for (auto& s : tabelaSimbolo)
-                    if (s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo)
-                        s.usado = true;
+        for (size_t i = 0; i < escopo.size(); ++i) {
+            if (escopo[i].nome == nome) {
+                if (!escopo[i].usado) escopo.edit(i).usado = true;
+                const Simbolo& simbolo = escopo[i];
+                for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                    const Simbolo& s = tabelaSimbolo[j];
+                    if (!s.usado && s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo)
+                        tabelaSimbolo.edit(j).usado = true;
+                }
                 return;
             }
         }
@@ -79,23 +83,26 @@ static void marcarUsadoPorNome(
 
 static void marcarInicializadoPorNome(
     const std::string& nome,
-    std::vector<std::vector<Simbolo>>& pilhaEscopos,
-    std::vector<Simbolo>& tabelaSimbolo
+    std::vector<SharedVector<Simbolo>>& pilhaEscopos,
+    TabelaSimbolos& tabelaSimbolo
     ) {
     if (nome.empty()) return;
     for (auto it = pilhaEscopos.rbegin(); it != pilhaEscopos.rend(); ++it) {
-        for (auto& simbolo : *it) {
-            if (simbolo.nome == nome) {
-                simbolo.inicializado = true;
+        for (size_t i = 0; i < it->size(); ++i) {
+            if ((*it)[i].nome == nome) {
+                if (!(*it)[i].inicializado) it->edit(i).inicializado = true;
                 // Se quiser considerar "atribuição conta como uso", descomente a linha abaixo:
-                // simbolo.usado = true;
+                // it->edit(i).usado = true;
+                const Simbolo& simbolo = (*it)[i];
 
-                for (auto& s : tabelaSimbolo)
-                    if (s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo) {
-                        s.inicializado = true;
+                for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                    const Simbolo& s = tabelaSimbolo[j];
+                    if (!s.inicializado && s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo) {
+                        tabelaSimbolo.edit(j).inicializado = true;
                         // E espelhe também aqui se habilitar o comportamento acima:
-                        // s.usado = true;
+                        // tabelaSimbolo.edit(j).usado = true;
                     }
+                }
                 return;
             }
         }
@@ -120,13 +127,16 @@ bool Semantico::existe(const std::string& nome) const {
 void Semantico::marcarUltimoDeclaradoComoVetor(const std::string& nome) {
     if (nome.empty() || pilhaEscopos.empty()) return;
     auto& escopoAtual = pilhaEscopos.back();
-    for (auto& sim : escopoAtual) {
-        if (sim.nome == nome) {
-            sim.modalidade = "vetor";
+    for (size_t i = 0; i < escopoAtual.size(); ++i) {
+        if (escopoAtual[i].nome == nome) {
+            if (escopoAtual[i].modalidade != "vetor") escopoAtual.edit(i).modalidade = "vetor";
+            const Simbolo& sim = escopoAtual[i];
             // refletir na tabela de exibição
-            for (auto& s : tabelaSimbolo)
-                if (s.nome == sim.nome && s.tipo == sim.tipo && s.escopo == sim.escopo)
-                    s.modalidade = "vetor";
+            for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                const Simbolo& s = tabelaSimbolo[j];
+                if (s.modalidade != "vetor" && s.nome == sim.nome && s.tipo == sim.tipo && s.escopo == sim.escopo)
+                    tabelaSimbolo.edit(j).modalidade = "vetor";
+            }
             return;
         }
     }
@@ -139,7 +149,7 @@ void Semantico::declarar(const Token* tok) {
     // Só declara se realmente for um identificador
     if (tok->getId() != t_ID) return;
 
-    const std::string nome = tok->getLexeme();
+    const std::string nome(tok->getLexeme());
     if (nome.empty()) return;
 
     if (pilhaEscopos.empty()) abrirEscopo();
@@ -164,37 +174,40 @@ void Semantico::declarar(const Token* tok) {
     pilhaEscopos.back().push_back(sim);
     tabelaSimbolo.push_back(sim);
 
-    g_ultimoIdVisto        = nome;
-    g_ultimoIdAntesDaAtrib = nome;
+    ultimoIdVisto        = nome;
+    ultimoIdAntesDaAtrib = nome;
     ultimoDeclaradoNome    = nome;
 }
 
 void Semantico::usar(const Token* tok) {
-    const std::string nome = tok->getLexeme();
+    const std::string_view nome = tok->getLexeme();
     if (nome.empty()) return;
 
     bool encontrado = false;
     for (auto& escopo : pilhaEscopos) {
-        for (auto& simbolo : escopo) {
-            if (simbolo.nome == nome) {
+        for (size_t i = 0; i < escopo.size(); ++i) {
+            if (escopo[i].nome == nome) {
+                if (!escopo[i].usado) escopo.edit(i).usado = true;
+                const Simbolo& simbolo = escopo[i];
                 if (!simbolo.inicializado) {
-                    warn("Aviso: Símbolo '" + nome +
+                    warn("Aviso: Símbolo '" + std::string(nome) +
                          "' (tipo: " + simbolo.tipo +
                          ", escopo: " + simbolo.escopo +
                          ") usado sem inicialização na posição " +
-                         std::to_string(tok->getPosition()));
+                         posicao(tok->getPosition()));
+                }
+                for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                    const Simbolo& s = tabelaSimbolo[j];
+                    if (!s.usado && s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo)
+                        tabelaSimbolo.edit(j).usado = true;
                 }
-                simbolo.usado = true;
-                for (auto& s : tabelaSimbolo)
-                    if (s.nome == simbolo.nome && s.tipo == simbolo.tipo && s.escopo == simbolo.escopo)
-                        s.usado = true;
                 encontrado = true; break;
             }
         }
         if (encontrado) break;
     }
     if (!encontrado) {
-        throw SemanticError("Símbolo '" + nome + "' não declarado neste escopo", tok->getPosition());
+        throw SemanticError("Símbolo '" + std::string(nome) + "' não declarado neste escopo", tok->getPosition());
     }
 }
 
@@ -239,6 +252,10 @@ void Semantico::warn(const std::string& msg) const {
     if (logger_) logger_(msg);
 }
 
+std::string Semantico::posicao(long long pos) const {
+    return positionFormatter_ ? positionFormatter_(pos) : std::to_string(pos);
+}
+
 void Semantico::executeAction(int action, const Token* token)
 {
     // Marcadores da gramática
@@ -247,9 +264,9 @@ void Semantico::executeAction(int action, const Token* token)
         if (token && modoDeclaracao && lastDeclaredPos != token->getPosition()) {
             declarar(token);
             lastDeclaredPos        = token->getPosition();
-            g_ultimoIdVisto        = token->getLexeme();
-            g_ultimoIdAntesDaAtrib = g_ultimoIdVisto;
-            ultimoDeclaradoNome    = g_ultimoIdVisto;
+            ultimoIdVisto        = token->getLexeme();
+            ultimoIdAntesDaAtrib = ultimoIdVisto;
+            ultimoDeclaradoNome    = ultimoIdVisto;
         }
         return;
 
@@ -293,27 +310,29 @@ void Semantico::executeAction(int action, const Token* token)
     // --------------- '(' (assinatura de função) ---------------
     case t_DELIM_PARENTESESE:
         if (modoDeclaracao) {
-            g_inParamList = true;
-            g_paramBuffer.clear();
-            g_funcEmConstrucao = g_ultimoIdVisto;
+            inParamList = true;
+            paramBuffer.clear();
+            funcEmConstrucao = ultimoIdVisto;
 
             // promove p/ função (ajusta modalidade/escopo/inicializado)
-            promoverParaFuncao(g_funcEmConstrucao, pilhaEscopos, tabelaSimbolo);
+            promoverParaFuncao(funcEmConstrucao, pilhaEscopos, tabelaSimbolo);
 
             // reforço: tratar 'main' como usada (em pilha e em tabela)
-            if (g_funcEmConstrucao == "main") {
+            if (funcEmConstrucao == "main") {
                 // marca na pilha
                 for (auto &esc : pilhaEscopos) {
-                    for (auto &sym : esc) {
-                        if (sym.nome == "main" && sym.modalidade == "funcao" && sym.escopo == "global") {
-                            sym.usado = true;
+                    for (size_t i = 0; i < esc.size(); ++i) {
+                        const Simbolo &sym = esc[i];
+                        if (!sym.usado && sym.nome == "main" && sym.modalidade == "funcao" && sym.escopo == "global") {
+                            esc.edit(i).usado = true;
                         }
                     }
                 }
                 // espelha em tabelaSimbolo
-                for (auto &t : tabelaSimbolo) {
-                    if (t.nome == "main" && t.modalidade == "funcao" && t.escopo == "global") {
-                        t.usado = true;
+                for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                    const Simbolo &t = tabelaSimbolo[j];
+                    if (!t.usado && t.nome == "main" && t.modalidade == "funcao" && t.escopo == "global") {
+                        tabelaSimbolo.edit(j).usado = true;
                     }
                 }
             }
@@ -321,16 +340,16 @@ void Semantico::executeAction(int action, const Token* token)
         break;
 
     case t_DELIM_PARENTESESD:
-        if (g_inParamList) {
-            g_inParamList = false;
-            g_nextBraceIsFuncBody = true;
+        if (inParamList) {
+            inParamList = false;
+            nextBraceIsFuncBody = true;
         }
         endDeclaracao();
         break;
 
     // --------------- IDENTIFICADORES ---------------
     case t_ID:
-        if (g_inParamList) {
+        if (inParamList) {
             // parâmetro
             if (tipoAtual.empty())
                 throw SemanticError("Parâmetro sem tipo declarado", token->getPosition());
@@ -340,8 +359,8 @@ void Semantico::executeAction(int action, const Token* token)
                 p.tipo = tipoAtual; p.nome = token->getLexeme();
                 p.usado = false; p.inicializado = true;
                 p.modalidade = "parametro";
-                p.escopo = g_funcEmConstrucao.empty() ? "global" : g_funcEmConstrucao;
-                g_paramBuffer.push_back(p);
+                p.escopo = funcEmConstrucao.empty() ? "global" : funcEmConstrucao;
+                paramBuffer.push_back(p);
                 tabelaSimbolo.push_back(p);
                 lastDeclaredPos = token->getPosition();
             }
@@ -350,19 +369,19 @@ void Semantico::executeAction(int action, const Token* token)
                 declarar(token);
                 lastDeclaredPos = token->getPosition();
             }
-            g_ultimoIdVisto        = token->getLexeme();
-            g_ultimoIdAntesDaAtrib = g_ultimoIdVisto;
-            ultimoDeclaradoNome    = g_ultimoIdVisto;
+            ultimoIdVisto        = token->getLexeme();
+            ultimoIdAntesDaAtrib = ultimoIdVisto;
+            ultimoDeclaradoNome    = ultimoIdVisto;
         } else {
             usar(token);
-            g_ultimoIdVisto        = token->getLexeme();
-            g_ultimoIdAntesDaAtrib = g_ultimoIdVisto;
+            ultimoIdVisto        = token->getLexeme();
+            ultimoIdAntesDaAtrib = ultimoIdVisto;
         }
         break;
 
     // --------------- VÍRGULA ---------------
     case t_DELIM_VIRGULA:
-        if (modoDeclaracao || g_inParamList) {
+        if (modoDeclaracao || inParamList) {
             lastDeclaredPos = -1;
             ultimoDeclaradoNome.clear();
         }
@@ -371,8 +390,8 @@ void Semantico::executeAction(int action, const Token* token)
     // --------------- PONTO E VÍRGULA ---------------
     case t_DELIM_PONTOVIRGULA:
         endDeclaracao();
-        g_ultimoIdVisto.clear();
-        g_ultimoIdAntesDaAtrib.clear();
+        ultimoIdVisto.clear();
+        ultimoIdAntesDaAtrib.clear();
         // (endDeclaracao já limpa estados de init-list)
         break;
 
@@ -388,19 +407,19 @@ void Semantico::executeAction(int action, const Token* token)
         // Bloco “de verdade”
         abrirEscopo();
         bool ehFunc = false;
-        if (g_nextBraceIsFuncBody) {
+        if (nextBraceIsFuncBody) {
             ehFunc = true;
-            g_nextBraceIsFuncBody = false;
-            if (!g_funcEmConstrucao.empty())
-                pilhaFuncoes.push_back(g_funcEmConstrucao);
+            nextBraceIsFuncBody = false;
+            if (!funcEmConstrucao.empty())
+                pilhaFuncoes.push_back(funcEmConstrucao);
 
             auto& escopoAtual = pilhaEscopos.back();
-            for (const auto& p : g_paramBuffer) {
+            for (const auto& p : paramBuffer) {
                 bool dup = std::any_of(escopoAtual.begin(), escopoAtual.end(),
                                        [&](const Simbolo& s){ return s.nome == p.nome; });
                 if (!dup) escopoAtual.push_back(p);
             }
-            g_paramBuffer.clear();
+            paramBuffer.clear();
             ultimoDeclaradoNome.clear();
         }
         pilhaEscopoEhFuncao.push_back(ehFunc);
@@ -422,8 +441,8 @@ void Semantico::executeAction(int action, const Token* token)
 
         // Fechamento de bloco real
         fecharEscopo();
-        g_ultimoIdVisto.clear();
-        g_ultimoIdAntesDaAtrib.clear();
+        ultimoIdVisto.clear();
+        ultimoIdAntesDaAtrib.clear();
         break;
 
     // --------------- '=' ---------------
@@ -434,17 +453,17 @@ void Semantico::executeAction(int action, const Token* token)
             // (a marcação “inicializado” do escalar fica a cargo de #11;
             //  se vier '{', #12/fecho de lista marcará)
         } else {
-            marcarInicializadoPorNome(g_ultimoIdAntesDaAtrib, pilhaEscopos, tabelaSimbolo);
+            marcarInicializadoPorNome(ultimoIdAntesDaAtrib, pilhaEscopos, tabelaSimbolo);
         }
         break;
 
     // --------------- '[' ---------------
     case t_DELIM_COLCHETESE:
         if (modoDeclaracao) {
-            const std::string alvo = !ultimoDeclaradoNome.empty() ? ultimoDeclaradoNome : g_ultimoIdVisto;
+            const std::string alvo = !ultimoDeclaradoNome.empty() ? ultimoDeclaradoNome : ultimoIdVisto;
             marcarUltimoDeclaradoComoVetor(alvo);
         } else {
-            marcarUsadoPorNome(g_ultimoIdVisto, pilhaEscopos, tabelaSimbolo);
+            marcarUsadoPorNome(ultimoIdVisto, pilhaEscopos, tabelaSimbolo);
         }
         break;
 
@@ -2,8 +2,10 @@
 #define SEMANTICO_H
 #include "Token.h"
 #include "SemanticError.h"
+#include "SharedVector.h"
 #include <vector>
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <algorithm>
 #include <functional>   // +++ ADICIONE
@@ -20,15 +22,29 @@ public:
     friend std::ostream& operator<<(std::ostream& os, const Simbolo& s);
 };
 
+typedef SharedVector<Simbolo> TabelaSimbolos;
+
 class Semantico {
 private:
     bool        modoDeclaracao = false;
     std::string tipoAtual;
-    int         lastDeclaredPos = -1;
+    long long   lastDeclaredPos = -1;
 
     std::string ultimoDeclaradoNome;
 
-    std::vector<std::vector<Simbolo>> pilhaEscopos;
+    // Identificadores recentes (vetor [ ] e LHS de '=') e a função cujos
+    // parâmetros estão sendo lidos; no objeto, para que a cópia feita num
+    // ponto de retomada do Sintatico leve todo o estado
+    std::string          ultimoIdVisto;
+    std::string          ultimoIdAntesDaAtrib;
+    bool                 inParamList = false;
+    bool                 nextBraceIsFuncBody = false;
+    std::string          funcEmConstrucao;
+    std::vector<Simbolo> paramBuffer;
+
+    // escopos e tabela em blocos compartilhados entre as cópias do
+    // Semantico (ver SharedVector)
+    std::vector<SharedVector<Simbolo>> pilhaEscopos;
     std::vector<std::string> pilhaFuncoes;
     std::vector<bool>        pilhaEscopoEhFuncao;
 
@@ -43,10 +59,12 @@ private:
     void usar(const Token* tok);
 
     mutable std::function<void(const std::string&)> logger_;   // << mutable
-    mutable std::vector<std::string> mensagens_;               // << mutable
+    std::function<std::string(long long)> positionFormatter_;
+    mutable SharedVector<std::string> mensagens_;              // << mutable
 
     // helper de aviso agora é const
     void warn(const std::string& msg) const;
+    std::string posicao(long long pos) const;
 
     std::string escopoAtual() const {
         return pilhaFuncoes.empty() ? "global" : pilhaFuncoes.back();
@@ -54,7 +72,7 @@ private:
 
     void marcarUltimoDeclaradoComoVetor(const std::string& nome);
 
-    void beginDeclaracao(const std::string& tipo) {
+    void beginDeclaracao(std::string_view tipo) {
         modoDeclaracao = true; tipoAtual = tipo; lastDeclaredPos = -1;
     }
     void endDeclaracao() {
@@ -66,7 +84,7 @@ private:
     }
 
 public:
-    std::vector<Simbolo> tabelaSimbolo;
+    TabelaSimbolos tabelaSimbolo;
 
     void executeAction(int action, const Token* token);
     void abrirEscopo() { pilhaEscopos.push_back({}); }
@@ -75,8 +93,10 @@ public:
 
     // +++ NOVO: API do logger
     void setLogger(std::function<void(const std::string&)> fn) { logger_ = std::move(fn); }
+    // Como as posições aparecem nas mensagens (padrão: deslocamento em bytes)
+    void setPositionFormatter(std::function<std::string(long long)> fn) { positionFormatter_ = std::move(fn); }
     void clearMensagens() { mensagens_.clear(); }
-    const std::vector<std::string>& mensagens() const { return mensagens_; }
+    const SharedVector<std::string>& mensagens() const { return mensagens_; }
 };
 
 #endif
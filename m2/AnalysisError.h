@@ -7,15 +7,15 @@ class AnalysisError
 {
 public:
 
-    AnalysisError(const std::string &msg, int position = -1)
+    AnalysisError(const std::string &msg, long long position = -1)
       : message(msg), position(position) { }
 
     const char *getMessage() const { return message.c_str(); }
-    int getPosition() const { return position; }
+    long long getPosition() const { return position; }
 
 private:
     std::string message;
-    int position;
+    long long position;
 };
 
 #endif
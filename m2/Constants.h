@@ -101,13 +101,18 @@ enum TokenId
     t_COMENT_BLOCO = 95
 };
 
-const int STATES_COUNT = 266;
+const int STATES_COUNT = 52;
 
-extern int SCANNER_TABLE[STATES_COUNT][256];
+extern const int SCANNER_TABLE[STATES_COUNT][256];
 
-extern int TOKEN_STATE[STATES_COUNT];
+extern const int TOKEN_STATE[STATES_COUNT];
 
-extern const char *SCANNER_ERROR[STATES_COUNT];
+extern const char *const SCANNER_ERROR[STATES_COUNT];
+
+const int SPECIAL_CASES = 52;
+extern const int SPECIAL_CASES_INDEXES[97];
+extern const char *const SPECIAL_CASES_KEYS[52];
+extern const int SPECIAL_CASES_VALUES[52];
 
 const int FIRST_SEMANTIC_ACTION = 142;
 
@@ -122,6 +127,6 @@ extern const int PARSER_TABLE[296][149][2];
 
 extern const int PRODUCTIONS[134][2];
 
-extern const char *PARSER_ERROR[296];
+extern const char *const PARSER_ERROR[296];
 
 #endif
@@ -0,0 +1,28585 @@
+// Gerado por tools/gen_direct_parser.cpp a partir de Constants.cpp. Não editar:
+// depois de regenerar as tabelas no GALS, gere este arquivo de novo.
+
+#include "Sintatico.h"
+
+static_assert(FIRST_SEMANTIC_ACTION == 142 && sizeof PARSER_TABLE / sizeof PARSER_TABLE[0] == 296,
+              "DirectParser.cpp não corresponde a Constants.cpp");
+
+void Sintatico::runDirect()
+{
+    int errorState;
+
+    //Começa (ou retoma) no estado do topo da pilha
+    switch (stack.top())
+    {
+    case 0: goto d0;
+    case 1: goto d1;
+    case 2: goto d2;
+    case 3: goto d3;
+    case 4: goto d4;
+    case 5: goto d5;
+    case 6: goto d6;
+    case 7: goto d7;
+    case 8: goto d8;
+    case 9: goto d9;
+    case 10: goto d10;
+    case 11: goto d11;
+    case 12: goto d12;
+    case 13: goto d13;
+    case 14: goto d14;
+    case 15: goto d15;
+    case 16: goto d16;
+    case 17: goto d17;
+    case 18: goto d18;
+    case 19: goto d19;
+    case 20: goto d20;
+    case 21: goto d21;
+    case 22: goto d22;
+    case 23: goto d23;
+    case 24: goto d24;
+    case 25: goto d25;
+    case 26: goto d26;
+    case 27: goto d27;
+    case 28: goto d28;
+    case 29: goto d29;
+    case 30: goto d30;
+    case 31: goto d31;
+    case 32: goto d32;
+    case 33: goto d33;
+    case 34: goto d34;
+    case 35: goto d35;
+    case 36: goto d36;
+    case 37: goto d37;
+    case 38: goto d38;
+    case 39: goto d39;
+    case 40: goto d40;
+    case 41: goto d41;
+    case 42: goto d42;
+    case 43: goto d43;
+    case 44: goto d44;
+    case 45: goto d45;
+    case 46: goto d46;
+    case 47: goto d47;
+    case 48: goto d48;
+    case 49: goto d49;
+    case 50: goto d50;
+    case 51: goto d51;
+    case 52: goto d52;
+    case 53: goto d53;
+    case 54: goto d54;
+    case 55: goto d55;
+    case 56: goto d56;
+    case 57: goto d57;
+    case 58: goto d58;
+    case 59: goto d59;
+    case 60: goto d60;
+    case 61: goto d61;
+    case 62: goto d62;
+    case 63: goto d63;
+    case 64: goto d64;
+    case 65: goto d65;
+    case 66: goto d66;
+    case 67: goto d67;
+    case 68: goto d68;
+    case 69: goto d69;
+    case 70: goto d70;
+    case 71: goto d71;
+    case 72: goto d72;
+    case 73: goto d73;
+    case 74: goto d74;
+    case 75: goto d75;
+    case 76: goto d76;
+    case 77: goto d77;
+    case 78: goto d78;
+    case 79: goto d79;
+    case 80: goto d80;
+    case 81: goto d81;
+    case 82: goto d82;
+    case 83: goto d83;
+    case 84: goto d84;
+    case 85: goto d85;
+    case 86: goto d86;
+    case 87: goto d87;
+    case 88: goto d88;
+    case 89: goto d89;
+    case 90: goto d90;
+    case 91: goto d91;
+    case 92: goto d92;
+    case 93: goto d93;
+    case 94: goto d94;
+    case 95: goto d95;
+    case 96: goto d96;
+    case 97: goto d97;
+    case 98: goto d98;
+    case 99: goto d99;
+    case 100: goto d100;
+    case 101: goto d101;
+    case 102: goto d102;
+    case 103: goto d103;
+    case 104: goto d104;
+    case 105: goto d105;
+    case 106: goto d106;
+    case 107: goto d107;
+    case 108: goto d108;
+    case 109: goto d109;
+    case 110: goto d110;
+    case 111: goto d111;
+    case 112: goto d112;
+    case 113: goto d113;
+    case 114: goto d114;
+    case 115: goto d115;
+    case 116: goto d116;
+    case 117: goto d117;
+    case 118: goto d118;
+    case 119: goto d119;
+    case 120: goto d120;
+    case 121: goto d121;
+    case 122: goto d122;
+    case 123: goto d123;
+    case 124: goto d124;
+    case 125: goto d125;
+    case 126: goto d126;
+    case 127: goto d127;
+    case 128: goto d128;
+    case 129: goto d129;
+    case 130: goto d130;
+    case 131: goto d131;
+    case 132: goto d132;
+    case 133: goto d133;
+    case 134: goto d134;
+    case 135: goto d135;
+    case 136: goto d136;
+    case 137: goto d137;
+    case 138: goto d138;
+    case 139: goto d139;
+    case 140: goto d140;
+    case 141: goto d141;
+    case 142: goto d142;
+    case 143: goto d143;
+    case 144: goto d144;
+    case 145: goto d145;
+    case 146: goto d146;
+    case 147: goto d147;
+    case 148: goto d148;
+    case 149: goto d149;
+    case 150: goto d150;
+    case 151: goto d151;
+    case 152: goto d152;
+    case 153: goto d153;
+    case 154: goto d154;
+    case 155: goto d155;
+    case 156: goto d156;
+    case 157: goto d157;
+    case 158: goto d158;
+    case 159: goto d159;
+    case 160: goto d160;
+    case 161: goto d161;
+    case 162: goto d162;
+    case 163: goto d163;
+    case 164: goto d164;
+    case 165: goto d165;
+    case 166: goto d166;
+    case 167: goto d167;
+    case 168: goto d168;
+    case 169: goto d169;
+    case 170: goto d170;
+    case 171: goto d171;
+    case 172: goto d172;
+    case 173: goto d173;
+    case 174: goto d174;
+    case 175: goto d175;
+    case 176: goto d176;
+    case 177: goto d177;
+    case 178: goto d178;
+    case 179: goto d179;
+    case 180: goto d180;
+    case 181: goto d181;
+    case 182: goto d182;
+    case 183: goto d183;
+    case 184: goto d184;
+    case 185: goto d185;
+    case 186: goto d186;
+    case 187: goto d187;
+    case 188: goto d188;
+    case 189: goto d189;
+    case 190: goto d190;
+    case 191: goto d191;
+    case 192: goto d192;
+    case 193: goto d193;
+    case 194: goto d194;
+    case 195: goto d195;
+    case 196: goto d196;
+    case 197: goto d197;
+    case 198: goto d198;
+    case 199: goto d199;
+    case 200: goto d200;
+    case 201: goto d201;
+    case 202: goto d202;
+    case 203: goto d203;
+    case 204: goto d204;
+    case 205: goto d205;
+    case 206: goto d206;
+    case 207: goto d207;
+    case 208: goto d208;
+    case 209: goto d209;
+    case 210: goto d210;
+    case 211: goto d211;
+    case 212: goto d212;
+    case 213: goto d213;
+    case 214: goto d214;
+    case 215: goto d215;
+    case 216: goto d216;
+    case 217: goto d217;
+    case 218: goto d218;
+    case 219: goto d219;
+    case 220: goto d220;
+    case 221: goto d221;
+    case 222: goto d222;
+    case 223: goto d223;
+    case 224: goto d224;
+    case 225: goto d225;
+    case 226: goto d226;
+    case 227: goto d227;
+    case 228: goto d228;
+    case 229: goto d229;
+    case 230: goto d230;
+    case 231: goto d231;
+    case 232: goto d232;
+    case 233: goto d233;
+    case 234: goto d234;
+    case 235: goto d235;
+    case 236: goto d236;
+    case 237: goto d237;
+    case 238: goto d238;
+    case 239: goto d239;
+    case 240: goto d240;
+    case 241: goto d241;
+    case 242: goto d242;
+    case 243: goto d243;
+    case 244: goto d244;
+    case 245: goto d245;
+    case 246: goto d246;
+    case 247: goto d247;
+    case 248: goto d248;
+    case 249: goto d249;
+    case 250: goto d250;
+    case 251: goto d251;
+    case 252: goto d252;
+    case 253: goto d253;
+    case 254: goto d254;
+    case 255: goto d255;
+    case 256: goto d256;
+    case 257: goto d257;
+    case 258: goto d258;
+    case 259: goto d259;
+    case 260: goto d260;
+    case 261: goto d261;
+    case 262: goto d262;
+    case 263: goto d263;
+    case 264: goto d264;
+    case 265: goto d265;
+    case 266: goto d266;
+    case 267: goto d267;
+    case 268: goto d268;
+    case 269: goto d269;
+    case 270: goto d270;
+    case 271: goto d271;
+    case 272: goto d272;
+    case 273: goto d273;
+    case 274: goto d274;
+    case 275: goto d275;
+    case 276: goto d276;
+    case 277: goto d277;
+    case 278: goto d278;
+    case 279: goto d279;
+    case 280: goto d280;
+    case 281: goto d281;
+    case 282: goto d282;
+    case 283: goto d283;
+    case 284: goto d284;
+    case 285: goto d285;
+    case 286: goto d286;
+    case 287: goto d287;
+    case 288: goto d288;
+    case 289: goto d289;
+    case 290: goto d290;
+    case 291: goto d291;
+    case 292: goto d292;
+    case 293: goto d293;
+    case 294: goto d294;
+    case 295: goto d295;
+    }
+
+d0:
+    switch (currentToken.getId())
+    {
+    case 2:
+        stack.push(14);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d14;
+    case 3:
+        stack.push(15);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d15;
+    case 4:
+        stack.push(21);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d21;
+    case 10:
+        stack.push(18);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d18;
+    case 11:
+        stack.push(16);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d16;
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 14:
+        stack.push(17);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d17;
+    case 15:
+        stack.push(22);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d22;
+    case 16:
+        stack.push(24);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d24;
+    case 17:
+        stack.push(20);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d20;
+    case 18:
+        stack.push(19);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d19;
+    case 19:
+        stack.push(23);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d23;
+    case 22:
+        stack.push(25);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d25;
+    case 30:
+        stack.push(7);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d7;
+    case 52:
+        stack.push(26);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d26;
+    case 53:
+        stack.push(27);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d27;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 62:
+        stack.push(28);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d28;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(30);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d30;
+    default:
+        errorState = 0;
+        goto error;
+    }
+
+d1:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e1_0:
+        return;
+    case 2:
+    e1_1:
+        stack.push(14);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d14;
+    case 3:
+    e1_2:
+        stack.push(15);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d15;
+    case 4:
+    e1_3:
+        stack.push(21);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d21;
+    case 10:
+    e1_9:
+        stack.push(18);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d18;
+    case 11:
+    e1_10:
+        stack.push(16);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d16;
+    case 12:
+    e1_11:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+    e1_12:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 14:
+    e1_13:
+        stack.push(17);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d17;
+    case 15:
+    e1_14:
+        stack.push(22);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d22;
+    case 16:
+    e1_15:
+        stack.push(24);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d24;
+    case 17:
+    e1_16:
+        stack.push(20);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d20;
+    case 18:
+    e1_17:
+        stack.push(19);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d19;
+    case 19:
+    e1_18:
+        stack.push(23);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d23;
+    case 22:
+    e1_21:
+        stack.push(25);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d25;
+    case 30:
+    e1_29:
+        stack.push(7);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d7;
+    case 52:
+    e1_51:
+        stack.push(26);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d26;
+    case 53:
+    e1_52:
+        stack.push(27);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d27;
+    case 61:
+    e1_60:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 62:
+    e1_61:
+        stack.push(28);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d28;
+    case 64:
+    e1_63:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+    e1_64:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+    e1_65:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+    e1_66:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+    e1_79:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+    e1_86:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+    e1_87:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+    e1_88:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+    e1_89:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+    e1_90:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+    e1_91:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+    e1_92:
+        stack.push(30);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d30;
+    default:
+        errorState = 1;
+        goto error;
+    }
+
+d2:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e2_0:
+        stack.pop(1);
+        goto g95_0;
+    case 2:
+    e2_1:
+        stack.pop(1);
+        goto g95_1;
+    case 3:
+    e2_2:
+        stack.pop(1);
+        goto g95_2;
+    case 4:
+    e2_3:
+        stack.pop(1);
+        goto g95_3;
+    case 10:
+    e2_9:
+        stack.pop(1);
+        goto g95_9;
+    case 11:
+    e2_10:
+        stack.pop(1);
+        goto g95_10;
+    case 12:
+    e2_11:
+        stack.pop(1);
+        goto g95_11;
+    case 13:
+    e2_12:
+        stack.pop(1);
+        goto g95_12;
+    case 14:
+    e2_13:
+        stack.pop(1);
+        goto g95_13;
+    case 15:
+    e2_14:
+        stack.pop(1);
+        goto g95_14;
+    case 16:
+    e2_15:
+        stack.pop(1);
+        goto g95_15;
+    case 17:
+    e2_16:
+        stack.pop(1);
+        goto g95_16;
+    case 18:
+    e2_17:
+        stack.pop(1);
+        goto g95_17;
+    case 19:
+    e2_18:
+        stack.pop(1);
+        goto g95_18;
+    case 22:
+    e2_21:
+        stack.pop(1);
+        goto g95_21;
+    case 30:
+    e2_29:
+        stack.pop(1);
+        goto g95_29;
+    case 52:
+    e2_51:
+        stack.pop(1);
+        goto g95_51;
+    case 53:
+    e2_52:
+        stack.pop(1);
+        goto g95_52;
+    case 61:
+    e2_60:
+        stack.pop(1);
+        goto g95_60;
+    case 62:
+    e2_61:
+        stack.pop(1);
+        goto g95_61;
+    case 64:
+    e2_63:
+        stack.pop(1);
+        goto g95_63;
+    case 65:
+    e2_64:
+        stack.pop(1);
+        goto g95_64;
+    case 66:
+    e2_65:
+        stack.pop(1);
+        goto g95_65;
+    case 67:
+    e2_66:
+        stack.pop(1);
+        goto g95_66;
+    case 80:
+    e2_79:
+        stack.pop(1);
+        goto g95_79;
+    case 87:
+    e2_86:
+        stack.pop(1);
+        goto g95_86;
+    case 88:
+    e2_87:
+        stack.pop(1);
+        goto g95_87;
+    case 89:
+    e2_88:
+        stack.pop(1);
+        goto g95_88;
+    case 90:
+    e2_89:
+        stack.pop(1);
+        goto g95_89;
+    case 91:
+    e2_90:
+        stack.pop(1);
+        goto g95_90;
+    case 92:
+    e2_91:
+        stack.pop(1);
+        goto g95_91;
+    case 93:
+    e2_92:
+        stack.pop(1);
+        goto g95_92;
+    default:
+        errorState = 2;
+        goto error;
+    }
+
+d3:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e3_0:
+        stack.pop(1);
+        goto g96_0;
+    case 2:
+    e3_1:
+        stack.pop(1);
+        goto g96_1;
+    case 3:
+    e3_2:
+        stack.pop(1);
+        goto g96_2;
+    case 4:
+    e3_3:
+        stack.pop(1);
+        goto g96_3;
+    case 10:
+    e3_9:
+        stack.pop(1);
+        goto g96_9;
+    case 11:
+    e3_10:
+        stack.pop(1);
+        goto g96_10;
+    case 12:
+    e3_11:
+        stack.pop(1);
+        goto g96_11;
+    case 13:
+    e3_12:
+        stack.pop(1);
+        goto g96_12;
+    case 14:
+    e3_13:
+        stack.pop(1);
+        goto g96_13;
+    case 15:
+    e3_14:
+        stack.pop(1);
+        goto g96_14;
+    case 16:
+    e3_15:
+        stack.pop(1);
+        goto g96_15;
+    case 17:
+    e3_16:
+        stack.pop(1);
+        goto g96_16;
+    case 18:
+    e3_17:
+        stack.pop(1);
+        goto g96_17;
+    case 19:
+    e3_18:
+        stack.pop(1);
+        goto g96_18;
+    case 22:
+    e3_21:
+        stack.pop(1);
+        goto g96_21;
+    case 30:
+    e3_29:
+        stack.pop(1);
+        goto g96_29;
+    case 52:
+    e3_51:
+        stack.pop(1);
+        goto g96_51;
+    case 53:
+    e3_52:
+        stack.pop(1);
+        goto g96_52;
+    case 61:
+    e3_60:
+        stack.pop(1);
+        goto g96_60;
+    case 62:
+    e3_61:
+        stack.pop(1);
+        goto g96_61;
+    case 64:
+    e3_63:
+        stack.pop(1);
+        goto g96_63;
+    case 65:
+    e3_64:
+        stack.pop(1);
+        goto g96_64;
+    case 66:
+    e3_65:
+        stack.pop(1);
+        goto g96_65;
+    case 67:
+    e3_66:
+        stack.pop(1);
+        goto g96_66;
+    case 80:
+    e3_79:
+        stack.pop(1);
+        goto g96_79;
+    case 87:
+    e3_86:
+        stack.pop(1);
+        goto g96_86;
+    case 88:
+    e3_87:
+        stack.pop(1);
+        goto g96_87;
+    case 89:
+    e3_88:
+        stack.pop(1);
+        goto g96_88;
+    case 90:
+    e3_89:
+        stack.pop(1);
+        goto g96_89;
+    case 91:
+    e3_90:
+        stack.pop(1);
+        goto g96_90;
+    case 92:
+    e3_91:
+        stack.pop(1);
+        goto g96_91;
+    case 93:
+    e3_92:
+        stack.pop(1);
+        goto g96_92;
+    default:
+        errorState = 3;
+        goto error;
+    }
+
+d4:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e4_0:
+        stack.pop(1);
+        goto g97_0;
+    case 2:
+    e4_1:
+        stack.pop(1);
+        goto g97_1;
+    case 3:
+    e4_2:
+        stack.pop(1);
+        goto g97_2;
+    case 4:
+    e4_3:
+        stack.pop(1);
+        goto g97_3;
+    case 10:
+    e4_9:
+        stack.pop(1);
+        goto g97_9;
+    case 11:
+    e4_10:
+        stack.pop(1);
+        goto g97_10;
+    case 12:
+    e4_11:
+        stack.pop(1);
+        goto g97_11;
+    case 13:
+    e4_12:
+        stack.pop(1);
+        goto g97_12;
+    case 14:
+    e4_13:
+        stack.pop(1);
+        goto g97_13;
+    case 15:
+    e4_14:
+        stack.pop(1);
+        goto g97_14;
+    case 16:
+    e4_15:
+        stack.pop(1);
+        goto g97_15;
+    case 17:
+    e4_16:
+        stack.pop(1);
+        goto g97_16;
+    case 18:
+    e4_17:
+        stack.pop(1);
+        goto g97_17;
+    case 19:
+    e4_18:
+        stack.pop(1);
+        goto g97_18;
+    case 22:
+    e4_21:
+        stack.pop(1);
+        goto g97_21;
+    case 30:
+    e4_29:
+        stack.pop(1);
+        goto g97_29;
+    case 52:
+    e4_51:
+        stack.pop(1);
+        goto g97_51;
+    case 53:
+    e4_52:
+        stack.pop(1);
+        goto g97_52;
+    case 61:
+    e4_60:
+        stack.pop(1);
+        goto g97_60;
+    case 62:
+    e4_61:
+        stack.pop(1);
+        goto g97_61;
+    case 64:
+    e4_63:
+        stack.pop(1);
+        goto g97_63;
+    case 65:
+    e4_64:
+        stack.pop(1);
+        goto g97_64;
+    case 66:
+    e4_65:
+        stack.pop(1);
+        goto g97_65;
+    case 67:
+    e4_66:
+        stack.pop(1);
+        goto g97_66;
+    case 80:
+    e4_79:
+        stack.pop(1);
+        goto g97_79;
+    case 87:
+    e4_86:
+        stack.pop(1);
+        goto g97_86;
+    case 88:
+    e4_87:
+        stack.pop(1);
+        goto g97_87;
+    case 89:
+    e4_88:
+        stack.pop(1);
+        goto g97_88;
+    case 90:
+    e4_89:
+        stack.pop(1);
+        goto g97_89;
+    case 91:
+    e4_90:
+        stack.pop(1);
+        goto g97_90;
+    case 92:
+    e4_91:
+        stack.pop(1);
+        goto g97_91;
+    case 93:
+    e4_92:
+        stack.pop(1);
+        goto g97_92;
+    default:
+        errorState = 4;
+        goto error;
+    }
+
+d5:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e5_0:
+        stack.pop(1);
+        goto g97_0;
+    case 2:
+    e5_1:
+        stack.pop(1);
+        goto g97_1;
+    case 3:
+    e5_2:
+        stack.pop(1);
+        goto g97_2;
+    case 4:
+    e5_3:
+        stack.pop(1);
+        goto g97_3;
+    case 10:
+    e5_9:
+        stack.pop(1);
+        goto g97_9;
+    case 11:
+    e5_10:
+        stack.pop(1);
+        goto g97_10;
+    case 12:
+    e5_11:
+        stack.pop(1);
+        goto g97_11;
+    case 13:
+    e5_12:
+        stack.pop(1);
+        goto g97_12;
+    case 14:
+    e5_13:
+        stack.pop(1);
+        goto g97_13;
+    case 15:
+    e5_14:
+        stack.pop(1);
+        goto g97_14;
+    case 16:
+    e5_15:
+        stack.pop(1);
+        goto g97_15;
+    case 17:
+    e5_16:
+        stack.pop(1);
+        goto g97_16;
+    case 18:
+    e5_17:
+        stack.pop(1);
+        goto g97_17;
+    case 19:
+    e5_18:
+        stack.pop(1);
+        goto g97_18;
+    case 22:
+    e5_21:
+        stack.pop(1);
+        goto g97_21;
+    case 30:
+    e5_29:
+        stack.pop(1);
+        goto g97_29;
+    case 52:
+    e5_51:
+        stack.pop(1);
+        goto g97_51;
+    case 53:
+    e5_52:
+        stack.pop(1);
+        goto g97_52;
+    case 61:
+    e5_60:
+        stack.pop(1);
+        goto g97_60;
+    case 62:
+    e5_61:
+        stack.pop(1);
+        goto g97_61;
+    case 64:
+    e5_63:
+        stack.pop(1);
+        goto g97_63;
+    case 65:
+    e5_64:
+        stack.pop(1);
+        goto g97_64;
+    case 66:
+    e5_65:
+        stack.pop(1);
+        goto g97_65;
+    case 67:
+    e5_66:
+        stack.pop(1);
+        goto g97_66;
+    case 80:
+    e5_79:
+        stack.pop(1);
+        goto g97_79;
+    case 87:
+    e5_86:
+        stack.pop(1);
+        goto g97_86;
+    case 88:
+    e5_87:
+        stack.pop(1);
+        goto g97_87;
+    case 89:
+    e5_88:
+        stack.pop(1);
+        goto g97_88;
+    case 90:
+    e5_89:
+        stack.pop(1);
+        goto g97_89;
+    case 91:
+    e5_90:
+        stack.pop(1);
+        goto g97_90;
+    case 92:
+    e5_91:
+        stack.pop(1);
+        goto g97_91;
+    case 93:
+    e5_92:
+        stack.pop(1);
+        goto g97_92;
+    default:
+        errorState = 5;
+        goto error;
+    }
+
+d6:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e6_92:
+        stack.push(54);
+        semanticAnalyser->executeAction(1, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e54_92;
+    default:
+        errorState = 6;
+        goto error;
+    }
+
+d7:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(55);
+        semanticAnalyser->executeAction(1, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e55_92;
+    default:
+        errorState = 7;
+        goto error;
+    }
+
+d8:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e8_0:
+        stack.pop(1);
+        goto g98_0;
+    case 2:
+    e8_1:
+        stack.pop(1);
+        goto g98_1;
+    case 3:
+    e8_2:
+        stack.pop(1);
+        goto g98_2;
+    case 4:
+    e8_3:
+        stack.pop(1);
+        goto g98_3;
+    case 10:
+    e8_9:
+        stack.pop(1);
+        goto g98_9;
+    case 11:
+    e8_10:
+        stack.pop(1);
+        goto g98_10;
+    case 12:
+    e8_11:
+        stack.pop(1);
+        goto g98_11;
+    case 13:
+    e8_12:
+        stack.pop(1);
+        goto g98_12;
+    case 14:
+    e8_13:
+        stack.pop(1);
+        goto g98_13;
+    case 15:
+    e8_14:
+        stack.pop(1);
+        goto g98_14;
+    case 16:
+    e8_15:
+        stack.pop(1);
+        goto g98_15;
+    case 17:
+    e8_16:
+        stack.pop(1);
+        goto g98_16;
+    case 18:
+    e8_17:
+        stack.pop(1);
+        goto g98_17;
+    case 19:
+    e8_18:
+        stack.pop(1);
+        goto g98_18;
+    case 22:
+    e8_21:
+        stack.pop(1);
+        goto g98_21;
+    case 30:
+    e8_29:
+        stack.pop(1);
+        goto g98_29;
+    case 52:
+    e8_51:
+        stack.pop(1);
+        goto g98_51;
+    case 53:
+    e8_52:
+        stack.pop(1);
+        goto g98_52;
+    case 61:
+    e8_60:
+        stack.pop(1);
+        goto g98_60;
+    case 62:
+    e8_61:
+        stack.pop(1);
+        goto g98_61;
+    case 64:
+    e8_63:
+        stack.pop(1);
+        goto g98_63;
+    case 65:
+    e8_64:
+        stack.pop(1);
+        goto g98_64;
+    case 66:
+    e8_65:
+        stack.pop(1);
+        goto g98_65;
+    case 67:
+    e8_66:
+        stack.pop(1);
+        goto g98_66;
+    case 80:
+    e8_79:
+        stack.pop(1);
+        goto g98_79;
+    case 87:
+    e8_86:
+        stack.pop(1);
+        goto g98_86;
+    case 88:
+    e8_87:
+        stack.pop(1);
+        goto g98_87;
+    case 89:
+    e8_88:
+        stack.pop(1);
+        goto g98_88;
+    case 90:
+    e8_89:
+        stack.pop(1);
+        goto g98_89;
+    case 91:
+    e8_90:
+        stack.pop(1);
+        goto g98_90;
+    case 92:
+    e8_91:
+        stack.pop(1);
+        goto g98_91;
+    case 93:
+    e8_92:
+        stack.pop(1);
+        goto g98_92;
+    default:
+        errorState = 8;
+        goto error;
+    }
+
+d9:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e9_0:
+        stack.pop(1);
+        goto g98_0;
+    case 2:
+    e9_1:
+        stack.pop(1);
+        goto g98_1;
+    case 3:
+    e9_2:
+        stack.pop(1);
+        goto g98_2;
+    case 4:
+    e9_3:
+        stack.pop(1);
+        goto g98_3;
+    case 10:
+    e9_9:
+        stack.pop(1);
+        goto g98_9;
+    case 11:
+    e9_10:
+        stack.pop(1);
+        goto g98_10;
+    case 12:
+    e9_11:
+        stack.pop(1);
+        goto g98_11;
+    case 13:
+    e9_12:
+        stack.pop(1);
+        goto g98_12;
+    case 14:
+    e9_13:
+        stack.pop(1);
+        goto g98_13;
+    case 15:
+    e9_14:
+        stack.pop(1);
+        goto g98_14;
+    case 16:
+    e9_15:
+        stack.pop(1);
+        goto g98_15;
+    case 17:
+    e9_16:
+        stack.pop(1);
+        goto g98_16;
+    case 18:
+    e9_17:
+        stack.pop(1);
+        goto g98_17;
+    case 19:
+    e9_18:
+        stack.pop(1);
+        goto g98_18;
+    case 22:
+    e9_21:
+        stack.pop(1);
+        goto g98_21;
+    case 30:
+    e9_29:
+        stack.pop(1);
+        goto g98_29;
+    case 52:
+    e9_51:
+        stack.pop(1);
+        goto g98_51;
+    case 53:
+    e9_52:
+        stack.pop(1);
+        goto g98_52;
+    case 61:
+    e9_60:
+        stack.pop(1);
+        goto g98_60;
+    case 62:
+    e9_61:
+        stack.pop(1);
+        goto g98_61;
+    case 64:
+    e9_63:
+        stack.pop(1);
+        goto g98_63;
+    case 65:
+    e9_64:
+        stack.pop(1);
+        goto g98_64;
+    case 66:
+    e9_65:
+        stack.pop(1);
+        goto g98_65;
+    case 67:
+    e9_66:
+        stack.pop(1);
+        goto g98_66;
+    case 80:
+    e9_79:
+        stack.pop(1);
+        goto g98_79;
+    case 87:
+    e9_86:
+        stack.pop(1);
+        goto g98_86;
+    case 88:
+    e9_87:
+        stack.pop(1);
+        goto g98_87;
+    case 89:
+    e9_88:
+        stack.pop(1);
+        goto g98_88;
+    case 90:
+    e9_89:
+        stack.pop(1);
+        goto g98_89;
+    case 91:
+    e9_90:
+        stack.pop(1);
+        goto g98_90;
+    case 92:
+    e9_91:
+        stack.pop(1);
+        goto g98_91;
+    case 93:
+    e9_92:
+        stack.pop(1);
+        goto g98_92;
+    default:
+        errorState = 9;
+        goto error;
+    }
+
+d10:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e10_0:
+        stack.pop(1);
+        goto g98_0;
+    case 2:
+    e10_1:
+        stack.pop(1);
+        goto g98_1;
+    case 3:
+    e10_2:
+        stack.pop(1);
+        goto g98_2;
+    case 4:
+    e10_3:
+        stack.pop(1);
+        goto g98_3;
+    case 10:
+    e10_9:
+        stack.pop(1);
+        goto g98_9;
+    case 11:
+    e10_10:
+        stack.pop(1);
+        goto g98_10;
+    case 12:
+    e10_11:
+        stack.pop(1);
+        goto g98_11;
+    case 13:
+    e10_12:
+        stack.pop(1);
+        goto g98_12;
+    case 14:
+    e10_13:
+        stack.pop(1);
+        goto g98_13;
+    case 15:
+    e10_14:
+        stack.pop(1);
+        goto g98_14;
+    case 16:
+    e10_15:
+        stack.pop(1);
+        goto g98_15;
+    case 17:
+    e10_16:
+        stack.pop(1);
+        goto g98_16;
+    case 18:
+    e10_17:
+        stack.pop(1);
+        goto g98_17;
+    case 19:
+    e10_18:
+        stack.pop(1);
+        goto g98_18;
+    case 22:
+    e10_21:
+        stack.pop(1);
+        goto g98_21;
+    case 30:
+    e10_29:
+        stack.pop(1);
+        goto g98_29;
+    case 52:
+    e10_51:
+        stack.pop(1);
+        goto g98_51;
+    case 53:
+    e10_52:
+        stack.pop(1);
+        goto g98_52;
+    case 61:
+    e10_60:
+        stack.pop(1);
+        goto g98_60;
+    case 62:
+    e10_61:
+        stack.pop(1);
+        goto g98_61;
+    case 64:
+    e10_63:
+        stack.pop(1);
+        goto g98_63;
+    case 65:
+    e10_64:
+        stack.pop(1);
+        goto g98_64;
+    case 66:
+    e10_65:
+        stack.pop(1);
+        goto g98_65;
+    case 67:
+    e10_66:
+        stack.pop(1);
+        goto g98_66;
+    case 80:
+    e10_79:
+        stack.pop(1);
+        goto g98_79;
+    case 87:
+    e10_86:
+        stack.pop(1);
+        goto g98_86;
+    case 88:
+    e10_87:
+        stack.pop(1);
+        goto g98_87;
+    case 89:
+    e10_88:
+        stack.pop(1);
+        goto g98_88;
+    case 90:
+    e10_89:
+        stack.pop(1);
+        goto g98_89;
+    case 91:
+    e10_90:
+        stack.pop(1);
+        goto g98_90;
+    case 92:
+    e10_91:
+        stack.pop(1);
+        goto g98_91;
+    case 93:
+    e10_92:
+        stack.pop(1);
+        goto g98_92;
+    default:
+        errorState = 10;
+        goto error;
+    }
+
+d11:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e11_0:
+        stack.pop(1);
+        goto g98_0;
+    case 2:
+    e11_1:
+        stack.pop(1);
+        goto g98_1;
+    case 3:
+    e11_2:
+        stack.pop(1);
+        goto g98_2;
+    case 4:
+    e11_3:
+        stack.pop(1);
+        goto g98_3;
+    case 10:
+    e11_9:
+        stack.pop(1);
+        goto g98_9;
+    case 11:
+    e11_10:
+        stack.pop(1);
+        goto g98_10;
+    case 12:
+    e11_11:
+        stack.pop(1);
+        goto g98_11;
+    case 13:
+    e11_12:
+        stack.pop(1);
+        goto g98_12;
+    case 14:
+    e11_13:
+        stack.pop(1);
+        goto g98_13;
+    case 15:
+    e11_14:
+        stack.pop(1);
+        goto g98_14;
+    case 16:
+    e11_15:
+        stack.pop(1);
+        goto g98_15;
+    case 17:
+    e11_16:
+        stack.pop(1);
+        goto g98_16;
+    case 18:
+    e11_17:
+        stack.pop(1);
+        goto g98_17;
+    case 19:
+    e11_18:
+        stack.pop(1);
+        goto g98_18;
+    case 22:
+    e11_21:
+        stack.pop(1);
+        goto g98_21;
+    case 30:
+    e11_29:
+        stack.pop(1);
+        goto g98_29;
+    case 52:
+    e11_51:
+        stack.pop(1);
+        goto g98_51;
+    case 53:
+    e11_52:
+        stack.pop(1);
+        goto g98_52;
+    case 61:
+    e11_60:
+        stack.pop(1);
+        goto g98_60;
+    case 62:
+    e11_61:
+        stack.pop(1);
+        goto g98_61;
+    case 64:
+    e11_63:
+        stack.pop(1);
+        goto g98_63;
+    case 65:
+    e11_64:
+        stack.pop(1);
+        goto g98_64;
+    case 66:
+    e11_65:
+        stack.pop(1);
+        goto g98_65;
+    case 67:
+    e11_66:
+        stack.pop(1);
+        goto g98_66;
+    case 80:
+    e11_79:
+        stack.pop(1);
+        goto g98_79;
+    case 87:
+    e11_86:
+        stack.pop(1);
+        goto g98_86;
+    case 88:
+    e11_87:
+        stack.pop(1);
+        goto g98_87;
+    case 89:
+    e11_88:
+        stack.pop(1);
+        goto g98_88;
+    case 90:
+    e11_89:
+        stack.pop(1);
+        goto g98_89;
+    case 91:
+    e11_90:
+        stack.pop(1);
+        goto g98_90;
+    case 92:
+    e11_91:
+        stack.pop(1);
+        goto g98_91;
+    case 93:
+    e11_92:
+        stack.pop(1);
+        goto g98_92;
+    default:
+        errorState = 11;
+        goto error;
+    }
+
+d12:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e12_54:
+        stack.push(56);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d56;
+    default:
+        errorState = 12;
+        goto error;
+    }
+
+d13:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e13_54:
+        stack.push(57);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d57;
+    case 56:
+    e13_55:
+        stack.pop(1);
+        goto g138_55;
+    case 59:
+    e13_58:
+        stack.pop(1);
+        goto g138_58;
+    case 60:
+    e13_59:
+        stack.pop(1);
+        goto g138_59;
+    case 64:
+    e13_63:
+        stack.pop(1);
+        goto g138_63;
+    case 66:
+    e13_65:
+        stack.pop(1);
+        goto g138_65;
+    case 68:
+    e13_67:
+        stack.pop(1);
+        goto g138_67;
+    case 69:
+    e13_68:
+        stack.pop(1);
+        goto g138_68;
+    case 70:
+    e13_69:
+        stack.pop(1);
+        goto g138_69;
+    case 71:
+    e13_70:
+        stack.pop(1);
+        goto g138_70;
+    case 72:
+    e13_71:
+        stack.pop(1);
+        goto g138_71;
+    case 73:
+    e13_72:
+        stack.pop(1);
+        goto g138_72;
+    case 74:
+    e13_73:
+        stack.pop(1);
+        goto g138_73;
+    case 75:
+    e13_74:
+        stack.pop(1);
+        goto g138_74;
+    case 76:
+    e13_75:
+        stack.pop(1);
+        goto g138_75;
+    case 78:
+    e13_77:
+        stack.pop(1);
+        goto g138_77;
+    case 79:
+    e13_78:
+        stack.pop(1);
+        goto g138_78;
+    case 81:
+    e13_80:
+        stack.pop(1);
+        goto g138_80;
+    default:
+        errorState = 13;
+        goto error;
+    }
+
+d14:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(58);
+        semanticAnalyser->executeAction(1, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e58_92;
+    default:
+        errorState = 14;
+        goto error;
+    }
+
+d15:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(59);
+        semanticAnalyser->executeAction(1, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e59_92;
+    default:
+        errorState = 15;
+        goto error;
+    }
+
+d16:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(60);
+        semanticAnalyser->executeAction(1, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e60_92;
+    default:
+        errorState = 16;
+        goto error;
+    }
+
+d17:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(61);
+        semanticAnalyser->executeAction(1, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e61_92;
+    default:
+        errorState = 17;
+        goto error;
+    }
+
+d18:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(62);
+        semanticAnalyser->executeAction(1, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e62_92;
+    default:
+        errorState = 18;
+        goto error;
+    }
+
+d19:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(63);
+        semanticAnalyser->executeAction(1, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e63_92;
+    default:
+        errorState = 19;
+        goto error;
+    }
+
+d20:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(64);
+        semanticAnalyser->executeAction(1, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e64_92;
+    default:
+        errorState = 20;
+        goto error;
+    }
+
+d21:
+    switch (currentToken.getId())
+    {
+    case 61:
+        stack.push(65);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d65;
+    default:
+        errorState = 21;
+        goto error;
+    }
+
+d22:
+    switch (currentToken.getId())
+    {
+    case 61:
+        stack.push(66);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d66;
+    default:
+        errorState = 22;
+        goto error;
+    }
+
+d23:
+    switch (currentToken.getId())
+    {
+    case 61:
+        stack.push(67);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d67;
+    default:
+        errorState = 23;
+        goto error;
+    }
+
+d24:
+    switch (currentToken.getId())
+    {
+    case 62:
+        stack.push(28);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d28;
+    default:
+        errorState = 24;
+        goto error;
+    }
+
+d25:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 55:
+        stack.push(69);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d69;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 25;
+        goto error;
+    }
+
+d26:
+    switch (currentToken.getId())
+    {
+    case 82:
+        stack.push(74);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d74;
+    default:
+        errorState = 26;
+        goto error;
+    }
+
+d27:
+    switch (currentToken.getId())
+    {
+    case 81:
+        stack.push(76);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d76;
+    default:
+        errorState = 27;
+        goto error;
+    }
+
+d28:
+    switch (currentToken.getId())
+    {
+    case 2:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_1;
+    case 3:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_2;
+    case 4:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_3;
+    case 10:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_9;
+    case 11:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_10;
+    case 12:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_11;
+    case 13:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_12;
+    case 14:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_13;
+    case 15:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_14;
+    case 16:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_15;
+    case 17:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_16;
+    case 18:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_17;
+    case 19:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_18;
+    case 22:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_21;
+    case 52:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_51;
+    case 53:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_52;
+    case 61:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_60;
+    case 62:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_61;
+    case 64:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_63;
+    case 65:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_64;
+    case 66:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_65;
+    case 67:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_66;
+    case 80:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_79;
+    case 87:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_86;
+    case 88:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_87;
+    case 89:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_88;
+    case 90:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_89;
+    case 91:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_90;
+    case 92:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_91;
+    case 93:
+        stack.push(77);
+        semanticAnalyser->executeAction(5, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e77_92;
+    default:
+        errorState = 28;
+        goto error;
+    }
+
+d29:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e29_54:
+        stack.pop(1);
+        goto g127_54;
+    case 56:
+    e29_55:
+        stack.pop(1);
+        goto g127_55;
+    case 59:
+    e29_58:
+        stack.pop(1);
+        goto g127_58;
+    case 60:
+    e29_59:
+        stack.pop(1);
+        goto g127_59;
+    case 81:
+    e29_80:
+        stack.pop(1);
+        goto g127_80;
+    default:
+        errorState = 29;
+        goto error;
+    }
+
+d30:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_54;
+    case 56:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_55;
+    case 58:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_57;
+    case 59:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_58;
+    case 60:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_59;
+    case 61:
+        stack.push(78);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d78;
+    case 64:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_63;
+    case 65:
+        stack.push(80);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d80;
+    case 66:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_65;
+    case 67:
+        stack.push(81);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d81;
+    case 68:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_67;
+    case 69:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_68;
+    case 70:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_69;
+    case 71:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_70;
+    case 72:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_71;
+    case 73:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_72;
+    case 74:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_73;
+    case 75:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_74;
+    case 76:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_75;
+    case 77:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 79;
+        goto error;
+    case 78:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_77;
+    case 79:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_78;
+    case 81:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_80;
+    case 82:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 79;
+        goto error;
+    default:
+        errorState = 30;
+        goto error;
+    }
+
+d31:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e31_54:
+        stack.push(82);
+        goto e82_54;
+    case 56:
+    e31_55:
+        stack.push(82);
+        goto e82_55;
+    case 59:
+    e31_58:
+        stack.push(82);
+        goto e82_58;
+    case 60:
+    e31_59:
+        stack.push(82);
+        goto e82_59;
+    case 78:
+    e31_77:
+        stack.push(84);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d84;
+    case 79:
+    e31_78:
+        stack.push(83);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d83;
+    case 81:
+    e31_80:
+        stack.push(82);
+        goto e82_80;
+    default:
+        errorState = 31;
+        goto error;
+    }
+
+d32:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e32_54:
+        stack.push(85);
+        goto e85_54;
+    case 56:
+    e32_55:
+        stack.push(85);
+        goto e85_55;
+    case 59:
+    e32_58:
+        stack.push(85);
+        goto e85_58;
+    case 60:
+    e32_59:
+        stack.push(85);
+        goto e85_59;
+    case 71:
+    e32_70:
+        stack.push(86);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d86;
+    case 72:
+    e32_71:
+        stack.push(87);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d87;
+    case 73:
+    e32_72:
+        stack.push(90);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d90;
+    case 74:
+    e32_73:
+        stack.push(91);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d91;
+    case 75:
+    e32_74:
+        stack.push(88);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d88;
+    case 76:
+    e32_75:
+        stack.push(89);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d89;
+    case 78:
+    e32_77:
+        stack.push(85);
+        goto e85_77;
+    case 79:
+    e32_78:
+        stack.push(85);
+        goto e85_78;
+    case 81:
+    e32_80:
+        stack.push(85);
+        goto e85_80;
+    default:
+        errorState = 32;
+        goto error;
+    }
+
+d33:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e33_54:
+        stack.push(92);
+        goto e92_54;
+    case 56:
+    e33_55:
+        stack.push(92);
+        goto e92_55;
+    case 59:
+    e33_58:
+        stack.push(92);
+        goto e92_58;
+    case 60:
+    e33_59:
+        stack.push(92);
+        goto e92_59;
+    case 64:
+    e33_63:
+        stack.push(93);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d93;
+    case 66:
+    e33_65:
+        stack.push(94);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d94;
+    case 71:
+    e33_70:
+        stack.push(92);
+        goto e92_70;
+    case 72:
+    e33_71:
+        stack.push(92);
+        goto e92_71;
+    case 73:
+    e33_72:
+        stack.push(92);
+        goto e92_72;
+    case 74:
+    e33_73:
+        stack.push(92);
+        goto e92_73;
+    case 75:
+    e33_74:
+        stack.push(92);
+        goto e92_74;
+    case 76:
+    e33_75:
+        stack.push(92);
+        goto e92_75;
+    case 78:
+    e33_77:
+        stack.push(92);
+        goto e92_77;
+    case 79:
+    e33_78:
+        stack.push(92);
+        goto e92_78;
+    case 81:
+    e33_80:
+        stack.push(92);
+        goto e92_80;
+    default:
+        errorState = 33;
+        goto error;
+    }
+
+d34:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e34_54:
+        stack.push(95);
+        goto e95_54;
+    case 56:
+    e34_55:
+        stack.push(95);
+        goto e95_55;
+    case 59:
+    e34_58:
+        stack.push(95);
+        goto e95_58;
+    case 60:
+    e34_59:
+        stack.push(95);
+        goto e95_59;
+    case 64:
+    e34_63:
+        stack.push(95);
+        goto e95_63;
+    case 66:
+    e34_65:
+        stack.push(95);
+        goto e95_65;
+    case 68:
+    e34_67:
+        stack.push(96);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d96;
+    case 69:
+    e34_68:
+        stack.push(97);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d97;
+    case 70:
+    e34_69:
+        stack.push(98);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d98;
+    case 71:
+    e34_70:
+        stack.push(95);
+        goto e95_70;
+    case 72:
+    e34_71:
+        stack.push(95);
+        goto e95_71;
+    case 73:
+    e34_72:
+        stack.push(95);
+        goto e95_72;
+    case 74:
+    e34_73:
+        stack.push(95);
+        goto e95_73;
+    case 75:
+    e34_74:
+        stack.push(95);
+        goto e95_74;
+    case 76:
+    e34_75:
+        stack.push(95);
+        goto e95_75;
+    case 78:
+    e34_77:
+        stack.push(95);
+        goto e95_77;
+    case 79:
+    e34_78:
+        stack.push(95);
+        goto e95_78;
+    case 81:
+    e34_80:
+        stack.push(95);
+        goto e95_80;
+    default:
+        errorState = 34;
+        goto error;
+    }
+
+d35:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e35_54:
+        stack.pop(1);
+        goto g137_54;
+    case 56:
+    e35_55:
+        stack.pop(1);
+        goto g137_55;
+    case 59:
+    e35_58:
+        stack.pop(1);
+        goto g137_58;
+    case 60:
+    e35_59:
+        stack.pop(1);
+        goto g137_59;
+    case 64:
+    e35_63:
+        stack.pop(1);
+        goto g137_63;
+    case 66:
+    e35_65:
+        stack.pop(1);
+        goto g137_65;
+    case 68:
+    e35_67:
+        stack.pop(1);
+        goto g137_67;
+    case 69:
+    e35_68:
+        stack.pop(1);
+        goto g137_68;
+    case 70:
+    e35_69:
+        stack.pop(1);
+        goto g137_69;
+    case 71:
+    e35_70:
+        stack.pop(1);
+        goto g137_70;
+    case 72:
+    e35_71:
+        stack.pop(1);
+        goto g137_71;
+    case 73:
+    e35_72:
+        stack.pop(1);
+        goto g137_72;
+    case 74:
+    e35_73:
+        stack.pop(1);
+        goto g137_73;
+    case 75:
+    e35_74:
+        stack.pop(1);
+        goto g137_74;
+    case 76:
+    e35_75:
+        stack.pop(1);
+        goto g137_75;
+    case 78:
+    e35_77:
+        stack.pop(1);
+        goto g137_77;
+    case 79:
+    e35_78:
+        stack.pop(1);
+        goto g137_78;
+    case 81:
+    e35_80:
+        stack.pop(1);
+        goto g137_80;
+    default:
+        errorState = 35;
+        goto error;
+    }
+
+d36:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 36;
+        goto error;
+    }
+
+d37:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 37;
+        goto error;
+    }
+
+d38:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 38;
+        goto error;
+    }
+
+d39:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e39_54:
+        stack.pop(1);
+        goto g138_54;
+    case 56:
+    e39_55:
+        stack.pop(1);
+        goto g138_55;
+    case 59:
+    e39_58:
+        stack.pop(1);
+        goto g138_58;
+    case 60:
+    e39_59:
+        stack.pop(1);
+        goto g138_59;
+    case 64:
+    e39_63:
+        stack.pop(1);
+        goto g138_63;
+    case 65:
+    e39_64:
+        stack.push(102);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d102;
+    case 66:
+    e39_65:
+        stack.pop(1);
+        goto g138_65;
+    case 67:
+    e39_66:
+        stack.push(103);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d103;
+    case 68:
+    e39_67:
+        stack.pop(1);
+        goto g138_67;
+    case 69:
+    e39_68:
+        stack.pop(1);
+        goto g138_68;
+    case 70:
+    e39_69:
+        stack.pop(1);
+        goto g138_69;
+    case 71:
+    e39_70:
+        stack.pop(1);
+        goto g138_70;
+    case 72:
+    e39_71:
+        stack.pop(1);
+        goto g138_71;
+    case 73:
+    e39_72:
+        stack.pop(1);
+        goto g138_72;
+    case 74:
+    e39_73:
+        stack.pop(1);
+        goto g138_73;
+    case 75:
+    e39_74:
+        stack.pop(1);
+        goto g138_74;
+    case 76:
+    e39_75:
+        stack.pop(1);
+        goto g138_75;
+    case 78:
+    e39_77:
+        stack.pop(1);
+        goto g138_77;
+    case 79:
+    e39_78:
+        stack.pop(1);
+        goto g138_78;
+    case 81:
+    e39_80:
+        stack.pop(1);
+        goto g138_80;
+    default:
+        errorState = 39;
+        goto error;
+    }
+
+d40:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e40_54:
+        stack.pop(1);
+        goto g138_54;
+    case 56:
+    e40_55:
+        stack.pop(1);
+        goto g138_55;
+    case 59:
+    e40_58:
+        stack.pop(1);
+        goto g138_58;
+    case 60:
+    e40_59:
+        stack.pop(1);
+        goto g138_59;
+    case 64:
+    e40_63:
+        stack.pop(1);
+        goto g138_63;
+    case 66:
+    e40_65:
+        stack.pop(1);
+        goto g138_65;
+    case 68:
+    e40_67:
+        stack.pop(1);
+        goto g138_67;
+    case 69:
+    e40_68:
+        stack.pop(1);
+        goto g138_68;
+    case 70:
+    e40_69:
+        stack.pop(1);
+        goto g138_69;
+    case 71:
+    e40_70:
+        stack.pop(1);
+        goto g138_70;
+    case 72:
+    e40_71:
+        stack.pop(1);
+        goto g138_71;
+    case 73:
+    e40_72:
+        stack.pop(1);
+        goto g138_72;
+    case 74:
+    e40_73:
+        stack.pop(1);
+        goto g138_73;
+    case 75:
+    e40_74:
+        stack.pop(1);
+        goto g138_74;
+    case 76:
+    e40_75:
+        stack.pop(1);
+        goto g138_75;
+    case 78:
+    e40_77:
+        stack.pop(1);
+        goto g138_77;
+    case 79:
+    e40_78:
+        stack.pop(1);
+        goto g138_78;
+    case 81:
+    e40_80:
+        stack.pop(1);
+        goto g138_80;
+    default:
+        errorState = 40;
+        goto error;
+    }
+
+d41:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(1);
+        goto g138_54;
+    case 56:
+        stack.pop(1);
+        goto g138_55;
+    case 59:
+        stack.pop(1);
+        goto g138_58;
+    case 60:
+        stack.pop(1);
+        goto g138_59;
+    case 64:
+        stack.pop(1);
+        goto g138_63;
+    case 66:
+        stack.pop(1);
+        goto g138_65;
+    case 68:
+        stack.pop(1);
+        goto g138_67;
+    case 69:
+        stack.pop(1);
+        goto g138_68;
+    case 70:
+        stack.pop(1);
+        goto g138_69;
+    case 71:
+        stack.pop(1);
+        goto g138_70;
+    case 72:
+        stack.pop(1);
+        goto g138_71;
+    case 73:
+        stack.pop(1);
+        goto g138_72;
+    case 74:
+        stack.pop(1);
+        goto g138_73;
+    case 75:
+        stack.pop(1);
+        goto g138_74;
+    case 76:
+        stack.pop(1);
+        goto g138_75;
+    case 78:
+        stack.pop(1);
+        goto g138_77;
+    case 79:
+        stack.pop(1);
+        goto g138_78;
+    case 81:
+        stack.pop(1);
+        goto g138_80;
+    default:
+        errorState = 41;
+        goto error;
+    }
+
+d42:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(1);
+        goto g138_54;
+    case 56:
+        stack.pop(1);
+        goto g138_55;
+    case 59:
+        stack.pop(1);
+        goto g138_58;
+    case 60:
+        stack.pop(1);
+        goto g138_59;
+    case 64:
+        stack.pop(1);
+        goto g138_63;
+    case 66:
+        stack.pop(1);
+        goto g138_65;
+    case 68:
+        stack.pop(1);
+        goto g138_67;
+    case 69:
+        stack.pop(1);
+        goto g138_68;
+    case 70:
+        stack.pop(1);
+        goto g138_69;
+    case 71:
+        stack.pop(1);
+        goto g138_70;
+    case 72:
+        stack.pop(1);
+        goto g138_71;
+    case 73:
+        stack.pop(1);
+        goto g138_72;
+    case 74:
+        stack.pop(1);
+        goto g138_73;
+    case 75:
+        stack.pop(1);
+        goto g138_74;
+    case 76:
+        stack.pop(1);
+        goto g138_75;
+    case 78:
+        stack.pop(1);
+        goto g138_77;
+    case 79:
+        stack.pop(1);
+        goto g138_78;
+    case 81:
+        stack.pop(1);
+        goto g138_80;
+    default:
+        errorState = 42;
+        goto error;
+    }
+
+d43:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(1);
+        goto g138_54;
+    case 56:
+        stack.pop(1);
+        goto g138_55;
+    case 59:
+        stack.pop(1);
+        goto g138_58;
+    case 60:
+        stack.pop(1);
+        goto g138_59;
+    case 64:
+        stack.pop(1);
+        goto g138_63;
+    case 66:
+        stack.pop(1);
+        goto g138_65;
+    case 68:
+        stack.pop(1);
+        goto g138_67;
+    case 69:
+        stack.pop(1);
+        goto g138_68;
+    case 70:
+        stack.pop(1);
+        goto g138_69;
+    case 71:
+        stack.pop(1);
+        goto g138_70;
+    case 72:
+        stack.pop(1);
+        goto g138_71;
+    case 73:
+        stack.pop(1);
+        goto g138_72;
+    case 74:
+        stack.pop(1);
+        goto g138_73;
+    case 75:
+        stack.pop(1);
+        goto g138_74;
+    case 76:
+        stack.pop(1);
+        goto g138_75;
+    case 78:
+        stack.pop(1);
+        goto g138_77;
+    case 79:
+        stack.pop(1);
+        goto g138_78;
+    case 81:
+        stack.pop(1);
+        goto g138_80;
+    default:
+        errorState = 43;
+        goto error;
+    }
+
+d44:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(1);
+        goto g138_54;
+    case 56:
+        stack.pop(1);
+        goto g138_55;
+    case 59:
+        stack.pop(1);
+        goto g138_58;
+    case 60:
+        stack.pop(1);
+        goto g138_59;
+    case 64:
+        stack.pop(1);
+        goto g138_63;
+    case 66:
+        stack.pop(1);
+        goto g138_65;
+    case 68:
+        stack.pop(1);
+        goto g138_67;
+    case 69:
+        stack.pop(1);
+        goto g138_68;
+    case 70:
+        stack.pop(1);
+        goto g138_69;
+    case 71:
+        stack.pop(1);
+        goto g138_70;
+    case 72:
+        stack.pop(1);
+        goto g138_71;
+    case 73:
+        stack.pop(1);
+        goto g138_72;
+    case 74:
+        stack.pop(1);
+        goto g138_73;
+    case 75:
+        stack.pop(1);
+        goto g138_74;
+    case 76:
+        stack.pop(1);
+        goto g138_75;
+    case 78:
+        stack.pop(1);
+        goto g138_77;
+    case 79:
+        stack.pop(1);
+        goto g138_78;
+    case 81:
+        stack.pop(1);
+        goto g138_80;
+    default:
+        errorState = 44;
+        goto error;
+    }
+
+d45:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(1);
+        goto g138_54;
+    case 56:
+        stack.pop(1);
+        goto g138_55;
+    case 59:
+        stack.pop(1);
+        goto g138_58;
+    case 60:
+        stack.pop(1);
+        goto g138_59;
+    case 64:
+        stack.pop(1);
+        goto g138_63;
+    case 66:
+        stack.pop(1);
+        goto g138_65;
+    case 68:
+        stack.pop(1);
+        goto g138_67;
+    case 69:
+        stack.pop(1);
+        goto g138_68;
+    case 70:
+        stack.pop(1);
+        goto g138_69;
+    case 71:
+        stack.pop(1);
+        goto g138_70;
+    case 72:
+        stack.pop(1);
+        goto g138_71;
+    case 73:
+        stack.pop(1);
+        goto g138_72;
+    case 74:
+        stack.pop(1);
+        goto g138_73;
+    case 75:
+        stack.pop(1);
+        goto g138_74;
+    case 76:
+        stack.pop(1);
+        goto g138_75;
+    case 78:
+        stack.pop(1);
+        goto g138_77;
+    case 79:
+        stack.pop(1);
+        goto g138_78;
+    case 81:
+        stack.pop(1);
+        goto g138_80;
+    default:
+        errorState = 45;
+        goto error;
+    }
+
+d46:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(1);
+        goto g138_54;
+    case 56:
+        stack.pop(1);
+        goto g138_55;
+    case 59:
+        stack.pop(1);
+        goto g138_58;
+    case 60:
+        stack.pop(1);
+        goto g138_59;
+    case 64:
+        stack.pop(1);
+        goto g138_63;
+    case 66:
+        stack.pop(1);
+        goto g138_65;
+    case 68:
+        stack.pop(1);
+        goto g138_67;
+    case 69:
+        stack.pop(1);
+        goto g138_68;
+    case 70:
+        stack.pop(1);
+        goto g138_69;
+    case 71:
+        stack.pop(1);
+        goto g138_70;
+    case 72:
+        stack.pop(1);
+        goto g138_71;
+    case 73:
+        stack.pop(1);
+        goto g138_72;
+    case 74:
+        stack.pop(1);
+        goto g138_73;
+    case 75:
+        stack.pop(1);
+        goto g138_74;
+    case 76:
+        stack.pop(1);
+        goto g138_75;
+    case 78:
+        stack.pop(1);
+        goto g138_77;
+    case 79:
+        stack.pop(1);
+        goto g138_78;
+    case 81:
+        stack.pop(1);
+        goto g138_80;
+    default:
+        errorState = 46;
+        goto error;
+    }
+
+d47:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(1);
+        goto g138_54;
+    case 56:
+        stack.pop(1);
+        goto g138_55;
+    case 59:
+        stack.pop(1);
+        goto g138_58;
+    case 60:
+        stack.pop(1);
+        goto g138_59;
+    case 64:
+        stack.pop(1);
+        goto g138_63;
+    case 66:
+        stack.pop(1);
+        goto g138_65;
+    case 68:
+        stack.pop(1);
+        goto g138_67;
+    case 69:
+        stack.pop(1);
+        goto g138_68;
+    case 70:
+        stack.pop(1);
+        goto g138_69;
+    case 71:
+        stack.pop(1);
+        goto g138_70;
+    case 72:
+        stack.pop(1);
+        goto g138_71;
+    case 73:
+        stack.pop(1);
+        goto g138_72;
+    case 74:
+        stack.pop(1);
+        goto g138_73;
+    case 75:
+        stack.pop(1);
+        goto g138_74;
+    case 76:
+        stack.pop(1);
+        goto g138_75;
+    case 78:
+        stack.pop(1);
+        goto g138_77;
+    case 79:
+        stack.pop(1);
+        goto g138_78;
+    case 81:
+        stack.pop(1);
+        goto g138_80;
+    default:
+        errorState = 47;
+        goto error;
+    }
+
+d48:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(1);
+        goto g138_54;
+    case 56:
+        stack.pop(1);
+        goto g138_55;
+    case 59:
+        stack.pop(1);
+        goto g138_58;
+    case 60:
+        stack.pop(1);
+        goto g138_59;
+    case 64:
+        stack.pop(1);
+        goto g138_63;
+    case 66:
+        stack.pop(1);
+        goto g138_65;
+    case 68:
+        stack.pop(1);
+        goto g138_67;
+    case 69:
+        stack.pop(1);
+        goto g138_68;
+    case 70:
+        stack.pop(1);
+        goto g138_69;
+    case 71:
+        stack.pop(1);
+        goto g138_70;
+    case 72:
+        stack.pop(1);
+        goto g138_71;
+    case 73:
+        stack.pop(1);
+        goto g138_72;
+    case 74:
+        stack.pop(1);
+        goto g138_73;
+    case 75:
+        stack.pop(1);
+        goto g138_74;
+    case 76:
+        stack.pop(1);
+        goto g138_75;
+    case 78:
+        stack.pop(1);
+        goto g138_77;
+    case 79:
+        stack.pop(1);
+        goto g138_78;
+    case 81:
+        stack.pop(1);
+        goto g138_80;
+    default:
+        errorState = 48;
+        goto error;
+    }
+
+d49:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 49;
+        goto error;
+    }
+
+d50:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(105);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d105;
+    default:
+        errorState = 50;
+        goto error;
+    }
+
+d51:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(107);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d107;
+    default:
+        errorState = 51;
+        goto error;
+    }
+
+d52:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e52_0:
+        stack.pop(2);
+        goto g95_0;
+    case 2:
+    e52_1:
+        stack.pop(2);
+        goto g95_1;
+    case 3:
+    e52_2:
+        stack.pop(2);
+        goto g95_2;
+    case 4:
+    e52_3:
+        stack.pop(2);
+        goto g95_3;
+    case 10:
+    e52_9:
+        stack.pop(2);
+        goto g95_9;
+    case 11:
+    e52_10:
+        stack.pop(2);
+        goto g95_10;
+    case 12:
+    e52_11:
+        stack.pop(2);
+        goto g95_11;
+    case 13:
+    e52_12:
+        stack.pop(2);
+        goto g95_12;
+    case 14:
+    e52_13:
+        stack.pop(2);
+        goto g95_13;
+    case 15:
+    e52_14:
+        stack.pop(2);
+        goto g95_14;
+    case 16:
+    e52_15:
+        stack.pop(2);
+        goto g95_15;
+    case 17:
+    e52_16:
+        stack.pop(2);
+        goto g95_16;
+    case 18:
+    e52_17:
+        stack.pop(2);
+        goto g95_17;
+    case 19:
+    e52_18:
+        stack.pop(2);
+        goto g95_18;
+    case 22:
+    e52_21:
+        stack.pop(2);
+        goto g95_21;
+    case 30:
+    e52_29:
+        stack.pop(2);
+        goto g95_29;
+    case 52:
+    e52_51:
+        stack.pop(2);
+        goto g95_51;
+    case 53:
+    e52_52:
+        stack.pop(2);
+        goto g95_52;
+    case 61:
+    e52_60:
+        stack.pop(2);
+        goto g95_60;
+    case 62:
+    e52_61:
+        stack.pop(2);
+        goto g95_61;
+    case 64:
+    e52_63:
+        stack.pop(2);
+        goto g95_63;
+    case 65:
+    e52_64:
+        stack.pop(2);
+        goto g95_64;
+    case 66:
+    e52_65:
+        stack.pop(2);
+        goto g95_65;
+    case 67:
+    e52_66:
+        stack.pop(2);
+        goto g95_66;
+    case 80:
+    e52_79:
+        stack.pop(2);
+        goto g95_79;
+    case 87:
+    e52_86:
+        stack.pop(2);
+        goto g95_86;
+    case 88:
+    e52_87:
+        stack.pop(2);
+        goto g95_87;
+    case 89:
+    e52_88:
+        stack.pop(2);
+        goto g95_88;
+    case 90:
+    e52_89:
+        stack.pop(2);
+        goto g95_89;
+    case 91:
+    e52_90:
+        stack.pop(2);
+        goto g95_90;
+    case 92:
+    e52_91:
+        stack.pop(2);
+        goto g95_91;
+    case 93:
+    e52_92:
+        stack.pop(2);
+        goto g95_92;
+    default:
+        errorState = 52;
+        goto error;
+    }
+
+d53:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e53_0:
+        stack.pop(2);
+        goto g96_0;
+    case 2:
+    e53_1:
+        stack.pop(2);
+        goto g96_1;
+    case 3:
+    e53_2:
+        stack.pop(2);
+        goto g96_2;
+    case 4:
+    e53_3:
+        stack.pop(2);
+        goto g96_3;
+    case 10:
+    e53_9:
+        stack.pop(2);
+        goto g96_9;
+    case 11:
+    e53_10:
+        stack.pop(2);
+        goto g96_10;
+    case 12:
+    e53_11:
+        stack.pop(2);
+        goto g96_11;
+    case 13:
+    e53_12:
+        stack.pop(2);
+        goto g96_12;
+    case 14:
+    e53_13:
+        stack.pop(2);
+        goto g96_13;
+    case 15:
+    e53_14:
+        stack.pop(2);
+        goto g96_14;
+    case 16:
+    e53_15:
+        stack.pop(2);
+        goto g96_15;
+    case 17:
+    e53_16:
+        stack.pop(2);
+        goto g96_16;
+    case 18:
+    e53_17:
+        stack.pop(2);
+        goto g96_17;
+    case 19:
+    e53_18:
+        stack.pop(2);
+        goto g96_18;
+    case 22:
+    e53_21:
+        stack.pop(2);
+        goto g96_21;
+    case 30:
+    e53_29:
+        stack.pop(2);
+        goto g96_29;
+    case 52:
+    e53_51:
+        stack.pop(2);
+        goto g96_51;
+    case 53:
+    e53_52:
+        stack.pop(2);
+        goto g96_52;
+    case 61:
+    e53_60:
+        stack.pop(2);
+        goto g96_60;
+    case 62:
+    e53_61:
+        stack.pop(2);
+        goto g96_61;
+    case 64:
+    e53_63:
+        stack.pop(2);
+        goto g96_63;
+    case 65:
+    e53_64:
+        stack.pop(2);
+        goto g96_64;
+    case 66:
+    e53_65:
+        stack.pop(2);
+        goto g96_65;
+    case 67:
+    e53_66:
+        stack.pop(2);
+        goto g96_66;
+    case 80:
+    e53_79:
+        stack.pop(2);
+        goto g96_79;
+    case 87:
+    e53_86:
+        stack.pop(2);
+        goto g96_86;
+    case 88:
+    e53_87:
+        stack.pop(2);
+        goto g96_87;
+    case 89:
+    e53_88:
+        stack.pop(2);
+        goto g96_88;
+    case 90:
+    e53_89:
+        stack.pop(2);
+        goto g96_89;
+    case 91:
+    e53_90:
+        stack.pop(2);
+        goto g96_90;
+    case 92:
+    e53_91:
+        stack.pop(2);
+        goto g96_91;
+    case 93:
+    e53_92:
+        stack.pop(2);
+        goto g96_92;
+    default:
+        errorState = 53;
+        goto error;
+    }
+
+d54:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e54_92:
+        stack.push(109);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d109;
+    default:
+        errorState = 54;
+        goto error;
+    }
+
+d55:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e55_92:
+        stack.push(110);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d110;
+    default:
+        errorState = 55;
+        goto error;
+    }
+
+d56:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.pop(2);
+        goto g98_0;
+    case 2:
+        stack.pop(2);
+        goto g98_1;
+    case 3:
+        stack.pop(2);
+        goto g98_2;
+    case 4:
+        stack.pop(2);
+        goto g98_3;
+    case 10:
+        stack.pop(2);
+        goto g98_9;
+    case 11:
+        stack.pop(2);
+        goto g98_10;
+    case 12:
+        stack.pop(2);
+        goto g98_11;
+    case 13:
+        stack.pop(2);
+        goto g98_12;
+    case 14:
+        stack.pop(2);
+        goto g98_13;
+    case 15:
+        stack.pop(2);
+        goto g98_14;
+    case 16:
+        stack.pop(2);
+        goto g98_15;
+    case 17:
+        stack.pop(2);
+        goto g98_16;
+    case 18:
+        stack.pop(2);
+        goto g98_17;
+    case 19:
+        stack.pop(2);
+        goto g98_18;
+    case 22:
+        stack.pop(2);
+        goto g98_21;
+    case 30:
+        stack.pop(2);
+        goto g98_29;
+    case 52:
+        stack.pop(2);
+        goto g98_51;
+    case 53:
+        stack.pop(2);
+        goto g98_52;
+    case 61:
+        stack.pop(2);
+        goto g98_60;
+    case 62:
+        stack.pop(2);
+        goto g98_61;
+    case 64:
+        stack.pop(2);
+        goto g98_63;
+    case 65:
+        stack.pop(2);
+        goto g98_64;
+    case 66:
+        stack.pop(2);
+        goto g98_65;
+    case 67:
+        stack.pop(2);
+        goto g98_66;
+    case 80:
+        stack.pop(2);
+        goto g98_79;
+    case 87:
+        stack.pop(2);
+        goto g98_86;
+    case 88:
+        stack.pop(2);
+        goto g98_87;
+    case 89:
+        stack.pop(2);
+        goto g98_88;
+    case 90:
+        stack.pop(2);
+        goto g98_89;
+    case 91:
+        stack.pop(2);
+        goto g98_90;
+    case 92:
+        stack.pop(2);
+        goto g98_91;
+    case 93:
+        stack.pop(2);
+        goto g98_92;
+    default:
+        errorState = 56;
+        goto error;
+    }
+
+d57:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.pop(2);
+        goto g98_0;
+    case 2:
+        stack.pop(2);
+        goto g98_1;
+    case 3:
+        stack.pop(2);
+        goto g98_2;
+    case 4:
+        stack.pop(2);
+        goto g98_3;
+    case 10:
+        stack.pop(2);
+        goto g98_9;
+    case 11:
+        stack.pop(2);
+        goto g98_10;
+    case 12:
+        stack.pop(2);
+        goto g98_11;
+    case 13:
+        stack.pop(2);
+        goto g98_12;
+    case 14:
+        stack.pop(2);
+        goto g98_13;
+    case 15:
+        stack.pop(2);
+        goto g98_14;
+    case 16:
+        stack.pop(2);
+        goto g98_15;
+    case 17:
+        stack.pop(2);
+        goto g98_16;
+    case 18:
+        stack.pop(2);
+        goto g98_17;
+    case 19:
+        stack.pop(2);
+        goto g98_18;
+    case 22:
+        stack.pop(2);
+        goto g98_21;
+    case 30:
+        stack.pop(2);
+        goto g98_29;
+    case 52:
+        stack.pop(2);
+        goto g98_51;
+    case 53:
+        stack.pop(2);
+        goto g98_52;
+    case 61:
+        stack.pop(2);
+        goto g98_60;
+    case 62:
+        stack.pop(2);
+        goto g98_61;
+    case 64:
+        stack.pop(2);
+        goto g98_63;
+    case 65:
+        stack.pop(2);
+        goto g98_64;
+    case 66:
+        stack.pop(2);
+        goto g98_65;
+    case 67:
+        stack.pop(2);
+        goto g98_66;
+    case 80:
+        stack.pop(2);
+        goto g98_79;
+    case 87:
+        stack.pop(2);
+        goto g98_86;
+    case 88:
+        stack.pop(2);
+        goto g98_87;
+    case 89:
+        stack.pop(2);
+        goto g98_88;
+    case 90:
+        stack.pop(2);
+        goto g98_89;
+    case 91:
+        stack.pop(2);
+        goto g98_90;
+    case 92:
+        stack.pop(2);
+        goto g98_91;
+    case 93:
+        stack.pop(2);
+        goto g98_92;
+    default:
+        errorState = 57;
+        goto error;
+    }
+
+d58:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e58_92:
+        stack.pop(2);
+        goto g106_92;
+    default:
+        errorState = 58;
+        goto error;
+    }
+
+d59:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e59_92:
+        stack.pop(2);
+        goto g106_92;
+    default:
+        errorState = 59;
+        goto error;
+    }
+
+d60:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e60_92:
+        stack.pop(2);
+        goto g106_92;
+    default:
+        errorState = 60;
+        goto error;
+    }
+
+d61:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e61_92:
+        stack.pop(2);
+        goto g106_92;
+    default:
+        errorState = 61;
+        goto error;
+    }
+
+d62:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e62_92:
+        stack.pop(2);
+        goto g106_92;
+    default:
+        errorState = 62;
+        goto error;
+    }
+
+d63:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e63_92:
+        stack.pop(2);
+        goto g106_92;
+    default:
+        errorState = 63;
+        goto error;
+    }
+
+d64:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e64_92:
+        stack.pop(2);
+        goto g106_92;
+    default:
+        errorState = 64;
+        goto error;
+    }
+
+d65:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 65;
+        goto error;
+    }
+
+d66:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 66;
+        goto error;
+    }
+
+d67:
+    switch (currentToken.getId())
+    {
+    case 2:
+        stack.push(14);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d14;
+    case 3:
+        stack.push(15);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d15;
+    case 10:
+        stack.push(18);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d18;
+    case 11:
+        stack.push(16);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d16;
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 14:
+        stack.push(17);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d17;
+    case 17:
+        stack.push(20);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d20;
+    case 18:
+        stack.push(19);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d19;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(119);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d119;
+    default:
+        errorState = 67;
+        goto error;
+    }
+
+d68:
+    switch (currentToken.getId())
+    {
+    case 15:
+    e68_14:
+        stack.push(120);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d120;
+    default:
+        errorState = 68;
+        goto error;
+    }
+
+d69:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.pop(2);
+        goto g124_0;
+    case 2:
+        stack.pop(2);
+        goto g124_1;
+    case 3:
+        stack.pop(2);
+        goto g124_2;
+    case 4:
+        stack.pop(2);
+        goto g124_3;
+    case 10:
+        stack.pop(2);
+        goto g124_9;
+    case 11:
+        stack.pop(2);
+        goto g124_10;
+    case 12:
+        stack.pop(2);
+        goto g124_11;
+    case 13:
+        stack.pop(2);
+        goto g124_12;
+    case 14:
+        stack.pop(2);
+        goto g124_13;
+    case 15:
+        stack.pop(2);
+        goto g124_14;
+    case 16:
+        stack.pop(2);
+        goto g124_15;
+    case 17:
+        stack.pop(2);
+        goto g124_16;
+    case 18:
+        stack.pop(2);
+        goto g124_17;
+    case 19:
+        stack.pop(2);
+        goto g124_18;
+    case 22:
+        stack.pop(2);
+        goto g124_21;
+    case 30:
+        stack.pop(2);
+        goto g124_29;
+    case 52:
+        stack.pop(2);
+        goto g124_51;
+    case 53:
+        stack.pop(2);
+        goto g124_52;
+    case 61:
+        stack.pop(2);
+        goto g124_60;
+    case 62:
+        stack.pop(2);
+        goto g124_61;
+    case 63:
+        stack.pop(2);
+        goto g124_62;
+    case 64:
+        stack.pop(2);
+        goto g124_63;
+    case 65:
+        stack.pop(2);
+        goto g124_64;
+    case 66:
+        stack.pop(2);
+        goto g124_65;
+    case 67:
+        stack.pop(2);
+        goto g124_66;
+    case 80:
+        stack.pop(2);
+        goto g124_79;
+    case 87:
+        stack.pop(2);
+        goto g124_86;
+    case 88:
+        stack.pop(2);
+        goto g124_87;
+    case 89:
+        stack.pop(2);
+        goto g124_88;
+    case 90:
+        stack.pop(2);
+        goto g124_89;
+    case 91:
+        stack.pop(2);
+        goto g124_90;
+    case 92:
+        stack.pop(2);
+        goto g124_91;
+    case 93:
+        stack.pop(2);
+        goto g124_92;
+    default:
+        errorState = 69;
+        goto error;
+    }
+
+d70:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e70_54:
+        stack.push(121);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d121;
+    default:
+        errorState = 70;
+        goto error;
+    }
+
+d71:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_54;
+    case 56:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_55;
+    case 58:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_57;
+    case 59:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_58;
+    case 60:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_59;
+    case 61:
+        stack.push(78);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d78;
+    case 64:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_63;
+    case 65:
+        stack.push(80);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d80;
+    case 66:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_65;
+    case 67:
+        stack.push(81);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d81;
+    case 68:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_67;
+    case 69:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_68;
+    case 70:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_69;
+    case 71:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_70;
+    case 72:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_71;
+    case 73:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_72;
+    case 74:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_73;
+    case 75:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_74;
+    case 76:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_75;
+    case 77:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 79;
+        goto error;
+    case 78:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_77;
+    case 79:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_78;
+    case 81:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_80;
+    case 82:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 79;
+        goto error;
+    default:
+        errorState = 71;
+        goto error;
+    }
+
+d72:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e72_54:
+        stack.pop(1);
+        goto g138_54;
+    case 56:
+    e72_55:
+        stack.pop(1);
+        goto g138_55;
+    case 59:
+    e72_58:
+        stack.pop(1);
+        goto g138_58;
+    case 60:
+    e72_59:
+        stack.pop(1);
+        goto g138_59;
+    case 64:
+    e72_63:
+        stack.pop(1);
+        goto g138_63;
+    case 66:
+    e72_65:
+        stack.pop(1);
+        goto g138_65;
+    case 68:
+    e72_67:
+        stack.pop(1);
+        goto g138_67;
+    case 69:
+    e72_68:
+        stack.pop(1);
+        goto g138_68;
+    case 70:
+    e72_69:
+        stack.pop(1);
+        goto g138_69;
+    case 71:
+    e72_70:
+        stack.pop(1);
+        goto g138_70;
+    case 72:
+    e72_71:
+        stack.pop(1);
+        goto g138_71;
+    case 73:
+    e72_72:
+        stack.pop(1);
+        goto g138_72;
+    case 74:
+    e72_73:
+        stack.pop(1);
+        goto g138_73;
+    case 75:
+    e72_74:
+        stack.pop(1);
+        goto g138_74;
+    case 76:
+    e72_75:
+        stack.pop(1);
+        goto g138_75;
+    case 78:
+    e72_77:
+        stack.pop(1);
+        goto g138_77;
+    case 79:
+    e72_78:
+        stack.pop(1);
+        goto g138_78;
+    case 81:
+    e72_80:
+        stack.pop(1);
+        goto g138_80;
+    default:
+        errorState = 72;
+        goto error;
+    }
+
+d73:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e73_54:
+        stack.push(122);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d122;
+    default:
+        errorState = 73;
+        goto error;
+    }
+
+d74:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(124);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d124;
+    default:
+        errorState = 74;
+        goto error;
+    }
+
+d75:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e75_54:
+        stack.push(125);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d125;
+    default:
+        errorState = 75;
+        goto error;
+    }
+
+d76:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 76;
+        goto error;
+    }
+
+d77:
+    switch (currentToken.getId())
+    {
+    case 2:
+    e77_1:
+        stack.push(14);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d14;
+    case 3:
+    e77_2:
+        stack.push(15);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d15;
+    case 4:
+    e77_3:
+        stack.push(21);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d21;
+    case 10:
+    e77_9:
+        stack.push(18);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d18;
+    case 11:
+    e77_10:
+        stack.push(16);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d16;
+    case 12:
+    e77_11:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+    e77_12:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 14:
+    e77_13:
+        stack.push(17);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d17;
+    case 15:
+    e77_14:
+        stack.push(22);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d22;
+    case 16:
+    e77_15:
+        stack.push(24);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d24;
+    case 17:
+    e77_16:
+        stack.push(20);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d20;
+    case 18:
+    e77_17:
+        stack.push(19);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d19;
+    case 19:
+    e77_18:
+        stack.push(23);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d23;
+    case 22:
+    e77_21:
+        stack.push(25);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d25;
+    case 52:
+    e77_51:
+        stack.push(26);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d26;
+    case 53:
+    e77_52:
+        stack.push(27);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d27;
+    case 61:
+    e77_60:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 62:
+    e77_61:
+        stack.push(28);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d28;
+    case 64:
+    e77_63:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+    e77_64:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+    e77_65:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+    e77_66:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+    e77_79:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+    e77_86:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+    e77_87:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+    e77_88:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+    e77_89:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+    e77_90:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+    e77_91:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+    e77_92:
+        stack.push(139);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d139;
+    default:
+        errorState = 77;
+        goto error;
+    }
+
+d78:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 60:
+        stack.push(141);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d141;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(144);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d144;
+    default:
+        errorState = 78;
+        goto error;
+    }
+
+d79:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e79_54:
+        stack.pop(2);
+        goto g138_54;
+    case 56:
+    e79_55:
+        stack.pop(2);
+        goto g138_55;
+    case 58:
+    e79_57:
+        stack.push(145);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d145;
+    case 59:
+    e79_58:
+        stack.pop(2);
+        goto g138_58;
+    case 60:
+    e79_59:
+        stack.pop(2);
+        goto g138_59;
+    case 64:
+    e79_63:
+        stack.pop(2);
+        goto g138_63;
+    case 66:
+    e79_65:
+        stack.pop(2);
+        goto g138_65;
+    case 68:
+    e79_67:
+        stack.pop(2);
+        goto g138_67;
+    case 69:
+    e79_68:
+        stack.pop(2);
+        goto g138_68;
+    case 70:
+    e79_69:
+        stack.pop(2);
+        goto g138_69;
+    case 71:
+    e79_70:
+        stack.pop(2);
+        goto g138_70;
+    case 72:
+    e79_71:
+        stack.pop(2);
+        goto g138_71;
+    case 73:
+    e79_72:
+        stack.pop(2);
+        goto g138_72;
+    case 74:
+    e79_73:
+        stack.pop(2);
+        goto g138_73;
+    case 75:
+    e79_74:
+        stack.pop(2);
+        goto g138_74;
+    case 76:
+    e79_75:
+        stack.pop(2);
+        goto g138_75;
+    case 78:
+    e79_77:
+        stack.pop(2);
+        goto g138_77;
+    case 79:
+    e79_78:
+        stack.pop(2);
+        goto g138_78;
+    case 81:
+    e79_80:
+        stack.pop(2);
+        goto g138_80;
+    default:
+        errorState = 79;
+        goto error;
+    }
+
+d80:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_54;
+    case 56:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_55;
+    case 58:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 146;
+        goto error;
+    case 59:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_58;
+    case 60:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_59;
+    case 64:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_63;
+    case 66:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_65;
+    case 68:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_67;
+    case 69:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_68;
+    case 70:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_69;
+    case 71:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_70;
+    case 72:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_71;
+    case 73:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_72;
+    case 74:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_73;
+    case 75:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_74;
+    case 76:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_75;
+    case 77:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 146;
+        goto error;
+    case 78:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_77;
+    case 79:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_78;
+    case 81:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e146_80;
+    case 82:
+        stack.push(146);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 146;
+        goto error;
+    default:
+        errorState = 80;
+        goto error;
+    }
+
+d81:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_54;
+    case 56:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_55;
+    case 58:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 147;
+        goto error;
+    case 59:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_58;
+    case 60:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_59;
+    case 64:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_63;
+    case 66:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_65;
+    case 68:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_67;
+    case 69:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_68;
+    case 70:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_69;
+    case 71:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_70;
+    case 72:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_71;
+    case 73:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_72;
+    case 74:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_73;
+    case 75:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_74;
+    case 76:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_75;
+    case 77:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 147;
+        goto error;
+    case 78:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_77;
+    case 79:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_78;
+    case 81:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e147_80;
+    case 82:
+        stack.push(147);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 147;
+        goto error;
+    default:
+        errorState = 81;
+        goto error;
+    }
+
+d82:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e82_54:
+        stack.pop(2);
+        goto g128_54;
+    case 56:
+    e82_55:
+        stack.pop(2);
+        goto g128_55;
+    case 59:
+    e82_58:
+        stack.pop(2);
+        goto g128_58;
+    case 60:
+    e82_59:
+        stack.pop(2);
+        goto g128_59;
+    case 81:
+    e82_80:
+        stack.pop(2);
+        goto g128_80;
+    default:
+        errorState = 82;
+        goto error;
+    }
+
+d83:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 83;
+        goto error;
+    }
+
+d84:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 84;
+        goto error;
+    }
+
+d85:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e85_54:
+        stack.pop(2);
+        goto g131_54;
+    case 56:
+    e85_55:
+        stack.pop(2);
+        goto g131_55;
+    case 59:
+    e85_58:
+        stack.pop(2);
+        goto g131_58;
+    case 60:
+    e85_59:
+        stack.pop(2);
+        goto g131_59;
+    case 78:
+    e85_77:
+        stack.pop(2);
+        goto g131_77;
+    case 79:
+    e85_78:
+        stack.pop(2);
+        goto g131_78;
+    case 81:
+    e85_80:
+        stack.pop(2);
+        goto g131_80;
+    default:
+        errorState = 85;
+        goto error;
+    }
+
+d86:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 86;
+        goto error;
+    }
+
+d87:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 87;
+        goto error;
+    }
+
+d88:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 88;
+        goto error;
+    }
+
+d89:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 89;
+        goto error;
+    }
+
+d90:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 90;
+        goto error;
+    }
+
+d91:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 91;
+        goto error;
+    }
+
+d92:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e92_54:
+        stack.pop(2);
+        goto g133_54;
+    case 56:
+    e92_55:
+        stack.pop(2);
+        goto g133_55;
+    case 59:
+    e92_58:
+        stack.pop(2);
+        goto g133_58;
+    case 60:
+    e92_59:
+        stack.pop(2);
+        goto g133_59;
+    case 71:
+    e92_70:
+        stack.pop(2);
+        goto g133_70;
+    case 72:
+    e92_71:
+        stack.pop(2);
+        goto g133_71;
+    case 73:
+    e92_72:
+        stack.pop(2);
+        goto g133_72;
+    case 74:
+    e92_73:
+        stack.pop(2);
+        goto g133_73;
+    case 75:
+    e92_74:
+        stack.pop(2);
+        goto g133_74;
+    case 76:
+    e92_75:
+        stack.pop(2);
+        goto g133_75;
+    case 78:
+    e92_77:
+        stack.pop(2);
+        goto g133_77;
+    case 79:
+    e92_78:
+        stack.pop(2);
+        goto g133_78;
+    case 81:
+    e92_80:
+        stack.pop(2);
+        goto g133_80;
+    default:
+        errorState = 92;
+        goto error;
+    }
+
+d93:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 93;
+        goto error;
+    }
+
+d94:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 94;
+        goto error;
+    }
+
+d95:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e95_54:
+        stack.pop(2);
+        goto g135_54;
+    case 56:
+    e95_55:
+        stack.pop(2);
+        goto g135_55;
+    case 59:
+    e95_58:
+        stack.pop(2);
+        goto g135_58;
+    case 60:
+    e95_59:
+        stack.pop(2);
+        goto g135_59;
+    case 64:
+    e95_63:
+        stack.pop(2);
+        goto g135_63;
+    case 66:
+    e95_65:
+        stack.pop(2);
+        goto g135_65;
+    case 71:
+    e95_70:
+        stack.pop(2);
+        goto g135_70;
+    case 72:
+    e95_71:
+        stack.pop(2);
+        goto g135_71;
+    case 73:
+    e95_72:
+        stack.pop(2);
+        goto g135_72;
+    case 74:
+    e95_73:
+        stack.pop(2);
+        goto g135_73;
+    case 75:
+    e95_74:
+        stack.pop(2);
+        goto g135_74;
+    case 76:
+    e95_75:
+        stack.pop(2);
+        goto g135_75;
+    case 78:
+    e95_77:
+        stack.pop(2);
+        goto g135_77;
+    case 79:
+    e95_78:
+        stack.pop(2);
+        goto g135_78;
+    case 81:
+    e95_80:
+        stack.pop(2);
+        goto g135_80;
+    default:
+        errorState = 95;
+        goto error;
+    }
+
+d96:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 96;
+        goto error;
+    }
+
+d97:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 97;
+        goto error;
+    }
+
+d98:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 98;
+        goto error;
+    }
+
+d99:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e99_54:
+        stack.pop(2);
+        goto g137_54;
+    case 56:
+    e99_55:
+        stack.pop(2);
+        goto g137_55;
+    case 59:
+    e99_58:
+        stack.pop(2);
+        goto g137_58;
+    case 60:
+    e99_59:
+        stack.pop(2);
+        goto g137_59;
+    case 64:
+    e99_63:
+        stack.pop(2);
+        goto g137_63;
+    case 66:
+    e99_65:
+        stack.pop(2);
+        goto g137_65;
+    case 68:
+    e99_67:
+        stack.pop(2);
+        goto g137_67;
+    case 69:
+    e99_68:
+        stack.pop(2);
+        goto g137_68;
+    case 70:
+    e99_69:
+        stack.pop(2);
+        goto g137_69;
+    case 71:
+    e99_70:
+        stack.pop(2);
+        goto g137_70;
+    case 72:
+    e99_71:
+        stack.pop(2);
+        goto g137_71;
+    case 73:
+    e99_72:
+        stack.pop(2);
+        goto g137_72;
+    case 74:
+    e99_73:
+        stack.pop(2);
+        goto g137_73;
+    case 75:
+    e99_74:
+        stack.pop(2);
+        goto g137_74;
+    case 76:
+    e99_75:
+        stack.pop(2);
+        goto g137_75;
+    case 78:
+    e99_77:
+        stack.pop(2);
+        goto g137_77;
+    case 79:
+    e99_78:
+        stack.pop(2);
+        goto g137_78;
+    case 81:
+    e99_80:
+        stack.pop(2);
+        goto g137_80;
+    default:
+        errorState = 99;
+        goto error;
+    }
+
+d100:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e100_54:
+        stack.pop(2);
+        goto g137_54;
+    case 56:
+    e100_55:
+        stack.pop(2);
+        goto g137_55;
+    case 59:
+    e100_58:
+        stack.pop(2);
+        goto g137_58;
+    case 60:
+    e100_59:
+        stack.pop(2);
+        goto g137_59;
+    case 64:
+    e100_63:
+        stack.pop(2);
+        goto g137_63;
+    case 66:
+    e100_65:
+        stack.pop(2);
+        goto g137_65;
+    case 68:
+    e100_67:
+        stack.pop(2);
+        goto g137_67;
+    case 69:
+    e100_68:
+        stack.pop(2);
+        goto g137_68;
+    case 70:
+    e100_69:
+        stack.pop(2);
+        goto g137_69;
+    case 71:
+    e100_70:
+        stack.pop(2);
+        goto g137_70;
+    case 72:
+    e100_71:
+        stack.pop(2);
+        goto g137_71;
+    case 73:
+    e100_72:
+        stack.pop(2);
+        goto g137_72;
+    case 74:
+    e100_73:
+        stack.pop(2);
+        goto g137_73;
+    case 75:
+    e100_74:
+        stack.pop(2);
+        goto g137_74;
+    case 76:
+    e100_75:
+        stack.pop(2);
+        goto g137_75;
+    case 78:
+    e100_77:
+        stack.pop(2);
+        goto g137_77;
+    case 79:
+    e100_78:
+        stack.pop(2);
+        goto g137_78;
+    case 81:
+    e100_80:
+        stack.pop(2);
+        goto g137_80;
+    default:
+        errorState = 100;
+        goto error;
+    }
+
+d101:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e101_54:
+        stack.pop(2);
+        goto g137_54;
+    case 56:
+    e101_55:
+        stack.pop(2);
+        goto g137_55;
+    case 59:
+    e101_58:
+        stack.pop(2);
+        goto g137_58;
+    case 60:
+    e101_59:
+        stack.pop(2);
+        goto g137_59;
+    case 64:
+    e101_63:
+        stack.pop(2);
+        goto g137_63;
+    case 66:
+    e101_65:
+        stack.pop(2);
+        goto g137_65;
+    case 68:
+    e101_67:
+        stack.pop(2);
+        goto g137_67;
+    case 69:
+    e101_68:
+        stack.pop(2);
+        goto g137_68;
+    case 70:
+    e101_69:
+        stack.pop(2);
+        goto g137_69;
+    case 71:
+    e101_70:
+        stack.pop(2);
+        goto g137_70;
+    case 72:
+    e101_71:
+        stack.pop(2);
+        goto g137_71;
+    case 73:
+    e101_72:
+        stack.pop(2);
+        goto g137_72;
+    case 74:
+    e101_73:
+        stack.pop(2);
+        goto g137_73;
+    case 75:
+    e101_74:
+        stack.pop(2);
+        goto g137_74;
+    case 76:
+    e101_75:
+        stack.pop(2);
+        goto g137_75;
+    case 78:
+    e101_77:
+        stack.pop(2);
+        goto g137_77;
+    case 79:
+    e101_78:
+        stack.pop(2);
+        goto g137_78;
+    case 81:
+    e101_80:
+        stack.pop(2);
+        goto g137_80;
+    default:
+        errorState = 101;
+        goto error;
+    }
+
+d102:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(2);
+        goto g130_54;
+    case 56:
+        stack.pop(2);
+        goto g130_55;
+    case 59:
+        stack.pop(2);
+        goto g130_58;
+    case 60:
+        stack.pop(2);
+        goto g130_59;
+    case 64:
+        stack.pop(2);
+        goto g130_63;
+    case 66:
+        stack.pop(2);
+        goto g130_65;
+    case 68:
+        stack.pop(2);
+        goto g130_67;
+    case 69:
+        stack.pop(2);
+        goto g130_68;
+    case 70:
+        stack.pop(2);
+        goto g130_69;
+    case 71:
+        stack.pop(2);
+        goto g130_70;
+    case 72:
+        stack.pop(2);
+        goto g130_71;
+    case 73:
+        stack.pop(2);
+        goto g130_72;
+    case 74:
+        stack.pop(2);
+        goto g130_73;
+    case 75:
+        stack.pop(2);
+        goto g130_74;
+    case 76:
+        stack.pop(2);
+        goto g130_75;
+    case 78:
+        stack.pop(2);
+        goto g130_77;
+    case 79:
+        stack.pop(2);
+        goto g130_78;
+    case 81:
+        stack.pop(2);
+        goto g130_80;
+    default:
+        errorState = 102;
+        goto error;
+    }
+
+d103:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(2);
+        goto g130_54;
+    case 56:
+        stack.pop(2);
+        goto g130_55;
+    case 59:
+        stack.pop(2);
+        goto g130_58;
+    case 60:
+        stack.pop(2);
+        goto g130_59;
+    case 64:
+        stack.pop(2);
+        goto g130_63;
+    case 66:
+        stack.pop(2);
+        goto g130_65;
+    case 68:
+        stack.pop(2);
+        goto g130_67;
+    case 69:
+        stack.pop(2);
+        goto g130_68;
+    case 70:
+        stack.pop(2);
+        goto g130_69;
+    case 71:
+        stack.pop(2);
+        goto g130_70;
+    case 72:
+        stack.pop(2);
+        goto g130_71;
+    case 73:
+        stack.pop(2);
+        goto g130_72;
+    case 74:
+        stack.pop(2);
+        goto g130_73;
+    case 75:
+        stack.pop(2);
+        goto g130_74;
+    case 76:
+        stack.pop(2);
+        goto g130_75;
+    case 78:
+        stack.pop(2);
+        goto g130_77;
+    case 79:
+        stack.pop(2);
+        goto g130_78;
+    case 81:
+        stack.pop(2);
+        goto g130_80;
+    default:
+        errorState = 103;
+        goto error;
+    }
+
+d104:
+    switch (currentToken.getId())
+    {
+    case 60:
+    e104_59:
+        stack.push(161);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d161;
+    default:
+        errorState = 104;
+        goto error;
+    }
+
+d105:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_54;
+    case 56:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_55;
+    case 58:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_57;
+    case 59:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_58;
+    case 60:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_59;
+    case 64:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_63;
+    case 66:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_65;
+    case 68:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_67;
+    case 69:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_68;
+    case 70:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_69;
+    case 71:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_70;
+    case 72:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_71;
+    case 73:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_72;
+    case 74:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_73;
+    case 75:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_74;
+    case 76:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_75;
+    case 77:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 162;
+        goto error;
+    case 78:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_77;
+    case 79:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_78;
+    case 81:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e162_80;
+    case 82:
+        stack.push(162);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 162;
+        goto error;
+    default:
+        errorState = 105;
+        goto error;
+    }
+
+d106:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e106_54:
+        stack.pop(2);
+        goto g130_54;
+    case 56:
+    e106_55:
+        stack.pop(2);
+        goto g130_55;
+    case 59:
+    e106_58:
+        stack.pop(2);
+        goto g130_58;
+    case 60:
+    e106_59:
+        stack.pop(2);
+        goto g130_59;
+    case 64:
+    e106_63:
+        stack.pop(2);
+        goto g130_63;
+    case 66:
+    e106_65:
+        stack.pop(2);
+        goto g130_65;
+    case 68:
+    e106_67:
+        stack.pop(2);
+        goto g130_67;
+    case 69:
+    e106_68:
+        stack.pop(2);
+        goto g130_68;
+    case 70:
+    e106_69:
+        stack.pop(2);
+        goto g130_69;
+    case 71:
+    e106_70:
+        stack.pop(2);
+        goto g130_70;
+    case 72:
+    e106_71:
+        stack.pop(2);
+        goto g130_71;
+    case 73:
+    e106_72:
+        stack.pop(2);
+        goto g130_72;
+    case 74:
+    e106_73:
+        stack.pop(2);
+        goto g130_73;
+    case 75:
+    e106_74:
+        stack.pop(2);
+        goto g130_74;
+    case 76:
+    e106_75:
+        stack.pop(2);
+        goto g130_75;
+    case 78:
+    e106_77:
+        stack.pop(2);
+        goto g130_77;
+    case 79:
+    e106_78:
+        stack.pop(2);
+        goto g130_78;
+    case 81:
+    e106_80:
+        stack.pop(2);
+        goto g130_80;
+    default:
+        errorState = 106;
+        goto error;
+    }
+
+d107:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_54;
+    case 56:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_55;
+    case 58:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_57;
+    case 59:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_58;
+    case 60:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_59;
+    case 64:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_63;
+    case 66:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_65;
+    case 68:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_67;
+    case 69:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_68;
+    case 70:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_69;
+    case 71:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_70;
+    case 72:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_71;
+    case 73:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_72;
+    case 74:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_73;
+    case 75:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_74;
+    case 76:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_75;
+    case 77:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 163;
+        goto error;
+    case 78:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_77;
+    case 79:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_78;
+    case 81:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e163_80;
+    case 82:
+        stack.push(163);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 163;
+        goto error;
+    default:
+        errorState = 107;
+        goto error;
+    }
+
+d108:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e108_54:
+        stack.pop(2);
+        goto g130_54;
+    case 56:
+    e108_55:
+        stack.pop(2);
+        goto g130_55;
+    case 59:
+    e108_58:
+        stack.pop(2);
+        goto g130_58;
+    case 60:
+    e108_59:
+        stack.pop(2);
+        goto g130_59;
+    case 64:
+    e108_63:
+        stack.pop(2);
+        goto g130_63;
+    case 66:
+    e108_65:
+        stack.pop(2);
+        goto g130_65;
+    case 68:
+    e108_67:
+        stack.pop(2);
+        goto g130_67;
+    case 69:
+    e108_68:
+        stack.pop(2);
+        goto g130_68;
+    case 70:
+    e108_69:
+        stack.pop(2);
+        goto g130_69;
+    case 71:
+    e108_70:
+        stack.pop(2);
+        goto g130_70;
+    case 72:
+    e108_71:
+        stack.pop(2);
+        goto g130_71;
+    case 73:
+    e108_72:
+        stack.pop(2);
+        goto g130_72;
+    case 74:
+    e108_73:
+        stack.pop(2);
+        goto g130_73;
+    case 75:
+    e108_74:
+        stack.pop(2);
+        goto g130_74;
+    case 76:
+    e108_75:
+        stack.pop(2);
+        goto g130_75;
+    case 78:
+    e108_77:
+        stack.pop(2);
+        goto g130_77;
+    case 79:
+    e108_78:
+        stack.pop(2);
+        goto g130_78;
+    case 81:
+    e108_80:
+        stack.pop(2);
+        goto g130_80;
+    default:
+        errorState = 108;
+        goto error;
+    }
+
+d109:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(166);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d166;
+    case 56:
+        stack.push(167);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d167;
+    case 58:
+        stack.push(168);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d168;
+    case 61:
+        stack.push(165);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d165;
+    default:
+        errorState = 109;
+        goto error;
+    }
+
+d110:
+    switch (currentToken.getId())
+    {
+    case 61:
+        stack.push(169);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d169;
+    default:
+        errorState = 110;
+        goto error;
+    }
+
+d111:
+    switch (currentToken.getId())
+    {
+    case 60:
+    e111_59:
+        stack.push(170);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d170;
+    default:
+        errorState = 111;
+        goto error;
+    }
+
+d112:
+    switch (currentToken.getId())
+    {
+    case 60:
+    e112_59:
+        stack.push(171);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d171;
+    default:
+        errorState = 112;
+        goto error;
+    }
+
+d113:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e113_54:
+        stack.push(172);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d172;
+    default:
+        errorState = 113;
+        goto error;
+    }
+
+d114:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e114_54:
+        stack.pop(1);
+        goto g119_54;
+    default:
+        errorState = 114;
+        goto error;
+    }
+
+d115:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e115_54:
+        stack.pop(1);
+        goto g119_54;
+    default:
+        errorState = 115;
+        goto error;
+    }
+
+d116:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e116_54:
+        stack.pop(1);
+        goto g119_54;
+    default:
+        errorState = 116;
+        goto error;
+    }
+
+d117:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e117_92:
+        stack.push(173);
+        semanticAnalyser->executeAction(1, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e173_92;
+    default:
+        errorState = 117;
+        goto error;
+    }
+
+d118:
+    switch (currentToken.getId())
+    {
+    case 77:
+    e118_76:
+        stack.push(174);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d174;
+    default:
+        errorState = 118;
+        goto error;
+    }
+
+d119:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_54;
+    case 56:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_55;
+    case 58:
+        stack.push(176);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d176;
+    case 59:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_58;
+    case 60:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_59;
+    case 61:
+        stack.push(78);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d78;
+    case 64:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_63;
+    case 65:
+        stack.push(80);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d80;
+    case 66:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_65;
+    case 67:
+        stack.push(81);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d81;
+    case 68:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_67;
+    case 69:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_68;
+    case 70:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_69;
+    case 71:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_70;
+    case 72:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_71;
+    case 73:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_72;
+    case 74:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_73;
+    case 75:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_74;
+    case 76:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_75;
+    case 77:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_76;
+    case 78:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_77;
+    case 79:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_78;
+    case 81:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_80;
+    case 82:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_81;
+    default:
+        errorState = 119;
+        goto error;
+    }
+
+d120:
+    switch (currentToken.getId())
+    {
+    case 61:
+        stack.push(177);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d177;
+    default:
+        errorState = 120;
+        goto error;
+    }
+
+d121:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.pop(3);
+        goto g124_0;
+    case 2:
+        stack.pop(3);
+        goto g124_1;
+    case 3:
+        stack.pop(3);
+        goto g124_2;
+    case 4:
+        stack.pop(3);
+        goto g124_3;
+    case 10:
+        stack.pop(3);
+        goto g124_9;
+    case 11:
+        stack.pop(3);
+        goto g124_10;
+    case 12:
+        stack.pop(3);
+        goto g124_11;
+    case 13:
+        stack.pop(3);
+        goto g124_12;
+    case 14:
+        stack.pop(3);
+        goto g124_13;
+    case 15:
+        stack.pop(3);
+        goto g124_14;
+    case 16:
+        stack.pop(3);
+        goto g124_15;
+    case 17:
+        stack.pop(3);
+        goto g124_16;
+    case 18:
+        stack.pop(3);
+        goto g124_17;
+    case 19:
+        stack.pop(3);
+        goto g124_18;
+    case 22:
+        stack.pop(3);
+        goto g124_21;
+    case 30:
+        stack.pop(3);
+        goto g124_29;
+    case 52:
+        stack.pop(3);
+        goto g124_51;
+    case 53:
+        stack.pop(3);
+        goto g124_52;
+    case 61:
+        stack.pop(3);
+        goto g124_60;
+    case 62:
+        stack.pop(3);
+        goto g124_61;
+    case 63:
+        stack.pop(3);
+        goto g124_62;
+    case 64:
+        stack.pop(3);
+        goto g124_63;
+    case 65:
+        stack.pop(3);
+        goto g124_64;
+    case 66:
+        stack.pop(3);
+        goto g124_65;
+    case 67:
+        stack.pop(3);
+        goto g124_66;
+    case 80:
+        stack.pop(3);
+        goto g124_79;
+    case 87:
+        stack.pop(3);
+        goto g124_86;
+    case 88:
+        stack.pop(3);
+        goto g124_87;
+    case 89:
+        stack.pop(3);
+        goto g124_88;
+    case 90:
+        stack.pop(3);
+        goto g124_89;
+    case 91:
+        stack.pop(3);
+        goto g124_90;
+    case 92:
+        stack.pop(3);
+        goto g124_91;
+    case 93:
+        stack.pop(3);
+        goto g124_92;
+    default:
+        errorState = 121;
+        goto error;
+    }
+
+d122:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.pop(3);
+        goto g124_0;
+    case 2:
+        stack.pop(3);
+        goto g124_1;
+    case 3:
+        stack.pop(3);
+        goto g124_2;
+    case 4:
+        stack.pop(3);
+        goto g124_3;
+    case 10:
+        stack.pop(3);
+        goto g124_9;
+    case 11:
+        stack.pop(3);
+        goto g124_10;
+    case 12:
+        stack.pop(3);
+        goto g124_11;
+    case 13:
+        stack.pop(3);
+        goto g124_12;
+    case 14:
+        stack.pop(3);
+        goto g124_13;
+    case 15:
+        stack.pop(3);
+        goto g124_14;
+    case 16:
+        stack.pop(3);
+        goto g124_15;
+    case 17:
+        stack.pop(3);
+        goto g124_16;
+    case 18:
+        stack.pop(3);
+        goto g124_17;
+    case 19:
+        stack.pop(3);
+        goto g124_18;
+    case 22:
+        stack.pop(3);
+        goto g124_21;
+    case 30:
+        stack.pop(3);
+        goto g124_29;
+    case 52:
+        stack.pop(3);
+        goto g124_51;
+    case 53:
+        stack.pop(3);
+        goto g124_52;
+    case 61:
+        stack.pop(3);
+        goto g124_60;
+    case 62:
+        stack.pop(3);
+        goto g124_61;
+    case 63:
+        stack.pop(3);
+        goto g124_62;
+    case 64:
+        stack.pop(3);
+        goto g124_63;
+    case 65:
+        stack.pop(3);
+        goto g124_64;
+    case 66:
+        stack.pop(3);
+        goto g124_65;
+    case 67:
+        stack.pop(3);
+        goto g124_66;
+    case 80:
+        stack.pop(3);
+        goto g124_79;
+    case 87:
+        stack.pop(3);
+        goto g124_86;
+    case 88:
+        stack.pop(3);
+        goto g124_87;
+    case 89:
+        stack.pop(3);
+        goto g124_88;
+    case 90:
+        stack.pop(3);
+        goto g124_89;
+    case 91:
+        stack.pop(3);
+        goto g124_90;
+    case 92:
+        stack.pop(3);
+        goto g124_91;
+    case 93:
+        stack.pop(3);
+        goto g124_92;
+    default:
+        errorState = 122;
+        goto error;
+    }
+
+d123:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e123_54:
+        stack.push(178);
+        goto e178_54;
+    case 82:
+    e123_81:
+        stack.push(179);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d179;
+    default:
+        errorState = 123;
+        goto error;
+    }
+
+d124:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e180_54;
+    case 56:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 58:
+        stack.push(176);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d176;
+    case 59:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 60:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 64:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 66:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 68:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 69:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 70:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 71:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 72:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 73:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 74:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 75:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 76:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 77:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e180_76;
+    case 78:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 79:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 81:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 180;
+        goto error;
+    case 82:
+        stack.push(180);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e180_81;
+    default:
+        errorState = 124;
+        goto error;
+    }
+
+d125:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.pop(3);
+        goto g124_0;
+    case 2:
+        stack.pop(3);
+        goto g124_1;
+    case 3:
+        stack.pop(3);
+        goto g124_2;
+    case 4:
+        stack.pop(3);
+        goto g124_3;
+    case 10:
+        stack.pop(3);
+        goto g124_9;
+    case 11:
+        stack.pop(3);
+        goto g124_10;
+    case 12:
+        stack.pop(3);
+        goto g124_11;
+    case 13:
+        stack.pop(3);
+        goto g124_12;
+    case 14:
+        stack.pop(3);
+        goto g124_13;
+    case 15:
+        stack.pop(3);
+        goto g124_14;
+    case 16:
+        stack.pop(3);
+        goto g124_15;
+    case 17:
+        stack.pop(3);
+        goto g124_16;
+    case 18:
+        stack.pop(3);
+        goto g124_17;
+    case 19:
+        stack.pop(3);
+        goto g124_18;
+    case 22:
+        stack.pop(3);
+        goto g124_21;
+    case 30:
+        stack.pop(3);
+        goto g124_29;
+    case 52:
+        stack.pop(3);
+        goto g124_51;
+    case 53:
+        stack.pop(3);
+        goto g124_52;
+    case 61:
+        stack.pop(3);
+        goto g124_60;
+    case 62:
+        stack.pop(3);
+        goto g124_61;
+    case 63:
+        stack.pop(3);
+        goto g124_62;
+    case 64:
+        stack.pop(3);
+        goto g124_63;
+    case 65:
+        stack.pop(3);
+        goto g124_64;
+    case 66:
+        stack.pop(3);
+        goto g124_65;
+    case 67:
+        stack.pop(3);
+        goto g124_66;
+    case 80:
+        stack.pop(3);
+        goto g124_79;
+    case 87:
+        stack.pop(3);
+        goto g124_86;
+    case 88:
+        stack.pop(3);
+        goto g124_87;
+    case 89:
+        stack.pop(3);
+        goto g124_88;
+    case 90:
+        stack.pop(3);
+        goto g124_89;
+    case 91:
+        stack.pop(3);
+        goto g124_90;
+    case 92:
+        stack.pop(3);
+        goto g124_91;
+    case 93:
+        stack.pop(3);
+        goto g124_92;
+    default:
+        errorState = 125;
+        goto error;
+    }
+
+d126:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e126_54:
+        stack.pop(2);
+        goto g140_54;
+    case 81:
+    e126_80:
+        stack.push(76);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d76;
+    default:
+        errorState = 126;
+        goto error;
+    }
+
+d127:
+    switch (currentToken.getId())
+    {
+    case 2:
+    e127_1:
+        stack.push(14);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d14;
+    case 3:
+    e127_2:
+        stack.push(15);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d15;
+    case 4:
+    e127_3:
+        stack.push(21);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d21;
+    case 10:
+    e127_9:
+        stack.push(18);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d18;
+    case 11:
+    e127_10:
+        stack.push(16);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d16;
+    case 12:
+    e127_11:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+    e127_12:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 14:
+    e127_13:
+        stack.push(17);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d17;
+    case 15:
+    e127_14:
+        stack.push(22);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d22;
+    case 16:
+    e127_15:
+        stack.push(24);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d24;
+    case 17:
+    e127_16:
+        stack.push(20);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d20;
+    case 18:
+    e127_17:
+        stack.push(19);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d19;
+    case 19:
+    e127_18:
+        stack.push(23);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d23;
+    case 22:
+    e127_21:
+        stack.push(25);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d25;
+    case 52:
+    e127_51:
+        stack.push(26);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d26;
+    case 53:
+    e127_52:
+        stack.push(27);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d27;
+    case 61:
+    e127_60:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 62:
+    e127_61:
+        stack.push(28);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d28;
+    case 63:
+    e127_62:
+        stack.push(182);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d182;
+    case 64:
+    e127_63:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+    e127_64:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+    e127_65:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+    e127_66:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+    e127_79:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+    e127_86:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+    e127_87:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+    e127_88:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+    e127_89:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+    e127_90:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+    e127_91:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+    e127_92:
+        stack.push(139);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d139;
+    default:
+        errorState = 127;
+        goto error;
+    }
+
+d128:
+    switch (currentToken.getId())
+    {
+    case 2:
+    e128_1:
+        stack.pop(1);
+        goto g112_1;
+    case 3:
+    e128_2:
+        stack.pop(1);
+        goto g112_2;
+    case 4:
+    e128_3:
+        stack.pop(1);
+        goto g112_3;
+    case 10:
+    e128_9:
+        stack.pop(1);
+        goto g112_9;
+    case 11:
+    e128_10:
+        stack.pop(1);
+        goto g112_10;
+    case 12:
+    e128_11:
+        stack.pop(1);
+        goto g112_11;
+    case 13:
+    e128_12:
+        stack.pop(1);
+        goto g112_12;
+    case 14:
+    e128_13:
+        stack.pop(1);
+        goto g112_13;
+    case 15:
+    e128_14:
+        stack.pop(1);
+        goto g112_14;
+    case 16:
+    e128_15:
+        stack.pop(1);
+        goto g112_15;
+    case 17:
+    e128_16:
+        stack.pop(1);
+        goto g112_16;
+    case 18:
+    e128_17:
+        stack.pop(1);
+        goto g112_17;
+    case 19:
+    e128_18:
+        stack.pop(1);
+        goto g112_18;
+    case 22:
+    e128_21:
+        stack.pop(1);
+        goto g112_21;
+    case 52:
+    e128_51:
+        stack.pop(1);
+        goto g112_51;
+    case 53:
+    e128_52:
+        stack.pop(1);
+        goto g112_52;
+    case 61:
+    e128_60:
+        stack.pop(1);
+        goto g112_60;
+    case 62:
+    e128_61:
+        stack.pop(1);
+        goto g112_61;
+    case 63:
+    e128_62:
+        stack.pop(1);
+        goto g112_62;
+    case 64:
+    e128_63:
+        stack.pop(1);
+        goto g112_63;
+    case 65:
+    e128_64:
+        stack.pop(1);
+        goto g112_64;
+    case 66:
+    e128_65:
+        stack.pop(1);
+        goto g112_65;
+    case 67:
+    e128_66:
+        stack.pop(1);
+        goto g112_66;
+    case 80:
+    e128_79:
+        stack.pop(1);
+        goto g112_79;
+    case 87:
+    e128_86:
+        stack.pop(1);
+        goto g112_86;
+    case 88:
+    e128_87:
+        stack.pop(1);
+        goto g112_87;
+    case 89:
+    e128_88:
+        stack.pop(1);
+        goto g112_88;
+    case 90:
+    e128_89:
+        stack.pop(1);
+        goto g112_89;
+    case 91:
+    e128_90:
+        stack.pop(1);
+        goto g112_90;
+    case 92:
+    e128_91:
+        stack.pop(1);
+        goto g112_91;
+    case 93:
+    e128_92:
+        stack.pop(1);
+        goto g112_92;
+    default:
+        errorState = 128;
+        goto error;
+    }
+
+d129:
+    switch (currentToken.getId())
+    {
+    case 2:
+    e129_1:
+        stack.pop(1);
+        goto g113_1;
+    case 3:
+    e129_2:
+        stack.pop(1);
+        goto g113_2;
+    case 4:
+    e129_3:
+        stack.pop(1);
+        goto g113_3;
+    case 10:
+    e129_9:
+        stack.pop(1);
+        goto g113_9;
+    case 11:
+    e129_10:
+        stack.pop(1);
+        goto g113_10;
+    case 12:
+    e129_11:
+        stack.pop(1);
+        goto g113_11;
+    case 13:
+    e129_12:
+        stack.pop(1);
+        goto g113_12;
+    case 14:
+    e129_13:
+        stack.pop(1);
+        goto g113_13;
+    case 15:
+    e129_14:
+        stack.pop(1);
+        goto g113_14;
+    case 16:
+    e129_15:
+        stack.pop(1);
+        goto g113_15;
+    case 17:
+    e129_16:
+        stack.pop(1);
+        goto g113_16;
+    case 18:
+    e129_17:
+        stack.pop(1);
+        goto g113_17;
+    case 19:
+    e129_18:
+        stack.pop(1);
+        goto g113_18;
+    case 22:
+    e129_21:
+        stack.pop(1);
+        goto g113_21;
+    case 52:
+    e129_51:
+        stack.pop(1);
+        goto g113_51;
+    case 53:
+    e129_52:
+        stack.pop(1);
+        goto g113_52;
+    case 61:
+    e129_60:
+        stack.pop(1);
+        goto g113_60;
+    case 62:
+    e129_61:
+        stack.pop(1);
+        goto g113_61;
+    case 63:
+    e129_62:
+        stack.pop(1);
+        goto g113_62;
+    case 64:
+    e129_63:
+        stack.pop(1);
+        goto g113_63;
+    case 65:
+    e129_64:
+        stack.pop(1);
+        goto g113_64;
+    case 66:
+    e129_65:
+        stack.pop(1);
+        goto g113_65;
+    case 67:
+    e129_66:
+        stack.pop(1);
+        goto g113_66;
+    case 80:
+    e129_79:
+        stack.pop(1);
+        goto g113_79;
+    case 87:
+    e129_86:
+        stack.pop(1);
+        goto g113_86;
+    case 88:
+    e129_87:
+        stack.pop(1);
+        goto g113_87;
+    case 89:
+    e129_88:
+        stack.pop(1);
+        goto g113_88;
+    case 90:
+    e129_89:
+        stack.pop(1);
+        goto g113_89;
+    case 91:
+    e129_90:
+        stack.pop(1);
+        goto g113_90;
+    case 92:
+    e129_91:
+        stack.pop(1);
+        goto g113_91;
+    case 93:
+    e129_92:
+        stack.pop(1);
+        goto g113_92;
+    default:
+        errorState = 129;
+        goto error;
+    }
+
+d130:
+    switch (currentToken.getId())
+    {
+    case 2:
+    e130_1:
+        stack.pop(1);
+        goto g113_1;
+    case 3:
+    e130_2:
+        stack.pop(1);
+        goto g113_2;
+    case 4:
+    e130_3:
+        stack.pop(1);
+        goto g113_3;
+    case 10:
+    e130_9:
+        stack.pop(1);
+        goto g113_9;
+    case 11:
+    e130_10:
+        stack.pop(1);
+        goto g113_10;
+    case 12:
+    e130_11:
+        stack.pop(1);
+        goto g113_11;
+    case 13:
+    e130_12:
+        stack.pop(1);
+        goto g113_12;
+    case 14:
+    e130_13:
+        stack.pop(1);
+        goto g113_13;
+    case 15:
+    e130_14:
+        stack.pop(1);
+        goto g113_14;
+    case 16:
+    e130_15:
+        stack.pop(1);
+        goto g113_15;
+    case 17:
+    e130_16:
+        stack.pop(1);
+        goto g113_16;
+    case 18:
+    e130_17:
+        stack.pop(1);
+        goto g113_17;
+    case 19:
+    e130_18:
+        stack.pop(1);
+        goto g113_18;
+    case 22:
+    e130_21:
+        stack.pop(1);
+        goto g113_21;
+    case 52:
+    e130_51:
+        stack.pop(1);
+        goto g113_51;
+    case 53:
+    e130_52:
+        stack.pop(1);
+        goto g113_52;
+    case 61:
+    e130_60:
+        stack.pop(1);
+        goto g113_60;
+    case 62:
+    e130_61:
+        stack.pop(1);
+        goto g113_61;
+    case 63:
+    e130_62:
+        stack.pop(1);
+        goto g113_62;
+    case 64:
+    e130_63:
+        stack.pop(1);
+        goto g113_63;
+    case 65:
+    e130_64:
+        stack.pop(1);
+        goto g113_64;
+    case 66:
+    e130_65:
+        stack.pop(1);
+        goto g113_65;
+    case 67:
+    e130_66:
+        stack.pop(1);
+        goto g113_66;
+    case 80:
+    e130_79:
+        stack.pop(1);
+        goto g113_79;
+    case 87:
+    e130_86:
+        stack.pop(1);
+        goto g113_86;
+    case 88:
+    e130_87:
+        stack.pop(1);
+        goto g113_87;
+    case 89:
+    e130_88:
+        stack.pop(1);
+        goto g113_88;
+    case 90:
+    e130_89:
+        stack.pop(1);
+        goto g113_89;
+    case 91:
+    e130_90:
+        stack.pop(1);
+        goto g113_90;
+    case 92:
+    e130_91:
+        stack.pop(1);
+        goto g113_91;
+    case 93:
+    e130_92:
+        stack.pop(1);
+        goto g113_92;
+    default:
+        errorState = 130;
+        goto error;
+    }
+
+d131:
+    switch (currentToken.getId())
+    {
+    case 2:
+    e131_1:
+        stack.pop(1);
+        goto g113_1;
+    case 3:
+    e131_2:
+        stack.pop(1);
+        goto g113_2;
+    case 4:
+    e131_3:
+        stack.pop(1);
+        goto g113_3;
+    case 10:
+    e131_9:
+        stack.pop(1);
+        goto g113_9;
+    case 11:
+    e131_10:
+        stack.pop(1);
+        goto g113_10;
+    case 12:
+    e131_11:
+        stack.pop(1);
+        goto g113_11;
+    case 13:
+    e131_12:
+        stack.pop(1);
+        goto g113_12;
+    case 14:
+    e131_13:
+        stack.pop(1);
+        goto g113_13;
+    case 15:
+    e131_14:
+        stack.pop(1);
+        goto g113_14;
+    case 16:
+    e131_15:
+        stack.pop(1);
+        goto g113_15;
+    case 17:
+    e131_16:
+        stack.pop(1);
+        goto g113_16;
+    case 18:
+    e131_17:
+        stack.pop(1);
+        goto g113_17;
+    case 19:
+    e131_18:
+        stack.pop(1);
+        goto g113_18;
+    case 22:
+    e131_21:
+        stack.pop(1);
+        goto g113_21;
+    case 52:
+    e131_51:
+        stack.pop(1);
+        goto g113_51;
+    case 53:
+    e131_52:
+        stack.pop(1);
+        goto g113_52;
+    case 61:
+    e131_60:
+        stack.pop(1);
+        goto g113_60;
+    case 62:
+    e131_61:
+        stack.pop(1);
+        goto g113_61;
+    case 63:
+    e131_62:
+        stack.pop(1);
+        goto g113_62;
+    case 64:
+    e131_63:
+        stack.pop(1);
+        goto g113_63;
+    case 65:
+    e131_64:
+        stack.pop(1);
+        goto g113_64;
+    case 66:
+    e131_65:
+        stack.pop(1);
+        goto g113_65;
+    case 67:
+    e131_66:
+        stack.pop(1);
+        goto g113_66;
+    case 80:
+    e131_79:
+        stack.pop(1);
+        goto g113_79;
+    case 87:
+    e131_86:
+        stack.pop(1);
+        goto g113_86;
+    case 88:
+    e131_87:
+        stack.pop(1);
+        goto g113_87;
+    case 89:
+    e131_88:
+        stack.pop(1);
+        goto g113_88;
+    case 90:
+    e131_89:
+        stack.pop(1);
+        goto g113_89;
+    case 91:
+    e131_90:
+        stack.pop(1);
+        goto g113_90;
+    case 92:
+    e131_91:
+        stack.pop(1);
+        goto g113_91;
+    case 93:
+    e131_92:
+        stack.pop(1);
+        goto g113_92;
+    default:
+        errorState = 131;
+        goto error;
+    }
+
+d132:
+    switch (currentToken.getId())
+    {
+    case 2:
+    e132_1:
+        stack.pop(1);
+        goto g113_1;
+    case 3:
+    e132_2:
+        stack.pop(1);
+        goto g113_2;
+    case 4:
+    e132_3:
+        stack.pop(1);
+        goto g113_3;
+    case 10:
+    e132_9:
+        stack.pop(1);
+        goto g113_9;
+    case 11:
+    e132_10:
+        stack.pop(1);
+        goto g113_10;
+    case 12:
+    e132_11:
+        stack.pop(1);
+        goto g113_11;
+    case 13:
+    e132_12:
+        stack.pop(1);
+        goto g113_12;
+    case 14:
+    e132_13:
+        stack.pop(1);
+        goto g113_13;
+    case 15:
+    e132_14:
+        stack.pop(1);
+        goto g113_14;
+    case 16:
+    e132_15:
+        stack.pop(1);
+        goto g113_15;
+    case 17:
+    e132_16:
+        stack.pop(1);
+        goto g113_16;
+    case 18:
+    e132_17:
+        stack.pop(1);
+        goto g113_17;
+    case 19:
+    e132_18:
+        stack.pop(1);
+        goto g113_18;
+    case 22:
+    e132_21:
+        stack.pop(1);
+        goto g113_21;
+    case 52:
+    e132_51:
+        stack.pop(1);
+        goto g113_51;
+    case 53:
+    e132_52:
+        stack.pop(1);
+        goto g113_52;
+    case 61:
+    e132_60:
+        stack.pop(1);
+        goto g113_60;
+    case 62:
+    e132_61:
+        stack.pop(1);
+        goto g113_61;
+    case 63:
+    e132_62:
+        stack.pop(1);
+        goto g113_62;
+    case 64:
+    e132_63:
+        stack.pop(1);
+        goto g113_63;
+    case 65:
+    e132_64:
+        stack.pop(1);
+        goto g113_64;
+    case 66:
+    e132_65:
+        stack.pop(1);
+        goto g113_65;
+    case 67:
+    e132_66:
+        stack.pop(1);
+        goto g113_66;
+    case 80:
+    e132_79:
+        stack.pop(1);
+        goto g113_79;
+    case 87:
+    e132_86:
+        stack.pop(1);
+        goto g113_86;
+    case 88:
+    e132_87:
+        stack.pop(1);
+        goto g113_87;
+    case 89:
+    e132_88:
+        stack.pop(1);
+        goto g113_88;
+    case 90:
+    e132_89:
+        stack.pop(1);
+        goto g113_89;
+    case 91:
+    e132_90:
+        stack.pop(1);
+        goto g113_90;
+    case 92:
+    e132_91:
+        stack.pop(1);
+        goto g113_91;
+    case 93:
+    e132_92:
+        stack.pop(1);
+        goto g113_92;
+    default:
+        errorState = 132;
+        goto error;
+    }
+
+d133:
+    switch (currentToken.getId())
+    {
+    case 2:
+    e133_1:
+        stack.pop(1);
+        goto g113_1;
+    case 3:
+    e133_2:
+        stack.pop(1);
+        goto g113_2;
+    case 4:
+    e133_3:
+        stack.pop(1);
+        goto g113_3;
+    case 10:
+    e133_9:
+        stack.pop(1);
+        goto g113_9;
+    case 11:
+    e133_10:
+        stack.pop(1);
+        goto g113_10;
+    case 12:
+    e133_11:
+        stack.pop(1);
+        goto g113_11;
+    case 13:
+    e133_12:
+        stack.pop(1);
+        goto g113_12;
+    case 14:
+    e133_13:
+        stack.pop(1);
+        goto g113_13;
+    case 15:
+    e133_14:
+        stack.pop(1);
+        goto g113_14;
+    case 16:
+    e133_15:
+        stack.pop(1);
+        goto g113_15;
+    case 17:
+    e133_16:
+        stack.pop(1);
+        goto g113_16;
+    case 18:
+    e133_17:
+        stack.pop(1);
+        goto g113_17;
+    case 19:
+    e133_18:
+        stack.pop(1);
+        goto g113_18;
+    case 22:
+    e133_21:
+        stack.pop(1);
+        goto g113_21;
+    case 52:
+    e133_51:
+        stack.pop(1);
+        goto g113_51;
+    case 53:
+    e133_52:
+        stack.pop(1);
+        goto g113_52;
+    case 61:
+    e133_60:
+        stack.pop(1);
+        goto g113_60;
+    case 62:
+    e133_61:
+        stack.pop(1);
+        goto g113_61;
+    case 63:
+    e133_62:
+        stack.pop(1);
+        goto g113_62;
+    case 64:
+    e133_63:
+        stack.pop(1);
+        goto g113_63;
+    case 65:
+    e133_64:
+        stack.pop(1);
+        goto g113_64;
+    case 66:
+    e133_65:
+        stack.pop(1);
+        goto g113_65;
+    case 67:
+    e133_66:
+        stack.pop(1);
+        goto g113_66;
+    case 80:
+    e133_79:
+        stack.pop(1);
+        goto g113_79;
+    case 87:
+    e133_86:
+        stack.pop(1);
+        goto g113_86;
+    case 88:
+    e133_87:
+        stack.pop(1);
+        goto g113_87;
+    case 89:
+    e133_88:
+        stack.pop(1);
+        goto g113_88;
+    case 90:
+    e133_89:
+        stack.pop(1);
+        goto g113_89;
+    case 91:
+    e133_90:
+        stack.pop(1);
+        goto g113_90;
+    case 92:
+    e133_91:
+        stack.pop(1);
+        goto g113_91;
+    case 93:
+    e133_92:
+        stack.pop(1);
+        goto g113_92;
+    default:
+        errorState = 133;
+        goto error;
+    }
+
+d134:
+    switch (currentToken.getId())
+    {
+    case 2:
+    e134_1:
+        stack.pop(1);
+        goto g113_1;
+    case 3:
+    e134_2:
+        stack.pop(1);
+        goto g113_2;
+    case 4:
+    e134_3:
+        stack.pop(1);
+        goto g113_3;
+    case 10:
+    e134_9:
+        stack.pop(1);
+        goto g113_9;
+    case 11:
+    e134_10:
+        stack.pop(1);
+        goto g113_10;
+    case 12:
+    e134_11:
+        stack.pop(1);
+        goto g113_11;
+    case 13:
+    e134_12:
+        stack.pop(1);
+        goto g113_12;
+    case 14:
+    e134_13:
+        stack.pop(1);
+        goto g113_13;
+    case 15:
+    e134_14:
+        stack.pop(1);
+        goto g113_14;
+    case 16:
+    e134_15:
+        stack.pop(1);
+        goto g113_15;
+    case 17:
+    e134_16:
+        stack.pop(1);
+        goto g113_16;
+    case 18:
+    e134_17:
+        stack.pop(1);
+        goto g113_17;
+    case 19:
+    e134_18:
+        stack.pop(1);
+        goto g113_18;
+    case 22:
+    e134_21:
+        stack.pop(1);
+        goto g113_21;
+    case 52:
+    e134_51:
+        stack.pop(1);
+        goto g113_51;
+    case 53:
+    e134_52:
+        stack.pop(1);
+        goto g113_52;
+    case 61:
+    e134_60:
+        stack.pop(1);
+        goto g113_60;
+    case 62:
+    e134_61:
+        stack.pop(1);
+        goto g113_61;
+    case 63:
+    e134_62:
+        stack.pop(1);
+        goto g113_62;
+    case 64:
+    e134_63:
+        stack.pop(1);
+        goto g113_63;
+    case 65:
+    e134_64:
+        stack.pop(1);
+        goto g113_64;
+    case 66:
+    e134_65:
+        stack.pop(1);
+        goto g113_65;
+    case 67:
+    e134_66:
+        stack.pop(1);
+        goto g113_66;
+    case 80:
+    e134_79:
+        stack.pop(1);
+        goto g113_79;
+    case 87:
+    e134_86:
+        stack.pop(1);
+        goto g113_86;
+    case 88:
+    e134_87:
+        stack.pop(1);
+        goto g113_87;
+    case 89:
+    e134_88:
+        stack.pop(1);
+        goto g113_88;
+    case 90:
+    e134_89:
+        stack.pop(1);
+        goto g113_89;
+    case 91:
+    e134_90:
+        stack.pop(1);
+        goto g113_90;
+    case 92:
+    e134_91:
+        stack.pop(1);
+        goto g113_91;
+    case 93:
+    e134_92:
+        stack.pop(1);
+        goto g113_92;
+    default:
+        errorState = 134;
+        goto error;
+    }
+
+d135:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e135_54:
+        stack.push(184);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d184;
+    case 56:
+    e135_55:
+        stack.pop(1);
+        goto g138_55;
+    case 59:
+    e135_58:
+        stack.pop(1);
+        goto g138_58;
+    case 60:
+    e135_59:
+        stack.pop(1);
+        goto g138_59;
+    case 64:
+    e135_63:
+        stack.pop(1);
+        goto g138_63;
+    case 66:
+    e135_65:
+        stack.pop(1);
+        goto g138_65;
+    case 68:
+    e135_67:
+        stack.pop(1);
+        goto g138_67;
+    case 69:
+    e135_68:
+        stack.pop(1);
+        goto g138_68;
+    case 70:
+    e135_69:
+        stack.pop(1);
+        goto g138_69;
+    case 71:
+    e135_70:
+        stack.pop(1);
+        goto g138_70;
+    case 72:
+    e135_71:
+        stack.pop(1);
+        goto g138_71;
+    case 73:
+    e135_72:
+        stack.pop(1);
+        goto g138_72;
+    case 74:
+    e135_73:
+        stack.pop(1);
+        goto g138_73;
+    case 75:
+    e135_74:
+        stack.pop(1);
+        goto g138_74;
+    case 76:
+    e135_75:
+        stack.pop(1);
+        goto g138_75;
+    case 78:
+    e135_77:
+        stack.pop(1);
+        goto g138_77;
+    case 79:
+    e135_78:
+        stack.pop(1);
+        goto g138_78;
+    case 81:
+    e135_80:
+        stack.pop(1);
+        goto g138_80;
+    default:
+        errorState = 135;
+        goto error;
+    }
+
+d136:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e136_54:
+        stack.push(185);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d185;
+    default:
+        errorState = 136;
+        goto error;
+    }
+
+d137:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e137_92:
+        stack.push(186);
+        semanticAnalyser->executeAction(1, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e186_92;
+    default:
+        errorState = 137;
+        goto error;
+    }
+
+d138:
+    switch (currentToken.getId())
+    {
+    case 77:
+    e138_76:
+        stack.push(187);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d187;
+    default:
+        errorState = 138;
+        goto error;
+    }
+
+d139:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_54;
+    case 56:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_55;
+    case 58:
+        stack.push(176);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d176;
+    case 59:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_58;
+    case 60:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_59;
+    case 61:
+        stack.push(78);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d78;
+    case 64:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_63;
+    case 65:
+        stack.push(80);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d80;
+    case 66:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_65;
+    case 67:
+        stack.push(81);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d81;
+    case 68:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_67;
+    case 69:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_68;
+    case 70:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_69;
+    case 71:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_70;
+    case 72:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_71;
+    case 73:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_72;
+    case 74:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_73;
+    case 75:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_74;
+    case 76:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_75;
+    case 77:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_76;
+    case 78:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_77;
+    case 79:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_78;
+    case 81:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_80;
+    case 82:
+        stack.push(175);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e175_81;
+    default:
+        errorState = 139;
+        goto error;
+    }
+
+d140:
+    switch (currentToken.getId())
+    {
+    case 56:
+    e140_55:
+        stack.push(189);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d189;
+    case 60:
+    e140_59:
+        stack.push(188);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d188;
+    default:
+        errorState = 140;
+        goto error;
+    }
+
+d141:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(3);
+        goto g99_54;
+    case 56:
+        stack.pop(3);
+        goto g99_55;
+    case 59:
+        stack.pop(3);
+        goto g99_58;
+    case 60:
+        stack.pop(3);
+        goto g99_59;
+    case 64:
+        stack.pop(3);
+        goto g99_63;
+    case 66:
+        stack.pop(3);
+        goto g99_65;
+    case 68:
+        stack.pop(3);
+        goto g99_67;
+    case 69:
+        stack.pop(3);
+        goto g99_68;
+    case 70:
+        stack.pop(3);
+        goto g99_69;
+    case 71:
+        stack.pop(3);
+        goto g99_70;
+    case 72:
+        stack.pop(3);
+        goto g99_71;
+    case 73:
+        stack.pop(3);
+        goto g99_72;
+    case 74:
+        stack.pop(3);
+        goto g99_73;
+    case 75:
+        stack.pop(3);
+        goto g99_74;
+    case 76:
+        stack.pop(3);
+        goto g99_75;
+    case 78:
+        stack.pop(3);
+        goto g99_77;
+    case 79:
+        stack.pop(3);
+        goto g99_78;
+    case 81:
+        stack.pop(3);
+        goto g99_80;
+    default:
+        errorState = 141;
+        goto error;
+    }
+
+d142:
+    switch (currentToken.getId())
+    {
+    case 56:
+    e142_55:
+        stack.pop(1);
+        goto g100_55;
+    case 60:
+    e142_59:
+        stack.pop(1);
+        goto g100_59;
+    default:
+        errorState = 142;
+        goto error;
+    }
+
+d143:
+    switch (currentToken.getId())
+    {
+    case 56:
+    e143_55:
+        stack.pop(1);
+        goto g101_55;
+    case 60:
+    e143_59:
+        stack.pop(1);
+        goto g101_59;
+    default:
+        errorState = 143;
+        goto error;
+    }
+
+d144:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_54;
+    case 56:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_55;
+    case 58:
+        stack.push(190);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d190;
+    case 59:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_58;
+    case 60:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_59;
+    case 61:
+        stack.push(78);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d78;
+    case 64:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_63;
+    case 65:
+        stack.push(80);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d80;
+    case 66:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_65;
+    case 67:
+        stack.push(81);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d81;
+    case 68:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_67;
+    case 69:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_68;
+    case 70:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_69;
+    case 71:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_70;
+    case 72:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_71;
+    case 73:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_72;
+    case 74:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_73;
+    case 75:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_74;
+    case 76:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_75;
+    case 77:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 79;
+        goto error;
+    case 78:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_77;
+    case 79:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_78;
+    case 81:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e79_80;
+    case 82:
+        stack.push(79);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 79;
+        goto error;
+    default:
+        errorState = 144;
+        goto error;
+    }
+
+d145:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 145;
+        goto error;
+    }
+
+d146:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e146_54:
+        stack.pop(3);
+        goto g130_54;
+    case 56:
+    e146_55:
+        stack.pop(3);
+        goto g130_55;
+    case 59:
+    e146_58:
+        stack.pop(3);
+        goto g130_58;
+    case 60:
+    e146_59:
+        stack.pop(3);
+        goto g130_59;
+    case 64:
+    e146_63:
+        stack.pop(3);
+        goto g130_63;
+    case 66:
+    e146_65:
+        stack.pop(3);
+        goto g130_65;
+    case 68:
+    e146_67:
+        stack.pop(3);
+        goto g130_67;
+    case 69:
+    e146_68:
+        stack.pop(3);
+        goto g130_68;
+    case 70:
+    e146_69:
+        stack.pop(3);
+        goto g130_69;
+    case 71:
+    e146_70:
+        stack.pop(3);
+        goto g130_70;
+    case 72:
+    e146_71:
+        stack.pop(3);
+        goto g130_71;
+    case 73:
+    e146_72:
+        stack.pop(3);
+        goto g130_72;
+    case 74:
+    e146_73:
+        stack.pop(3);
+        goto g130_73;
+    case 75:
+    e146_74:
+        stack.pop(3);
+        goto g130_74;
+    case 76:
+    e146_75:
+        stack.pop(3);
+        goto g130_75;
+    case 78:
+    e146_77:
+        stack.pop(3);
+        goto g130_77;
+    case 79:
+    e146_78:
+        stack.pop(3);
+        goto g130_78;
+    case 81:
+    e146_80:
+        stack.pop(3);
+        goto g130_80;
+    default:
+        errorState = 146;
+        goto error;
+    }
+
+d147:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e147_54:
+        stack.pop(3);
+        goto g130_54;
+    case 56:
+    e147_55:
+        stack.pop(3);
+        goto g130_55;
+    case 59:
+    e147_58:
+        stack.pop(3);
+        goto g130_58;
+    case 60:
+    e147_59:
+        stack.pop(3);
+        goto g130_59;
+    case 64:
+    e147_63:
+        stack.pop(3);
+        goto g130_63;
+    case 66:
+    e147_65:
+        stack.pop(3);
+        goto g130_65;
+    case 68:
+    e147_67:
+        stack.pop(3);
+        goto g130_67;
+    case 69:
+    e147_68:
+        stack.pop(3);
+        goto g130_68;
+    case 70:
+    e147_69:
+        stack.pop(3);
+        goto g130_69;
+    case 71:
+    e147_70:
+        stack.pop(3);
+        goto g130_70;
+    case 72:
+    e147_71:
+        stack.pop(3);
+        goto g130_71;
+    case 73:
+    e147_72:
+        stack.pop(3);
+        goto g130_72;
+    case 74:
+    e147_73:
+        stack.pop(3);
+        goto g130_73;
+    case 75:
+    e147_74:
+        stack.pop(3);
+        goto g130_74;
+    case 76:
+    e147_75:
+        stack.pop(3);
+        goto g130_75;
+    case 78:
+    e147_77:
+        stack.pop(3);
+        goto g130_77;
+    case 79:
+    e147_78:
+        stack.pop(3);
+        goto g130_78;
+    case 81:
+    e147_80:
+        stack.pop(3);
+        goto g130_80;
+    default:
+        errorState = 147;
+        goto error;
+    }
+
+d148:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e148_54:
+        stack.push(193);
+        goto e193_54;
+    case 56:
+    e148_55:
+        stack.push(193);
+        goto e193_55;
+    case 59:
+    e148_58:
+        stack.push(193);
+        goto e193_58;
+    case 60:
+    e148_59:
+        stack.push(193);
+        goto e193_59;
+    case 78:
+    e148_77:
+        stack.push(84);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d84;
+    case 79:
+    e148_78:
+        stack.push(83);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d83;
+    case 81:
+    e148_80:
+        stack.push(193);
+        goto e193_80;
+    default:
+        errorState = 148;
+        goto error;
+    }
+
+d149:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e149_54:
+        stack.push(194);
+        goto e194_54;
+    case 56:
+    e149_55:
+        stack.push(194);
+        goto e194_55;
+    case 59:
+    e149_58:
+        stack.push(194);
+        goto e194_58;
+    case 60:
+    e149_59:
+        stack.push(194);
+        goto e194_59;
+    case 78:
+    e149_77:
+        stack.push(84);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d84;
+    case 79:
+    e149_78:
+        stack.push(83);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d83;
+    case 81:
+    e149_80:
+        stack.push(194);
+        goto e194_80;
+    default:
+        errorState = 149;
+        goto error;
+    }
+
+d150:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e150_54:
+        stack.pop(2);
+        goto g132_54;
+    case 56:
+    e150_55:
+        stack.pop(2);
+        goto g132_55;
+    case 59:
+    e150_58:
+        stack.pop(2);
+        goto g132_58;
+    case 60:
+    e150_59:
+        stack.pop(2);
+        goto g132_59;
+    case 78:
+    e150_77:
+        stack.pop(2);
+        goto g132_77;
+    case 79:
+    e150_78:
+        stack.pop(2);
+        goto g132_78;
+    case 81:
+    e150_80:
+        stack.pop(2);
+        goto g132_80;
+    default:
+        errorState = 150;
+        goto error;
+    }
+
+d151:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e151_54:
+        stack.pop(2);
+        goto g132_54;
+    case 56:
+    e151_55:
+        stack.pop(2);
+        goto g132_55;
+    case 59:
+    e151_58:
+        stack.pop(2);
+        goto g132_58;
+    case 60:
+    e151_59:
+        stack.pop(2);
+        goto g132_59;
+    case 78:
+    e151_77:
+        stack.pop(2);
+        goto g132_77;
+    case 79:
+    e151_78:
+        stack.pop(2);
+        goto g132_78;
+    case 81:
+    e151_80:
+        stack.pop(2);
+        goto g132_80;
+    default:
+        errorState = 151;
+        goto error;
+    }
+
+d152:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e152_54:
+        stack.pop(2);
+        goto g132_54;
+    case 56:
+    e152_55:
+        stack.pop(2);
+        goto g132_55;
+    case 59:
+    e152_58:
+        stack.pop(2);
+        goto g132_58;
+    case 60:
+    e152_59:
+        stack.pop(2);
+        goto g132_59;
+    case 78:
+    e152_77:
+        stack.pop(2);
+        goto g132_77;
+    case 79:
+    e152_78:
+        stack.pop(2);
+        goto g132_78;
+    case 81:
+    e152_80:
+        stack.pop(2);
+        goto g132_80;
+    default:
+        errorState = 152;
+        goto error;
+    }
+
+d153:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e153_54:
+        stack.pop(2);
+        goto g132_54;
+    case 56:
+    e153_55:
+        stack.pop(2);
+        goto g132_55;
+    case 59:
+    e153_58:
+        stack.pop(2);
+        goto g132_58;
+    case 60:
+    e153_59:
+        stack.pop(2);
+        goto g132_59;
+    case 78:
+    e153_77:
+        stack.pop(2);
+        goto g132_77;
+    case 79:
+    e153_78:
+        stack.pop(2);
+        goto g132_78;
+    case 81:
+    e153_80:
+        stack.pop(2);
+        goto g132_80;
+    default:
+        errorState = 153;
+        goto error;
+    }
+
+d154:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e154_54:
+        stack.pop(2);
+        goto g132_54;
+    case 56:
+    e154_55:
+        stack.pop(2);
+        goto g132_55;
+    case 59:
+    e154_58:
+        stack.pop(2);
+        goto g132_58;
+    case 60:
+    e154_59:
+        stack.pop(2);
+        goto g132_59;
+    case 78:
+    e154_77:
+        stack.pop(2);
+        goto g132_77;
+    case 79:
+    e154_78:
+        stack.pop(2);
+        goto g132_78;
+    case 81:
+    e154_80:
+        stack.pop(2);
+        goto g132_80;
+    default:
+        errorState = 154;
+        goto error;
+    }
+
+d155:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e155_54:
+        stack.pop(2);
+        goto g132_54;
+    case 56:
+    e155_55:
+        stack.pop(2);
+        goto g132_55;
+    case 59:
+    e155_58:
+        stack.pop(2);
+        goto g132_58;
+    case 60:
+    e155_59:
+        stack.pop(2);
+        goto g132_59;
+    case 78:
+    e155_77:
+        stack.pop(2);
+        goto g132_77;
+    case 79:
+    e155_78:
+        stack.pop(2);
+        goto g132_78;
+    case 81:
+    e155_80:
+        stack.pop(2);
+        goto g132_80;
+    default:
+        errorState = 155;
+        goto error;
+    }
+
+d156:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e156_54:
+        stack.push(195);
+        goto e195_54;
+    case 56:
+    e156_55:
+        stack.push(195);
+        goto e195_55;
+    case 59:
+    e156_58:
+        stack.push(195);
+        goto e195_58;
+    case 60:
+    e156_59:
+        stack.push(195);
+        goto e195_59;
+    case 64:
+    e156_63:
+        stack.push(93);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d93;
+    case 66:
+    e156_65:
+        stack.push(94);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d94;
+    case 71:
+    e156_70:
+        stack.push(195);
+        goto e195_70;
+    case 72:
+    e156_71:
+        stack.push(195);
+        goto e195_71;
+    case 73:
+    e156_72:
+        stack.push(195);
+        goto e195_72;
+    case 74:
+    e156_73:
+        stack.push(195);
+        goto e195_73;
+    case 75:
+    e156_74:
+        stack.push(195);
+        goto e195_74;
+    case 76:
+    e156_75:
+        stack.push(195);
+        goto e195_75;
+    case 78:
+    e156_77:
+        stack.push(195);
+        goto e195_77;
+    case 79:
+    e156_78:
+        stack.push(195);
+        goto e195_78;
+    case 81:
+    e156_80:
+        stack.push(195);
+        goto e195_80;
+    default:
+        errorState = 156;
+        goto error;
+    }
+
+d157:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e157_54:
+        stack.push(196);
+        goto e196_54;
+    case 56:
+    e157_55:
+        stack.push(196);
+        goto e196_55;
+    case 59:
+    e157_58:
+        stack.push(196);
+        goto e196_58;
+    case 60:
+    e157_59:
+        stack.push(196);
+        goto e196_59;
+    case 64:
+    e157_63:
+        stack.push(93);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d93;
+    case 66:
+    e157_65:
+        stack.push(94);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d94;
+    case 71:
+    e157_70:
+        stack.push(196);
+        goto e196_70;
+    case 72:
+    e157_71:
+        stack.push(196);
+        goto e196_71;
+    case 73:
+    e157_72:
+        stack.push(196);
+        goto e196_72;
+    case 74:
+    e157_73:
+        stack.push(196);
+        goto e196_73;
+    case 75:
+    e157_74:
+        stack.push(196);
+        goto e196_74;
+    case 76:
+    e157_75:
+        stack.push(196);
+        goto e196_75;
+    case 78:
+    e157_77:
+        stack.push(196);
+        goto e196_77;
+    case 79:
+    e157_78:
+        stack.push(196);
+        goto e196_78;
+    case 81:
+    e157_80:
+        stack.push(196);
+        goto e196_80;
+    default:
+        errorState = 157;
+        goto error;
+    }
+
+d158:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e158_54:
+        stack.push(197);
+        goto e197_54;
+    case 56:
+    e158_55:
+        stack.push(197);
+        goto e197_55;
+    case 59:
+    e158_58:
+        stack.push(197);
+        goto e197_58;
+    case 60:
+    e158_59:
+        stack.push(197);
+        goto e197_59;
+    case 64:
+    e158_63:
+        stack.push(197);
+        goto e197_63;
+    case 66:
+    e158_65:
+        stack.push(197);
+        goto e197_65;
+    case 68:
+    e158_67:
+        stack.push(96);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d96;
+    case 69:
+    e158_68:
+        stack.push(97);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d97;
+    case 70:
+    e158_69:
+        stack.push(98);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d98;
+    case 71:
+    e158_70:
+        stack.push(197);
+        goto e197_70;
+    case 72:
+    e158_71:
+        stack.push(197);
+        goto e197_71;
+    case 73:
+    e158_72:
+        stack.push(197);
+        goto e197_72;
+    case 74:
+    e158_73:
+        stack.push(197);
+        goto e197_73;
+    case 75:
+    e158_74:
+        stack.push(197);
+        goto e197_74;
+    case 76:
+    e158_75:
+        stack.push(197);
+        goto e197_75;
+    case 78:
+    e158_77:
+        stack.push(197);
+        goto e197_77;
+    case 79:
+    e158_78:
+        stack.push(197);
+        goto e197_78;
+    case 81:
+    e158_80:
+        stack.push(197);
+        goto e197_80;
+    default:
+        errorState = 158;
+        goto error;
+    }
+
+d159:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e159_54:
+        stack.push(198);
+        goto e198_54;
+    case 56:
+    e159_55:
+        stack.push(198);
+        goto e198_55;
+    case 59:
+    e159_58:
+        stack.push(198);
+        goto e198_58;
+    case 60:
+    e159_59:
+        stack.push(198);
+        goto e198_59;
+    case 64:
+    e159_63:
+        stack.push(198);
+        goto e198_63;
+    case 66:
+    e159_65:
+        stack.push(198);
+        goto e198_65;
+    case 68:
+    e159_67:
+        stack.push(96);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d96;
+    case 69:
+    e159_68:
+        stack.push(97);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d97;
+    case 70:
+    e159_69:
+        stack.push(98);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d98;
+    case 71:
+    e159_70:
+        stack.push(198);
+        goto e198_70;
+    case 72:
+    e159_71:
+        stack.push(198);
+        goto e198_71;
+    case 73:
+    e159_72:
+        stack.push(198);
+        goto e198_72;
+    case 74:
+    e159_73:
+        stack.push(198);
+        goto e198_73;
+    case 75:
+    e159_74:
+        stack.push(198);
+        goto e198_74;
+    case 76:
+    e159_75:
+        stack.push(198);
+        goto e198_75;
+    case 78:
+    e159_77:
+        stack.push(198);
+        goto e198_77;
+    case 79:
+    e159_78:
+        stack.push(198);
+        goto e198_78;
+    case 81:
+    e159_80:
+        stack.push(198);
+        goto e198_80;
+    default:
+        errorState = 159;
+        goto error;
+    }
+
+d160:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e160_54:
+        stack.push(199);
+        goto e199_54;
+    case 56:
+    e160_55:
+        stack.push(199);
+        goto e199_55;
+    case 59:
+    e160_58:
+        stack.push(199);
+        goto e199_58;
+    case 60:
+    e160_59:
+        stack.push(199);
+        goto e199_59;
+    case 64:
+    e160_63:
+        stack.push(199);
+        goto e199_63;
+    case 66:
+    e160_65:
+        stack.push(199);
+        goto e199_65;
+    case 68:
+    e160_67:
+        stack.push(96);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d96;
+    case 69:
+    e160_68:
+        stack.push(97);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d97;
+    case 70:
+    e160_69:
+        stack.push(98);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d98;
+    case 71:
+    e160_70:
+        stack.push(199);
+        goto e199_70;
+    case 72:
+    e160_71:
+        stack.push(199);
+        goto e199_71;
+    case 73:
+    e160_72:
+        stack.push(199);
+        goto e199_72;
+    case 74:
+    e160_73:
+        stack.push(199);
+        goto e199_73;
+    case 75:
+    e160_74:
+        stack.push(199);
+        goto e199_74;
+    case 76:
+    e160_75:
+        stack.push(199);
+        goto e199_75;
+    case 78:
+    e160_77:
+        stack.push(199);
+        goto e199_77;
+    case 79:
+    e160_78:
+        stack.push(199);
+        goto e199_78;
+    case 81:
+    e160_80:
+        stack.push(199);
+        goto e199_80;
+    default:
+        errorState = 160;
+        goto error;
+    }
+
+d161:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(3);
+        goto g138_54;
+    case 56:
+        stack.pop(3);
+        goto g138_55;
+    case 59:
+        stack.pop(3);
+        goto g138_58;
+    case 60:
+        stack.pop(3);
+        goto g138_59;
+    case 64:
+        stack.pop(3);
+        goto g138_63;
+    case 66:
+        stack.pop(3);
+        goto g138_65;
+    case 68:
+        stack.pop(3);
+        goto g138_67;
+    case 69:
+        stack.pop(3);
+        goto g138_68;
+    case 70:
+        stack.pop(3);
+        goto g138_69;
+    case 71:
+        stack.pop(3);
+        goto g138_70;
+    case 72:
+        stack.pop(3);
+        goto g138_71;
+    case 73:
+        stack.pop(3);
+        goto g138_72;
+    case 74:
+        stack.pop(3);
+        goto g138_73;
+    case 75:
+        stack.pop(3);
+        goto g138_74;
+    case 76:
+        stack.pop(3);
+        goto g138_75;
+    case 78:
+        stack.pop(3);
+        goto g138_77;
+    case 79:
+        stack.pop(3);
+        goto g138_78;
+    case 81:
+        stack.pop(3);
+        goto g138_80;
+    default:
+        errorState = 161;
+        goto error;
+    }
+
+d162:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e162_54:
+        stack.pop(3);
+        goto g130_54;
+    case 56:
+    e162_55:
+        stack.pop(3);
+        goto g130_55;
+    case 58:
+    e162_57:
+        stack.push(145);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d145;
+    case 59:
+    e162_58:
+        stack.pop(3);
+        goto g130_58;
+    case 60:
+    e162_59:
+        stack.pop(3);
+        goto g130_59;
+    case 64:
+    e162_63:
+        stack.pop(3);
+        goto g130_63;
+    case 66:
+    e162_65:
+        stack.pop(3);
+        goto g130_65;
+    case 68:
+    e162_67:
+        stack.pop(3);
+        goto g130_67;
+    case 69:
+    e162_68:
+        stack.pop(3);
+        goto g130_68;
+    case 70:
+    e162_69:
+        stack.pop(3);
+        goto g130_69;
+    case 71:
+    e162_70:
+        stack.pop(3);
+        goto g130_70;
+    case 72:
+    e162_71:
+        stack.pop(3);
+        goto g130_71;
+    case 73:
+    e162_72:
+        stack.pop(3);
+        goto g130_72;
+    case 74:
+    e162_73:
+        stack.pop(3);
+        goto g130_73;
+    case 75:
+    e162_74:
+        stack.pop(3);
+        goto g130_74;
+    case 76:
+    e162_75:
+        stack.pop(3);
+        goto g130_75;
+    case 78:
+    e162_77:
+        stack.pop(3);
+        goto g130_77;
+    case 79:
+    e162_78:
+        stack.pop(3);
+        goto g130_78;
+    case 81:
+    e162_80:
+        stack.pop(3);
+        goto g130_80;
+    default:
+        errorState = 162;
+        goto error;
+    }
+
+d163:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e163_54:
+        stack.pop(3);
+        goto g130_54;
+    case 56:
+    e163_55:
+        stack.pop(3);
+        goto g130_55;
+    case 58:
+    e163_57:
+        stack.push(145);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d145;
+    case 59:
+    e163_58:
+        stack.pop(3);
+        goto g130_58;
+    case 60:
+    e163_59:
+        stack.pop(3);
+        goto g130_59;
+    case 64:
+    e163_63:
+        stack.pop(3);
+        goto g130_63;
+    case 66:
+    e163_65:
+        stack.pop(3);
+        goto g130_65;
+    case 68:
+    e163_67:
+        stack.pop(3);
+        goto g130_67;
+    case 69:
+    e163_68:
+        stack.pop(3);
+        goto g130_68;
+    case 70:
+    e163_69:
+        stack.pop(3);
+        goto g130_69;
+    case 71:
+    e163_70:
+        stack.pop(3);
+        goto g130_70;
+    case 72:
+    e163_71:
+        stack.pop(3);
+        goto g130_71;
+    case 73:
+    e163_72:
+        stack.pop(3);
+        goto g130_72;
+    case 74:
+    e163_73:
+        stack.pop(3);
+        goto g130_73;
+    case 75:
+    e163_74:
+        stack.pop(3);
+        goto g130_74;
+    case 76:
+    e163_75:
+        stack.pop(3);
+        goto g130_75;
+    case 78:
+    e163_77:
+        stack.pop(3);
+        goto g130_77;
+    case 79:
+    e163_78:
+        stack.pop(3);
+        goto g130_78;
+    case 81:
+    e163_80:
+        stack.pop(3);
+        goto g130_80;
+    default:
+        errorState = 163;
+        goto error;
+    }
+
+d164:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e164_0:
+        stack.pop(4);
+        goto g102_0;
+    case 2:
+    e164_1:
+        stack.pop(4);
+        goto g102_1;
+    case 3:
+    e164_2:
+        stack.pop(4);
+        goto g102_2;
+    case 4:
+    e164_3:
+        stack.pop(4);
+        goto g102_3;
+    case 10:
+    e164_9:
+        stack.pop(4);
+        goto g102_9;
+    case 11:
+    e164_10:
+        stack.pop(4);
+        goto g102_10;
+    case 12:
+    e164_11:
+        stack.pop(4);
+        goto g102_11;
+    case 13:
+    e164_12:
+        stack.pop(4);
+        goto g102_12;
+    case 14:
+    e164_13:
+        stack.pop(4);
+        goto g102_13;
+    case 15:
+    e164_14:
+        stack.pop(4);
+        goto g102_14;
+    case 16:
+    e164_15:
+        stack.pop(4);
+        goto g102_15;
+    case 17:
+    e164_16:
+        stack.pop(4);
+        goto g102_16;
+    case 18:
+    e164_17:
+        stack.pop(4);
+        goto g102_17;
+    case 19:
+    e164_18:
+        stack.pop(4);
+        goto g102_18;
+    case 22:
+    e164_21:
+        stack.pop(4);
+        goto g102_21;
+    case 30:
+    e164_29:
+        stack.pop(4);
+        goto g102_29;
+    case 52:
+    e164_51:
+        stack.pop(4);
+        goto g102_51;
+    case 53:
+    e164_52:
+        stack.pop(4);
+        goto g102_52;
+    case 61:
+    e164_60:
+        stack.pop(4);
+        goto g102_60;
+    case 62:
+    e164_61:
+        stack.pop(4);
+        goto g102_61;
+    case 64:
+    e164_63:
+        stack.pop(4);
+        goto g102_63;
+    case 65:
+    e164_64:
+        stack.pop(4);
+        goto g102_64;
+    case 66:
+    e164_65:
+        stack.pop(4);
+        goto g102_65;
+    case 67:
+    e164_66:
+        stack.pop(4);
+        goto g102_66;
+    case 80:
+    e164_79:
+        stack.pop(4);
+        goto g102_79;
+    case 87:
+    e164_86:
+        stack.pop(4);
+        goto g102_86;
+    case 88:
+    e164_87:
+        stack.pop(4);
+        goto g102_87;
+    case 89:
+    e164_88:
+        stack.pop(4);
+        goto g102_88;
+    case 90:
+    e164_89:
+        stack.pop(4);
+        goto g102_89;
+    case 91:
+    e164_90:
+        stack.pop(4);
+        goto g102_90;
+    case 92:
+    e164_91:
+        stack.pop(4);
+        goto g102_91;
+    case 93:
+    e164_92:
+        stack.pop(4);
+        goto g102_92;
+    default:
+        errorState = 164;
+        goto error;
+    }
+
+d165:
+    switch (currentToken.getId())
+    {
+    case 2:
+        stack.push(14);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d14;
+    case 3:
+        stack.push(15);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d15;
+    case 10:
+        stack.push(18);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d18;
+    case 11:
+        stack.push(16);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d16;
+    case 14:
+        stack.push(17);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d17;
+    case 17:
+        stack.push(20);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d20;
+    case 18:
+        stack.push(19);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d19;
+    case 60:
+        stack.push(201);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d201;
+    default:
+        errorState = 165;
+        goto error;
+    }
+
+d166:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_0;
+    case 2:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_1;
+    case 3:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_2;
+    case 4:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_3;
+    case 10:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_9;
+    case 11:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_10;
+    case 12:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_11;
+    case 13:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_12;
+    case 14:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_13;
+    case 15:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_14;
+    case 16:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_15;
+    case 17:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_16;
+    case 18:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_17;
+    case 19:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_18;
+    case 22:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_21;
+    case 30:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_29;
+    case 52:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_51;
+    case 53:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_52;
+    case 55:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 204;
+        goto error;
+    case 61:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_60;
+    case 62:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_61;
+    case 63:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 204;
+        goto error;
+    case 64:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_63;
+    case 65:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_64;
+    case 66:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_65;
+    case 67:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_66;
+    case 80:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_79;
+    case 87:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_86;
+    case 88:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_87;
+    case 89:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_88;
+    case 90:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_89;
+    case 91:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_90;
+    case 92:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_91;
+    case 93:
+        stack.push(204);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e204_92;
+    default:
+        errorState = 166;
+        goto error;
+    }
+
+d167:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(207);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d207;
+    default:
+        errorState = 167;
+        goto error;
+    }
+
+d168:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 168;
+        goto error;
+    }
+
+d169:
+    switch (currentToken.getId())
+    {
+    case 2:
+        stack.push(14);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d14;
+    case 3:
+        stack.push(15);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d15;
+    case 10:
+        stack.push(18);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d18;
+    case 11:
+        stack.push(16);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d16;
+    case 14:
+        stack.push(17);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d17;
+    case 17:
+        stack.push(20);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d20;
+    case 18:
+        stack.push(19);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d19;
+    case 60:
+        stack.push(210);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d210;
+    default:
+        errorState = 169;
+        goto error;
+    }
+
+d170:
+    switch (currentToken.getId())
+    {
+    case 62:
+        stack.push(28);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d28;
+    default:
+        errorState = 170;
+        goto error;
+    }
+
+d171:
+    switch (currentToken.getId())
+    {
+    case 62:
+        stack.push(28);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d28;
+    default:
+        errorState = 171;
+        goto error;
+    }
+
+d172:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 172;
+        goto error;
+    }
+
+d173:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e173_92:
+        stack.push(216);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d216;
+    default:
+        errorState = 173;
+        goto error;
+    }
+
+d174:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 174;
+        goto error;
+    }
+
+d175:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e175_54:
+        stack.pop(2);
+        goto g115_54;
+    case 56:
+    e175_55:
+        stack.pop(2);
+        goto g138_55;
+    case 58:
+        stack.push(145);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d145;
+    case 59:
+    e175_58:
+        stack.pop(2);
+        goto g138_58;
+    case 60:
+    e175_59:
+        stack.pop(2);
+        goto g138_59;
+    case 64:
+    e175_63:
+        stack.pop(2);
+        goto g138_63;
+    case 66:
+    e175_65:
+        stack.pop(2);
+        goto g138_65;
+    case 68:
+    e175_67:
+        stack.pop(2);
+        goto g138_67;
+    case 69:
+    e175_68:
+        stack.pop(2);
+        goto g138_68;
+    case 70:
+    e175_69:
+        stack.pop(2);
+        goto g138_69;
+    case 71:
+    e175_70:
+        stack.pop(2);
+        goto g138_70;
+    case 72:
+    e175_71:
+        stack.pop(2);
+        goto g138_71;
+    case 73:
+    e175_72:
+        stack.pop(2);
+        goto g138_72;
+    case 74:
+    e175_73:
+        stack.pop(2);
+        goto g138_73;
+    case 75:
+    e175_74:
+        stack.pop(2);
+        goto g138_74;
+    case 76:
+    e175_75:
+        stack.pop(2);
+        goto g138_75;
+    case 77:
+    e175_76:
+        stack.pop(2);
+        goto g115_76;
+    case 78:
+    e175_77:
+        stack.pop(2);
+        goto g138_77;
+    case 79:
+    e175_78:
+        stack.pop(2);
+        goto g138_78;
+    case 81:
+    e175_80:
+        stack.pop(2);
+        goto g138_80;
+    case 82:
+    e175_81:
+        stack.pop(2);
+        goto g115_81;
+    default:
+        errorState = 175;
+        goto error;
+    }
+
+d176:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 176;
+        goto error;
+    }
+
+d177:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 177;
+        goto error;
+    }
+
+d178:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e178_54:
+        stack.pop(3);
+        goto g125_54;
+    default:
+        errorState = 178;
+        goto error;
+    }
+
+d179:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(124);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d124;
+    default:
+        errorState = 179;
+        goto error;
+    }
+
+d180:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e180_54:
+        stack.pop(2);
+        goto g115_54;
+    case 77:
+    e180_76:
+        stack.pop(2);
+        goto g115_76;
+    case 82:
+    e180_81:
+        stack.pop(2);
+        goto g115_81;
+    default:
+        errorState = 180;
+        goto error;
+    }
+
+d181:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e181_54:
+        stack.pop(3);
+        goto g140_54;
+    default:
+        errorState = 181;
+        goto error;
+    }
+
+d182:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_0;
+    case 2:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_1;
+    case 3:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_2;
+    case 4:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_3;
+    case 6:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_5;
+    case 10:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_9;
+    case 11:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_10;
+    case 12:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_11;
+    case 13:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_12;
+    case 14:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_13;
+    case 15:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_14;
+    case 16:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_15;
+    case 17:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_16;
+    case 18:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_17;
+    case 19:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_18;
+    case 22:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_21;
+    case 30:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_29;
+    case 52:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_51;
+    case 53:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_52;
+    case 61:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_60;
+    case 62:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_61;
+    case 63:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_62;
+    case 64:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_63;
+    case 65:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_64;
+    case 66:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_65;
+    case 67:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_66;
+    case 80:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_79;
+    case 87:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_86;
+    case 88:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_87;
+    case 89:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_88;
+    case 90:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_89;
+    case 91:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_90;
+    case 92:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_91;
+    case 93:
+        stack.push(221);
+        semanticAnalyser->executeAction(6, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e221_92;
+    default:
+        errorState = 182;
+        goto error;
+    }
+
+d183:
+    switch (currentToken.getId())
+    {
+    case 2:
+    e183_1:
+        stack.pop(2);
+        goto g112_1;
+    case 3:
+    e183_2:
+        stack.pop(2);
+        goto g112_2;
+    case 4:
+    e183_3:
+        stack.pop(2);
+        goto g112_3;
+    case 10:
+    e183_9:
+        stack.pop(2);
+        goto g112_9;
+    case 11:
+    e183_10:
+        stack.pop(2);
+        goto g112_10;
+    case 12:
+    e183_11:
+        stack.pop(2);
+        goto g112_11;
+    case 13:
+    e183_12:
+        stack.pop(2);
+        goto g112_12;
+    case 14:
+    e183_13:
+        stack.pop(2);
+        goto g112_13;
+    case 15:
+    e183_14:
+        stack.pop(2);
+        goto g112_14;
+    case 16:
+    e183_15:
+        stack.pop(2);
+        goto g112_15;
+    case 17:
+    e183_16:
+        stack.pop(2);
+        goto g112_16;
+    case 18:
+    e183_17:
+        stack.pop(2);
+        goto g112_17;
+    case 19:
+    e183_18:
+        stack.pop(2);
+        goto g112_18;
+    case 22:
+    e183_21:
+        stack.pop(2);
+        goto g112_21;
+    case 52:
+    e183_51:
+        stack.pop(2);
+        goto g112_51;
+    case 53:
+    e183_52:
+        stack.pop(2);
+        goto g112_52;
+    case 61:
+    e183_60:
+        stack.pop(2);
+        goto g112_60;
+    case 62:
+    e183_61:
+        stack.pop(2);
+        goto g112_61;
+    case 63:
+    e183_62:
+        stack.pop(2);
+        goto g112_62;
+    case 64:
+    e183_63:
+        stack.pop(2);
+        goto g112_63;
+    case 65:
+    e183_64:
+        stack.pop(2);
+        goto g112_64;
+    case 66:
+    e183_65:
+        stack.pop(2);
+        goto g112_65;
+    case 67:
+    e183_66:
+        stack.pop(2);
+        goto g112_66;
+    case 80:
+    e183_79:
+        stack.pop(2);
+        goto g112_79;
+    case 87:
+    e183_86:
+        stack.pop(2);
+        goto g112_86;
+    case 88:
+    e183_87:
+        stack.pop(2);
+        goto g112_87;
+    case 89:
+    e183_88:
+        stack.pop(2);
+        goto g112_88;
+    case 90:
+    e183_89:
+        stack.pop(2);
+        goto g112_89;
+    case 91:
+    e183_90:
+        stack.pop(2);
+        goto g112_90;
+    case 92:
+    e183_91:
+        stack.pop(2);
+        goto g112_91;
+    case 93:
+    e183_92:
+        stack.pop(2);
+        goto g112_92;
+    default:
+        errorState = 183;
+        goto error;
+    }
+
+d184:
+    switch (currentToken.getId())
+    {
+    case 2:
+        stack.pop(2);
+        goto g113_1;
+    case 3:
+        stack.pop(2);
+        goto g113_2;
+    case 4:
+        stack.pop(2);
+        goto g113_3;
+    case 10:
+        stack.pop(2);
+        goto g113_9;
+    case 11:
+        stack.pop(2);
+        goto g113_10;
+    case 12:
+        stack.pop(2);
+        goto g113_11;
+    case 13:
+        stack.pop(2);
+        goto g113_12;
+    case 14:
+        stack.pop(2);
+        goto g113_13;
+    case 15:
+        stack.pop(2);
+        goto g113_14;
+    case 16:
+        stack.pop(2);
+        goto g113_15;
+    case 17:
+        stack.pop(2);
+        goto g113_16;
+    case 18:
+        stack.pop(2);
+        goto g113_17;
+    case 19:
+        stack.pop(2);
+        goto g113_18;
+    case 22:
+        stack.pop(2);
+        goto g113_21;
+    case 52:
+        stack.pop(2);
+        goto g113_51;
+    case 53:
+        stack.pop(2);
+        goto g113_52;
+    case 61:
+        stack.pop(2);
+        goto g113_60;
+    case 62:
+        stack.pop(2);
+        goto g113_61;
+    case 63:
+        stack.pop(2);
+        goto g113_62;
+    case 64:
+        stack.pop(2);
+        goto g113_63;
+    case 65:
+        stack.pop(2);
+        goto g113_64;
+    case 66:
+        stack.pop(2);
+        goto g113_65;
+    case 67:
+        stack.pop(2);
+        goto g113_66;
+    case 80:
+        stack.pop(2);
+        goto g113_79;
+    case 87:
+        stack.pop(2);
+        goto g113_86;
+    case 88:
+        stack.pop(2);
+        goto g113_87;
+    case 89:
+        stack.pop(2);
+        goto g113_88;
+    case 90:
+        stack.pop(2);
+        goto g113_89;
+    case 91:
+        stack.pop(2);
+        goto g113_90;
+    case 92:
+        stack.pop(2);
+        goto g113_91;
+    case 93:
+        stack.pop(2);
+        goto g113_92;
+    default:
+        errorState = 184;
+        goto error;
+    }
+
+d185:
+    switch (currentToken.getId())
+    {
+    case 2:
+        stack.pop(2);
+        goto g113_1;
+    case 3:
+        stack.pop(2);
+        goto g113_2;
+    case 4:
+        stack.pop(2);
+        goto g113_3;
+    case 10:
+        stack.pop(2);
+        goto g113_9;
+    case 11:
+        stack.pop(2);
+        goto g113_10;
+    case 12:
+        stack.pop(2);
+        goto g113_11;
+    case 13:
+        stack.pop(2);
+        goto g113_12;
+    case 14:
+        stack.pop(2);
+        goto g113_13;
+    case 15:
+        stack.pop(2);
+        goto g113_14;
+    case 16:
+        stack.pop(2);
+        goto g113_15;
+    case 17:
+        stack.pop(2);
+        goto g113_16;
+    case 18:
+        stack.pop(2);
+        goto g113_17;
+    case 19:
+        stack.pop(2);
+        goto g113_18;
+    case 22:
+        stack.pop(2);
+        goto g113_21;
+    case 52:
+        stack.pop(2);
+        goto g113_51;
+    case 53:
+        stack.pop(2);
+        goto g113_52;
+    case 61:
+        stack.pop(2);
+        goto g113_60;
+    case 62:
+        stack.pop(2);
+        goto g113_61;
+    case 63:
+        stack.pop(2);
+        goto g113_62;
+    case 64:
+        stack.pop(2);
+        goto g113_63;
+    case 65:
+        stack.pop(2);
+        goto g113_64;
+    case 66:
+        stack.pop(2);
+        goto g113_65;
+    case 67:
+        stack.pop(2);
+        goto g113_66;
+    case 80:
+        stack.pop(2);
+        goto g113_79;
+    case 87:
+        stack.pop(2);
+        goto g113_86;
+    case 88:
+        stack.pop(2);
+        goto g113_87;
+    case 89:
+        stack.pop(2);
+        goto g113_88;
+    case 90:
+        stack.pop(2);
+        goto g113_89;
+    case 91:
+        stack.pop(2);
+        goto g113_90;
+    case 92:
+        stack.pop(2);
+        goto g113_91;
+    case 93:
+        stack.pop(2);
+        goto g113_92;
+    default:
+        errorState = 185;
+        goto error;
+    }
+
+d186:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e186_92:
+        stack.push(207);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d207;
+    default:
+        errorState = 186;
+        goto error;
+    }
+
+d187:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 187;
+        goto error;
+    }
+
+d188:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(4);
+        goto g99_54;
+    case 56:
+        stack.pop(4);
+        goto g99_55;
+    case 59:
+        stack.pop(4);
+        goto g99_58;
+    case 60:
+        stack.pop(4);
+        goto g99_59;
+    case 64:
+        stack.pop(4);
+        goto g99_63;
+    case 66:
+        stack.pop(4);
+        goto g99_65;
+    case 68:
+        stack.pop(4);
+        goto g99_67;
+    case 69:
+        stack.pop(4);
+        goto g99_68;
+    case 70:
+        stack.pop(4);
+        goto g99_69;
+    case 71:
+        stack.pop(4);
+        goto g99_70;
+    case 72:
+        stack.pop(4);
+        goto g99_71;
+    case 73:
+        stack.pop(4);
+        goto g99_72;
+    case 74:
+        stack.pop(4);
+        goto g99_73;
+    case 75:
+        stack.pop(4);
+        goto g99_74;
+    case 76:
+        stack.pop(4);
+        goto g99_75;
+    case 78:
+        stack.pop(4);
+        goto g99_77;
+    case 79:
+        stack.pop(4);
+        goto g99_78;
+    case 81:
+        stack.pop(4);
+        goto g99_80;
+    default:
+        errorState = 188;
+        goto error;
+    }
+
+d189:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(144);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d144;
+    default:
+        errorState = 189;
+        goto error;
+    }
+
+d190:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 190;
+        goto error;
+    }
+
+d191:
+    switch (currentToken.getId())
+    {
+    case 59:
+    e191_58:
+        stack.push(226);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d226;
+    default:
+        errorState = 191;
+        goto error;
+    }
+
+d192:
+    switch (currentToken.getId())
+    {
+    case 59:
+    e192_58:
+        stack.pop(1);
+        goto g103_58;
+    default:
+        errorState = 192;
+        goto error;
+    }
+
+d193:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e193_54:
+        stack.pop(3);
+        goto g129_54;
+    case 56:
+    e193_55:
+        stack.pop(3);
+        goto g129_55;
+    case 59:
+    e193_58:
+        stack.pop(3);
+        goto g129_58;
+    case 60:
+    e193_59:
+        stack.pop(3);
+        goto g129_59;
+    case 81:
+    e193_80:
+        stack.pop(3);
+        goto g129_80;
+    default:
+        errorState = 193;
+        goto error;
+    }
+
+d194:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e194_54:
+        stack.pop(3);
+        goto g129_54;
+    case 56:
+    e194_55:
+        stack.pop(3);
+        goto g129_55;
+    case 59:
+    e194_58:
+        stack.pop(3);
+        goto g129_58;
+    case 60:
+    e194_59:
+        stack.pop(3);
+        goto g129_59;
+    case 81:
+    e194_80:
+        stack.pop(3);
+        goto g129_80;
+    default:
+        errorState = 194;
+        goto error;
+    }
+
+d195:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e195_54:
+        stack.pop(3);
+        goto g134_54;
+    case 56:
+    e195_55:
+        stack.pop(3);
+        goto g134_55;
+    case 59:
+    e195_58:
+        stack.pop(3);
+        goto g134_58;
+    case 60:
+    e195_59:
+        stack.pop(3);
+        goto g134_59;
+    case 71:
+    e195_70:
+        stack.pop(3);
+        goto g134_70;
+    case 72:
+    e195_71:
+        stack.pop(3);
+        goto g134_71;
+    case 73:
+    e195_72:
+        stack.pop(3);
+        goto g134_72;
+    case 74:
+    e195_73:
+        stack.pop(3);
+        goto g134_73;
+    case 75:
+    e195_74:
+        stack.pop(3);
+        goto g134_74;
+    case 76:
+    e195_75:
+        stack.pop(3);
+        goto g134_75;
+    case 78:
+    e195_77:
+        stack.pop(3);
+        goto g134_77;
+    case 79:
+    e195_78:
+        stack.pop(3);
+        goto g134_78;
+    case 81:
+    e195_80:
+        stack.pop(3);
+        goto g134_80;
+    default:
+        errorState = 195;
+        goto error;
+    }
+
+d196:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e196_54:
+        stack.pop(3);
+        goto g134_54;
+    case 56:
+    e196_55:
+        stack.pop(3);
+        goto g134_55;
+    case 59:
+    e196_58:
+        stack.pop(3);
+        goto g134_58;
+    case 60:
+    e196_59:
+        stack.pop(3);
+        goto g134_59;
+    case 71:
+    e196_70:
+        stack.pop(3);
+        goto g134_70;
+    case 72:
+    e196_71:
+        stack.pop(3);
+        goto g134_71;
+    case 73:
+    e196_72:
+        stack.pop(3);
+        goto g134_72;
+    case 74:
+    e196_73:
+        stack.pop(3);
+        goto g134_73;
+    case 75:
+    e196_74:
+        stack.pop(3);
+        goto g134_74;
+    case 76:
+    e196_75:
+        stack.pop(3);
+        goto g134_75;
+    case 78:
+    e196_77:
+        stack.pop(3);
+        goto g134_77;
+    case 79:
+    e196_78:
+        stack.pop(3);
+        goto g134_78;
+    case 81:
+    e196_80:
+        stack.pop(3);
+        goto g134_80;
+    default:
+        errorState = 196;
+        goto error;
+    }
+
+d197:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e197_54:
+        stack.pop(3);
+        goto g136_54;
+    case 56:
+    e197_55:
+        stack.pop(3);
+        goto g136_55;
+    case 59:
+    e197_58:
+        stack.pop(3);
+        goto g136_58;
+    case 60:
+    e197_59:
+        stack.pop(3);
+        goto g136_59;
+    case 64:
+    e197_63:
+        stack.pop(3);
+        goto g136_63;
+    case 66:
+    e197_65:
+        stack.pop(3);
+        goto g136_65;
+    case 71:
+    e197_70:
+        stack.pop(3);
+        goto g136_70;
+    case 72:
+    e197_71:
+        stack.pop(3);
+        goto g136_71;
+    case 73:
+    e197_72:
+        stack.pop(3);
+        goto g136_72;
+    case 74:
+    e197_73:
+        stack.pop(3);
+        goto g136_73;
+    case 75:
+    e197_74:
+        stack.pop(3);
+        goto g136_74;
+    case 76:
+    e197_75:
+        stack.pop(3);
+        goto g136_75;
+    case 78:
+    e197_77:
+        stack.pop(3);
+        goto g136_77;
+    case 79:
+    e197_78:
+        stack.pop(3);
+        goto g136_78;
+    case 81:
+    e197_80:
+        stack.pop(3);
+        goto g136_80;
+    default:
+        errorState = 197;
+        goto error;
+    }
+
+d198:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e198_54:
+        stack.pop(3);
+        goto g136_54;
+    case 56:
+    e198_55:
+        stack.pop(3);
+        goto g136_55;
+    case 59:
+    e198_58:
+        stack.pop(3);
+        goto g136_58;
+    case 60:
+    e198_59:
+        stack.pop(3);
+        goto g136_59;
+    case 64:
+    e198_63:
+        stack.pop(3);
+        goto g136_63;
+    case 66:
+    e198_65:
+        stack.pop(3);
+        goto g136_65;
+    case 71:
+    e198_70:
+        stack.pop(3);
+        goto g136_70;
+    case 72:
+    e198_71:
+        stack.pop(3);
+        goto g136_71;
+    case 73:
+    e198_72:
+        stack.pop(3);
+        goto g136_72;
+    case 74:
+    e198_73:
+        stack.pop(3);
+        goto g136_73;
+    case 75:
+    e198_74:
+        stack.pop(3);
+        goto g136_74;
+    case 76:
+    e198_75:
+        stack.pop(3);
+        goto g136_75;
+    case 78:
+    e198_77:
+        stack.pop(3);
+        goto g136_77;
+    case 79:
+    e198_78:
+        stack.pop(3);
+        goto g136_78;
+    case 81:
+    e198_80:
+        stack.pop(3);
+        goto g136_80;
+    default:
+        errorState = 198;
+        goto error;
+    }
+
+d199:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e199_54:
+        stack.pop(3);
+        goto g136_54;
+    case 56:
+    e199_55:
+        stack.pop(3);
+        goto g136_55;
+    case 59:
+    e199_58:
+        stack.pop(3);
+        goto g136_58;
+    case 60:
+    e199_59:
+        stack.pop(3);
+        goto g136_59;
+    case 64:
+    e199_63:
+        stack.pop(3);
+        goto g136_63;
+    case 66:
+    e199_65:
+        stack.pop(3);
+        goto g136_65;
+    case 71:
+    e199_70:
+        stack.pop(3);
+        goto g136_70;
+    case 72:
+    e199_71:
+        stack.pop(3);
+        goto g136_71;
+    case 73:
+    e199_72:
+        stack.pop(3);
+        goto g136_72;
+    case 74:
+    e199_73:
+        stack.pop(3);
+        goto g136_73;
+    case 75:
+    e199_74:
+        stack.pop(3);
+        goto g136_74;
+    case 76:
+    e199_75:
+        stack.pop(3);
+        goto g136_75;
+    case 78:
+    e199_77:
+        stack.pop(3);
+        goto g136_77;
+    case 79:
+    e199_78:
+        stack.pop(3);
+        goto g136_78;
+    case 81:
+    e199_80:
+        stack.pop(3);
+        goto g136_80;
+    default:
+        errorState = 199;
+        goto error;
+    }
+
+d200:
+    switch (currentToken.getId())
+    {
+    case 56:
+    e200_55:
+        stack.push(228);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d228;
+    case 60:
+    e200_59:
+        stack.push(227);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d227;
+    default:
+        errorState = 200;
+        goto error;
+    }
+
+d201:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 2:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 3:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 4:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 10:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 11:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 12:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 13:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 14:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 15:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 16:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 17:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 18:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 19:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 22:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 30:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 52:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 53:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 55:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 61:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 62:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e229_61;
+    case 63:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 64:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 65:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 66:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 67:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 80:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 87:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 88:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 89:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 90:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 91:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 92:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    case 93:
+        stack.push(229);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 229;
+        goto error;
+    default:
+        errorState = 201;
+        goto error;
+    }
+
+d202:
+    switch (currentToken.getId())
+    {
+    case 56:
+    e202_55:
+        stack.pop(1);
+        goto g109_55;
+    case 60:
+    e202_59:
+        stack.pop(1);
+        goto g109_59;
+    default:
+        errorState = 202;
+        goto error;
+    }
+
+d203:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e203_92:
+        stack.push(230);
+        semanticAnalyser->executeAction(1, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e230_92;
+    default:
+        errorState = 203;
+        goto error;
+    }
+
+d204:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e204_0:
+        stack.pop(2);
+        goto g104_0;
+    case 2:
+    e204_1:
+        stack.pop(2);
+        goto g104_1;
+    case 3:
+    e204_2:
+        stack.pop(2);
+        goto g104_2;
+    case 4:
+    e204_3:
+        stack.pop(2);
+        goto g104_3;
+    case 10:
+    e204_9:
+        stack.pop(2);
+        goto g104_9;
+    case 11:
+    e204_10:
+        stack.pop(2);
+        goto g104_10;
+    case 12:
+    e204_11:
+        stack.pop(2);
+        goto g104_11;
+    case 13:
+    e204_12:
+        stack.pop(2);
+        goto g104_12;
+    case 14:
+    e204_13:
+        stack.pop(2);
+        goto g104_13;
+    case 15:
+    e204_14:
+        stack.pop(2);
+        goto g104_14;
+    case 16:
+    e204_15:
+        stack.pop(2);
+        goto g104_15;
+    case 17:
+    e204_16:
+        stack.pop(2);
+        goto g104_16;
+    case 18:
+    e204_17:
+        stack.pop(2);
+        goto g104_17;
+    case 19:
+    e204_18:
+        stack.pop(2);
+        goto g104_18;
+    case 22:
+    e204_21:
+        stack.pop(2);
+        goto g104_21;
+    case 30:
+    e204_29:
+        stack.pop(2);
+        goto g104_29;
+    case 52:
+    e204_51:
+        stack.pop(2);
+        goto g104_51;
+    case 53:
+    e204_52:
+        stack.pop(2);
+        goto g104_52;
+    case 61:
+    e204_60:
+        stack.pop(2);
+        goto g104_60;
+    case 62:
+    e204_61:
+        stack.pop(2);
+        goto g104_61;
+    case 64:
+    e204_63:
+        stack.pop(2);
+        goto g104_63;
+    case 65:
+    e204_64:
+        stack.pop(2);
+        goto g104_64;
+    case 66:
+    e204_65:
+        stack.pop(2);
+        goto g104_65;
+    case 67:
+    e204_66:
+        stack.pop(2);
+        goto g104_66;
+    case 80:
+    e204_79:
+        stack.pop(2);
+        goto g104_79;
+    case 87:
+    e204_86:
+        stack.pop(2);
+        goto g104_86;
+    case 88:
+    e204_87:
+        stack.pop(2);
+        goto g104_87;
+    case 89:
+    e204_88:
+        stack.pop(2);
+        goto g104_88;
+    case 90:
+    e204_89:
+        stack.pop(2);
+        goto g104_89;
+    case 91:
+    e204_90:
+        stack.pop(2);
+        goto g104_90;
+    case 92:
+    e204_91:
+        stack.pop(2);
+        goto g104_91;
+    case 93:
+    e204_92:
+        stack.pop(2);
+        goto g104_92;
+    default:
+        errorState = 204;
+        goto error;
+    }
+
+d205:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e205_54:
+        stack.push(231);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d231;
+    case 56:
+    e205_55:
+        stack.push(232);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d232;
+    default:
+        errorState = 205;
+        goto error;
+    }
+
+d206:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e206_54:
+        stack.push(233);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e233_54;
+    case 56:
+    e206_55:
+        stack.push(233);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e233_55;
+    case 58:
+        stack.push(233);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 233;
+        goto error;
+    case 60:
+        stack.push(233);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 233;
+        goto error;
+    case 77:
+        stack.push(233);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 233;
+        goto error;
+    default:
+        errorState = 206;
+        goto error;
+    }
+
+d207:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(234);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e234_54;
+    case 56:
+        stack.push(234);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e234_55;
+    case 58:
+        stack.push(234);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e234_57;
+    case 60:
+        stack.push(234);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 234;
+        goto error;
+    case 77:
+        stack.push(234);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e234_76;
+    default:
+        errorState = 207;
+        goto error;
+    }
+
+d208:
+    switch (currentToken.getId())
+    {
+    case 59:
+    e208_58:
+        stack.push(235);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d235;
+    default:
+        errorState = 208;
+        goto error;
+    }
+
+d209:
+    switch (currentToken.getId())
+    {
+    case 56:
+    e209_55:
+        stack.push(228);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d228;
+    case 60:
+    e209_59:
+        stack.push(236);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d236;
+    default:
+        errorState = 209;
+        goto error;
+    }
+
+d210:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 2:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 3:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 4:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 10:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 11:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 12:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 13:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 14:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 15:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 16:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 17:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 18:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 19:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 22:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 30:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 52:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 53:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 55:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 61:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 62:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e237_61;
+    case 63:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 64:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 65:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 66:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 67:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 80:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 87:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 88:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 89:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 90:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 91:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 92:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    case 93:
+        stack.push(237);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 237;
+        goto error;
+    default:
+        errorState = 210;
+        goto error;
+    }
+
+d211:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e211_0:
+        stack.pop(5);
+        goto g116_0;
+    case 2:
+    e211_1:
+        stack.pop(5);
+        goto g116_1;
+    case 3:
+    e211_2:
+        stack.pop(5);
+        goto g116_2;
+    case 4:
+    e211_3:
+        stack.pop(5);
+        goto g116_3;
+    case 6:
+    e211_5:
+        stack.push(238);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d238;
+    case 10:
+    e211_9:
+        stack.pop(5);
+        goto g116_9;
+    case 11:
+    e211_10:
+        stack.pop(5);
+        goto g116_10;
+    case 12:
+    e211_11:
+        stack.pop(5);
+        goto g116_11;
+    case 13:
+    e211_12:
+        stack.pop(5);
+        goto g116_12;
+    case 14:
+    e211_13:
+        stack.pop(5);
+        goto g116_13;
+    case 15:
+    e211_14:
+        stack.pop(5);
+        goto g116_14;
+    case 16:
+    e211_15:
+        stack.pop(5);
+        goto g116_15;
+    case 17:
+    e211_16:
+        stack.pop(5);
+        goto g116_16;
+    case 18:
+    e211_17:
+        stack.pop(5);
+        goto g116_17;
+    case 19:
+    e211_18:
+        stack.pop(5);
+        goto g116_18;
+    case 22:
+    e211_21:
+        stack.pop(5);
+        goto g116_21;
+    case 30:
+    e211_29:
+        stack.pop(5);
+        goto g116_29;
+    case 52:
+    e211_51:
+        stack.pop(5);
+        goto g116_51;
+    case 53:
+    e211_52:
+        stack.pop(5);
+        goto g116_52;
+    case 61:
+    e211_60:
+        stack.pop(5);
+        goto g116_60;
+    case 62:
+    e211_61:
+        stack.pop(5);
+        goto g116_61;
+    case 63:
+    e211_62:
+        stack.pop(5);
+        goto g116_62;
+    case 64:
+    e211_63:
+        stack.pop(5);
+        goto g116_63;
+    case 65:
+    e211_64:
+        stack.pop(5);
+        goto g116_64;
+    case 66:
+    e211_65:
+        stack.pop(5);
+        goto g116_65;
+    case 67:
+    e211_66:
+        stack.pop(5);
+        goto g116_66;
+    case 80:
+    e211_79:
+        stack.pop(5);
+        goto g116_79;
+    case 87:
+    e211_86:
+        stack.pop(5);
+        goto g116_86;
+    case 88:
+    e211_87:
+        stack.pop(5);
+        goto g116_87;
+    case 89:
+    e211_88:
+        stack.pop(5);
+        goto g116_88;
+    case 90:
+    e211_89:
+        stack.pop(5);
+        goto g116_89;
+    case 91:
+    e211_90:
+        stack.pop(5);
+        goto g116_90;
+    case 92:
+    e211_91:
+        stack.pop(5);
+        goto g116_91;
+    case 93:
+    e211_92:
+        stack.pop(5);
+        goto g116_92;
+    default:
+        errorState = 211;
+        goto error;
+    }
+
+d212:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e212_0:
+        stack.pop(5);
+        goto g117_0;
+    case 2:
+    e212_1:
+        stack.pop(5);
+        goto g117_1;
+    case 3:
+    e212_2:
+        stack.pop(5);
+        goto g117_2;
+    case 4:
+    e212_3:
+        stack.pop(5);
+        goto g117_3;
+    case 10:
+    e212_9:
+        stack.pop(5);
+        goto g117_9;
+    case 11:
+    e212_10:
+        stack.pop(5);
+        goto g117_10;
+    case 12:
+    e212_11:
+        stack.pop(5);
+        goto g117_11;
+    case 13:
+    e212_12:
+        stack.pop(5);
+        goto g117_12;
+    case 14:
+    e212_13:
+        stack.pop(5);
+        goto g117_13;
+    case 15:
+    e212_14:
+        stack.pop(5);
+        goto g117_14;
+    case 16:
+    e212_15:
+        stack.pop(5);
+        goto g117_15;
+    case 17:
+    e212_16:
+        stack.pop(5);
+        goto g117_16;
+    case 18:
+    e212_17:
+        stack.pop(5);
+        goto g117_17;
+    case 19:
+    e212_18:
+        stack.pop(5);
+        goto g117_18;
+    case 22:
+    e212_21:
+        stack.pop(5);
+        goto g117_21;
+    case 30:
+    e212_29:
+        stack.pop(5);
+        goto g117_29;
+    case 52:
+    e212_51:
+        stack.pop(5);
+        goto g117_51;
+    case 53:
+    e212_52:
+        stack.pop(5);
+        goto g117_52;
+    case 61:
+    e212_60:
+        stack.pop(5);
+        goto g117_60;
+    case 62:
+    e212_61:
+        stack.pop(5);
+        goto g117_61;
+    case 63:
+    e212_62:
+        stack.pop(5);
+        goto g117_62;
+    case 64:
+    e212_63:
+        stack.pop(5);
+        goto g117_63;
+    case 65:
+    e212_64:
+        stack.pop(5);
+        goto g117_64;
+    case 66:
+    e212_65:
+        stack.pop(5);
+        goto g117_65;
+    case 67:
+    e212_66:
+        stack.pop(5);
+        goto g117_66;
+    case 80:
+    e212_79:
+        stack.pop(5);
+        goto g117_79;
+    case 87:
+    e212_86:
+        stack.pop(5);
+        goto g117_86;
+    case 88:
+    e212_87:
+        stack.pop(5);
+        goto g117_87;
+    case 89:
+    e212_88:
+        stack.pop(5);
+        goto g117_88;
+    case 90:
+    e212_89:
+        stack.pop(5);
+        goto g117_89;
+    case 91:
+    e212_90:
+        stack.pop(5);
+        goto g117_90;
+    case 92:
+    e212_91:
+        stack.pop(5);
+        goto g117_91;
+    case 93:
+    e212_92:
+        stack.pop(5);
+        goto g117_92;
+    default:
+        errorState = 212;
+        goto error;
+    }
+
+d213:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e213_54:
+        stack.push(239);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d239;
+    default:
+        errorState = 213;
+        goto error;
+    }
+
+d214:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 2:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 3:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 4:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 10:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 11:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 12:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 13:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 14:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 15:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 16:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 17:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 18:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 19:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 22:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 30:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 52:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 53:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 55:
+    e214_54:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e240_54;
+    case 56:
+    e214_55:
+        stack.push(241);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d241;
+    case 61:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 62:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 63:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 64:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 65:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 66:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 67:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 80:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 87:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 88:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 89:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 90:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 91:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 92:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    case 93:
+        stack.push(240);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 240;
+        goto error;
+    default:
+        errorState = 214;
+        goto error;
+    }
+
+d215:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e215_54:
+        stack.push(242);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e242_54;
+    case 56:
+    e215_55:
+        stack.push(242);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e242_55;
+    case 58:
+        stack.push(242);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 242;
+        goto error;
+    case 60:
+        stack.push(242);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 242;
+        goto error;
+    case 77:
+        stack.push(242);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 242;
+        goto error;
+    default:
+        errorState = 215;
+        goto error;
+    }
+
+d216:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(243);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e243_54;
+    case 56:
+        stack.push(243);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e243_55;
+    case 58:
+        stack.push(243);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e243_57;
+    case 60:
+        stack.push(243);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 243;
+        goto error;
+    case 77:
+        stack.push(243);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e243_76;
+    default:
+        errorState = 216;
+        goto error;
+    }
+
+d217:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e217_54:
+        stack.pop(3);
+        goto g118_54;
+    case 60:
+    e217_59:
+        stack.pop(3);
+        goto g118_59;
+    default:
+        errorState = 217;
+        goto error;
+    }
+
+d218:
+    switch (currentToken.getId())
+    {
+    case 59:
+    e218_58:
+        stack.push(244);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d244;
+    default:
+        errorState = 218;
+        goto error;
+    }
+
+d219:
+    switch (currentToken.getId())
+    {
+    case 60:
+    e219_59:
+        stack.push(245);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d245;
+    default:
+        errorState = 219;
+        goto error;
+    }
+
+d220:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e220_54:
+        stack.push(246);
+        goto e246_54;
+    case 82:
+    e220_81:
+        stack.push(179);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d179;
+    default:
+        errorState = 220;
+        goto error;
+    }
+
+d221:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e221_0:
+        stack.pop(5);
+        goto g111_0;
+    case 2:
+    e221_1:
+        stack.pop(5);
+        goto g111_1;
+    case 3:
+    e221_2:
+        stack.pop(5);
+        goto g111_2;
+    case 4:
+    e221_3:
+        stack.pop(5);
+        goto g111_3;
+    case 6:
+    e221_5:
+        stack.pop(5);
+        goto g111_5;
+    case 10:
+    e221_9:
+        stack.pop(5);
+        goto g111_9;
+    case 11:
+    e221_10:
+        stack.pop(5);
+        goto g111_10;
+    case 12:
+    e221_11:
+        stack.pop(5);
+        goto g111_11;
+    case 13:
+    e221_12:
+        stack.pop(5);
+        goto g111_12;
+    case 14:
+    e221_13:
+        stack.pop(5);
+        goto g111_13;
+    case 15:
+    e221_14:
+        stack.pop(5);
+        goto g111_14;
+    case 16:
+    e221_15:
+        stack.pop(5);
+        goto g111_15;
+    case 17:
+    e221_16:
+        stack.pop(5);
+        goto g111_16;
+    case 18:
+    e221_17:
+        stack.pop(5);
+        goto g111_17;
+    case 19:
+    e221_18:
+        stack.pop(5);
+        goto g111_18;
+    case 22:
+    e221_21:
+        stack.pop(5);
+        goto g111_21;
+    case 30:
+    e221_29:
+        stack.pop(5);
+        goto g111_29;
+    case 52:
+    e221_51:
+        stack.pop(5);
+        goto g111_51;
+    case 53:
+    e221_52:
+        stack.pop(5);
+        goto g111_52;
+    case 61:
+    e221_60:
+        stack.pop(5);
+        goto g111_60;
+    case 62:
+    e221_61:
+        stack.pop(5);
+        goto g111_61;
+    case 63:
+    e221_62:
+        stack.pop(5);
+        goto g111_62;
+    case 64:
+    e221_63:
+        stack.pop(5);
+        goto g111_63;
+    case 65:
+    e221_64:
+        stack.pop(5);
+        goto g111_64;
+    case 66:
+    e221_65:
+        stack.pop(5);
+        goto g111_65;
+    case 67:
+    e221_66:
+        stack.pop(5);
+        goto g111_66;
+    case 80:
+    e221_79:
+        stack.pop(5);
+        goto g111_79;
+    case 87:
+    e221_86:
+        stack.pop(5);
+        goto g111_86;
+    case 88:
+    e221_87:
+        stack.pop(5);
+        goto g111_87;
+    case 89:
+    e221_88:
+        stack.pop(5);
+        goto g111_88;
+    case 90:
+    e221_89:
+        stack.pop(5);
+        goto g111_89;
+    case 91:
+    e221_90:
+        stack.pop(5);
+        goto g111_90;
+    case 92:
+    e221_91:
+        stack.pop(5);
+        goto g111_91;
+    case 93:
+    e221_92:
+        stack.pop(5);
+        goto g111_92;
+    default:
+        errorState = 221;
+        goto error;
+    }
+
+d222:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e222_54:
+        stack.push(247);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d247;
+    case 56:
+    e222_55:
+        stack.push(232);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d232;
+    default:
+        errorState = 222;
+        goto error;
+    }
+
+d223:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e223_54:
+        stack.push(248);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d248;
+    default:
+        errorState = 223;
+        goto error;
+    }
+
+d224:
+    switch (currentToken.getId())
+    {
+    case 56:
+    e224_55:
+        stack.pop(3);
+        goto g100_55;
+    case 60:
+    e224_59:
+        stack.pop(3);
+        goto g100_59;
+    default:
+        errorState = 224;
+        goto error;
+    }
+
+d225:
+    switch (currentToken.getId())
+    {
+    case 59:
+    e225_58:
+        stack.push(249);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d249;
+    default:
+        errorState = 225;
+        goto error;
+    }
+
+d226:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(5);
+        goto g139_54;
+    case 56:
+        stack.pop(5);
+        goto g139_55;
+    case 59:
+        stack.pop(5);
+        goto g139_58;
+    case 60:
+        stack.pop(5);
+        goto g139_59;
+    case 64:
+        stack.pop(5);
+        goto g139_63;
+    case 65:
+        stack.pop(5);
+        goto g139_64;
+    case 66:
+        stack.pop(5);
+        goto g139_65;
+    case 67:
+        stack.pop(5);
+        goto g139_66;
+    case 68:
+        stack.pop(5);
+        goto g139_67;
+    case 69:
+        stack.pop(5);
+        goto g139_68;
+    case 70:
+        stack.pop(5);
+        goto g139_69;
+    case 71:
+        stack.pop(5);
+        goto g139_70;
+    case 72:
+        stack.pop(5);
+        goto g139_71;
+    case 73:
+        stack.pop(5);
+        goto g139_72;
+    case 74:
+        stack.pop(5);
+        goto g139_73;
+    case 75:
+        stack.pop(5);
+        goto g139_74;
+    case 76:
+        stack.pop(5);
+        goto g139_75;
+    case 78:
+        stack.pop(5);
+        goto g139_77;
+    case 79:
+        stack.pop(5);
+        goto g139_78;
+    case 81:
+        stack.pop(5);
+        goto g139_80;
+    default:
+        errorState = 226;
+        goto error;
+    }
+
+d227:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 2:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 3:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 4:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 10:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 11:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 12:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 13:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 14:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 15:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 16:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 17:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 18:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 19:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 22:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 30:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 52:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 53:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 55:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 61:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 62:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e250_61;
+    case 63:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 64:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 65:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 66:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 67:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 80:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 87:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 88:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 89:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 90:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 91:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 92:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    case 93:
+        stack.push(250);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 250;
+        goto error;
+    default:
+        errorState = 227;
+        goto error;
+    }
+
+d228:
+    switch (currentToken.getId())
+    {
+    case 2:
+        stack.push(14);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d14;
+    case 3:
+        stack.push(15);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d15;
+    case 10:
+        stack.push(18);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d18;
+    case 11:
+        stack.push(16);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d16;
+    case 14:
+        stack.push(17);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d17;
+    case 17:
+        stack.push(20);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d20;
+    case 18:
+        stack.push(19);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d19;
+    default:
+        errorState = 228;
+        goto error;
+    }
+
+d229:
+    switch (currentToken.getId())
+    {
+    case 62:
+    e229_61:
+        stack.push(28);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d28;
+    default:
+        errorState = 229;
+        goto error;
+    }
+
+d230:
+    switch (currentToken.getId())
+    {
+    case 93:
+    e230_92:
+        stack.push(253);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d253;
+    default:
+        errorState = 230;
+        goto error;
+    }
+
+d231:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_0;
+    case 2:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_1;
+    case 3:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_2;
+    case 4:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_3;
+    case 10:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_9;
+    case 11:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_10;
+    case 12:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_11;
+    case 13:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_12;
+    case 14:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_13;
+    case 15:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_14;
+    case 16:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_15;
+    case 17:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_16;
+    case 18:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_17;
+    case 19:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_18;
+    case 22:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_21;
+    case 30:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_29;
+    case 52:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_51;
+    case 53:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_52;
+    case 55:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 254;
+        goto error;
+    case 61:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_60;
+    case 62:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_61;
+    case 63:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 254;
+        goto error;
+    case 64:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_63;
+    case 65:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_64;
+    case 66:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_65;
+    case 67:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_66;
+    case 80:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_79;
+    case 87:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_86;
+    case 88:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_87;
+    case 89:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_88;
+    case 90:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_89;
+    case 91:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_90;
+    case 92:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_91;
+    case 93:
+        stack.push(254);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e254_92;
+    default:
+        errorState = 231;
+        goto error;
+    }
+
+d232:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(207);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d207;
+    default:
+        errorState = 232;
+        goto error;
+    }
+
+d233:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e233_54:
+        stack.pop(2);
+        goto g107_54;
+    case 56:
+    e233_55:
+        stack.pop(2);
+        goto g107_55;
+    default:
+        errorState = 233;
+        goto error;
+    }
+
+d234:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e234_54:
+        stack.pop(2);
+        goto g108_54;
+    case 56:
+    e234_55:
+        stack.pop(2);
+        goto g108_55;
+    case 58:
+    e234_57:
+        stack.push(257);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d257;
+    case 77:
+    e234_76:
+        stack.push(256);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d256;
+    default:
+        errorState = 234;
+        goto error;
+    }
+
+d235:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(258);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d258;
+    case 56:
+        stack.push(259);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d259;
+    default:
+        errorState = 235;
+        goto error;
+    }
+
+d236:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 2:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 3:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 4:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 10:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 11:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 12:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 13:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 14:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 15:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 16:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 17:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 18:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 19:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 22:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 30:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 52:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 53:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 55:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 61:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 62:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e260_61;
+    case 63:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 64:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 65:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 66:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 67:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 80:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 87:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 88:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 89:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 90:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 91:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 92:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    case 93:
+        stack.push(260);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 260;
+        goto error;
+    default:
+        errorState = 236;
+        goto error;
+    }
+
+d237:
+    switch (currentToken.getId())
+    {
+    case 62:
+    e237_61:
+        stack.push(28);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d28;
+    default:
+        errorState = 237;
+        goto error;
+    }
+
+d238:
+    switch (currentToken.getId())
+    {
+    case 62:
+        stack.push(28);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d28;
+    default:
+        errorState = 238;
+        goto error;
+    }
+
+d239:
+    switch (currentToken.getId())
+    {
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 93:
+        stack.push(266);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d266;
+    default:
+        errorState = 239;
+        goto error;
+    }
+
+d240:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e240_54:
+        stack.pop(4);
+        goto g121_54;
+    default:
+        errorState = 240;
+        goto error;
+    }
+
+d241:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(216);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d216;
+    default:
+        errorState = 241;
+        goto error;
+    }
+
+d242:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e242_54:
+        stack.pop(2);
+        goto g122_54;
+    case 56:
+    e242_55:
+        stack.pop(2);
+        goto g122_55;
+    default:
+        errorState = 242;
+        goto error;
+    }
+
+d243:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e243_54:
+        stack.pop(2);
+        goto g123_54;
+    case 56:
+    e243_55:
+        stack.pop(2);
+        goto g123_55;
+    case 58:
+    e243_57:
+        stack.push(270);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d270;
+    case 77:
+    e243_76:
+        stack.push(269);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d269;
+    default:
+        errorState = 243;
+        goto error;
+    }
+
+d244:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e271_54;
+    case 56:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 58:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 59:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 60:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 64:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 66:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 68:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 69:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 70:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 71:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 72:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 73:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 74:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 75:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 76:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 77:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e271_76;
+    case 78:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 79:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 81:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 271;
+        goto error;
+    case 82:
+        stack.push(271);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e271_81;
+    default:
+        errorState = 244;
+        goto error;
+    }
+
+d245:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(272);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d272;
+    default:
+        errorState = 245;
+        goto error;
+    }
+
+d246:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e246_54:
+        stack.pop(3);
+        goto g126_54;
+    default:
+        errorState = 246;
+        goto error;
+    }
+
+d247:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 273;
+        goto error;
+    case 2:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_1;
+    case 3:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_2;
+    case 4:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_3;
+    case 10:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_9;
+    case 11:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_10;
+    case 12:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_11;
+    case 13:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_12;
+    case 14:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_13;
+    case 15:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_14;
+    case 16:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_15;
+    case 17:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_16;
+    case 18:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_17;
+    case 19:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_18;
+    case 22:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_21;
+    case 30:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 273;
+        goto error;
+    case 52:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_51;
+    case 53:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_52;
+    case 55:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 273;
+        goto error;
+    case 61:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_60;
+    case 62:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_61;
+    case 63:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_62;
+    case 64:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_63;
+    case 65:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_64;
+    case 66:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_65;
+    case 67:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_66;
+    case 80:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_79;
+    case 87:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_86;
+    case 88:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_87;
+    case 89:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_88;
+    case 90:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_89;
+    case 91:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_90;
+    case 92:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_91;
+    case 93:
+        stack.push(273);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e273_92;
+    default:
+        errorState = 247;
+        goto error;
+    }
+
+d248:
+    switch (currentToken.getId())
+    {
+    case 2:
+        stack.pop(4);
+        goto g114_1;
+    case 3:
+        stack.pop(4);
+        goto g114_2;
+    case 4:
+        stack.pop(4);
+        goto g114_3;
+    case 10:
+        stack.pop(4);
+        goto g114_9;
+    case 11:
+        stack.pop(4);
+        goto g114_10;
+    case 12:
+        stack.pop(4);
+        goto g114_11;
+    case 13:
+        stack.pop(4);
+        goto g114_12;
+    case 14:
+        stack.pop(4);
+        goto g114_13;
+    case 15:
+        stack.pop(4);
+        goto g114_14;
+    case 16:
+        stack.pop(4);
+        goto g114_15;
+    case 17:
+        stack.pop(4);
+        goto g114_16;
+    case 18:
+        stack.pop(4);
+        goto g114_17;
+    case 19:
+        stack.pop(4);
+        goto g114_18;
+    case 22:
+        stack.pop(4);
+        goto g114_21;
+    case 52:
+        stack.pop(4);
+        goto g114_51;
+    case 53:
+        stack.pop(4);
+        goto g114_52;
+    case 61:
+        stack.pop(4);
+        goto g114_60;
+    case 62:
+        stack.pop(4);
+        goto g114_61;
+    case 63:
+        stack.pop(4);
+        goto g114_62;
+    case 64:
+        stack.pop(4);
+        goto g114_63;
+    case 65:
+        stack.pop(4);
+        goto g114_64;
+    case 66:
+        stack.pop(4);
+        goto g114_65;
+    case 67:
+        stack.pop(4);
+        goto g114_66;
+    case 80:
+        stack.pop(4);
+        goto g114_79;
+    case 87:
+        stack.pop(4);
+        goto g114_86;
+    case 88:
+        stack.pop(4);
+        goto g114_87;
+    case 89:
+        stack.pop(4);
+        goto g114_88;
+    case 90:
+        stack.pop(4);
+        goto g114_89;
+    case 91:
+        stack.pop(4);
+        goto g114_90;
+    case 92:
+        stack.pop(4);
+        goto g114_91;
+    case 93:
+        stack.pop(4);
+        goto g114_92;
+    default:
+        errorState = 248;
+        goto error;
+    }
+
+d249:
+    switch (currentToken.getId())
+    {
+    case 56:
+        stack.pop(4);
+        goto g101_55;
+    case 60:
+        stack.pop(4);
+        goto g101_59;
+    default:
+        errorState = 249;
+        goto error;
+    }
+
+d250:
+    switch (currentToken.getId())
+    {
+    case 62:
+    e250_61:
+        stack.push(28);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d28;
+    default:
+        errorState = 250;
+        goto error;
+    }
+
+d251:
+    switch (currentToken.getId())
+    {
+    case 56:
+    e251_55:
+        stack.pop(3);
+        goto g109_55;
+    case 60:
+    e251_59:
+        stack.pop(3);
+        goto g109_59;
+    default:
+        errorState = 251;
+        goto error;
+    }
+
+d252:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e252_0:
+        stack.pop(4);
+        goto g104_0;
+    case 2:
+    e252_1:
+        stack.pop(4);
+        goto g104_1;
+    case 3:
+    e252_2:
+        stack.pop(4);
+        goto g104_2;
+    case 4:
+    e252_3:
+        stack.pop(4);
+        goto g104_3;
+    case 10:
+    e252_9:
+        stack.pop(4);
+        goto g104_9;
+    case 11:
+    e252_10:
+        stack.pop(4);
+        goto g104_10;
+    case 12:
+    e252_11:
+        stack.pop(4);
+        goto g104_11;
+    case 13:
+    e252_12:
+        stack.pop(4);
+        goto g104_12;
+    case 14:
+    e252_13:
+        stack.pop(4);
+        goto g104_13;
+    case 15:
+    e252_14:
+        stack.pop(4);
+        goto g104_14;
+    case 16:
+    e252_15:
+        stack.pop(4);
+        goto g104_15;
+    case 17:
+    e252_16:
+        stack.pop(4);
+        goto g104_16;
+    case 18:
+    e252_17:
+        stack.pop(4);
+        goto g104_17;
+    case 19:
+    e252_18:
+        stack.pop(4);
+        goto g104_18;
+    case 22:
+    e252_21:
+        stack.pop(4);
+        goto g104_21;
+    case 30:
+    e252_29:
+        stack.pop(4);
+        goto g104_29;
+    case 52:
+    e252_51:
+        stack.pop(4);
+        goto g104_51;
+    case 53:
+    e252_52:
+        stack.pop(4);
+        goto g104_52;
+    case 61:
+    e252_60:
+        stack.pop(4);
+        goto g104_60;
+    case 62:
+    e252_61:
+        stack.pop(4);
+        goto g104_61;
+    case 64:
+    e252_63:
+        stack.pop(4);
+        goto g104_63;
+    case 65:
+    e252_64:
+        stack.pop(4);
+        goto g104_64;
+    case 66:
+    e252_65:
+        stack.pop(4);
+        goto g104_65;
+    case 67:
+    e252_66:
+        stack.pop(4);
+        goto g104_66;
+    case 80:
+    e252_79:
+        stack.pop(4);
+        goto g104_79;
+    case 87:
+    e252_86:
+        stack.pop(4);
+        goto g104_86;
+    case 88:
+    e252_87:
+        stack.pop(4);
+        goto g104_87;
+    case 89:
+    e252_88:
+        stack.pop(4);
+        goto g104_88;
+    case 90:
+    e252_89:
+        stack.pop(4);
+        goto g104_89;
+    case 91:
+    e252_90:
+        stack.pop(4);
+        goto g104_90;
+    case 92:
+    e252_91:
+        stack.pop(4);
+        goto g104_91;
+    case 93:
+    e252_92:
+        stack.pop(4);
+        goto g104_92;
+    default:
+        errorState = 252;
+        goto error;
+    }
+
+d253:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(275);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 275;
+        goto error;
+    case 56:
+        stack.push(275);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e275_55;
+    case 58:
+        stack.push(275);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e275_57;
+    case 60:
+        stack.push(275);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e275_59;
+    case 77:
+        stack.push(275);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 275;
+        goto error;
+    default:
+        errorState = 253;
+        goto error;
+    }
+
+d254:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e254_0:
+        stack.pop(4);
+        goto g104_0;
+    case 2:
+    e254_1:
+        stack.pop(4);
+        goto g104_1;
+    case 3:
+    e254_2:
+        stack.pop(4);
+        goto g104_2;
+    case 4:
+    e254_3:
+        stack.pop(4);
+        goto g104_3;
+    case 10:
+    e254_9:
+        stack.pop(4);
+        goto g104_9;
+    case 11:
+    e254_10:
+        stack.pop(4);
+        goto g104_10;
+    case 12:
+    e254_11:
+        stack.pop(4);
+        goto g104_11;
+    case 13:
+    e254_12:
+        stack.pop(4);
+        goto g104_12;
+    case 14:
+    e254_13:
+        stack.pop(4);
+        goto g104_13;
+    case 15:
+    e254_14:
+        stack.pop(4);
+        goto g104_14;
+    case 16:
+    e254_15:
+        stack.pop(4);
+        goto g104_15;
+    case 17:
+    e254_16:
+        stack.pop(4);
+        goto g104_16;
+    case 18:
+    e254_17:
+        stack.pop(4);
+        goto g104_17;
+    case 19:
+    e254_18:
+        stack.pop(4);
+        goto g104_18;
+    case 22:
+    e254_21:
+        stack.pop(4);
+        goto g104_21;
+    case 30:
+    e254_29:
+        stack.pop(4);
+        goto g104_29;
+    case 52:
+    e254_51:
+        stack.pop(4);
+        goto g104_51;
+    case 53:
+    e254_52:
+        stack.pop(4);
+        goto g104_52;
+    case 61:
+    e254_60:
+        stack.pop(4);
+        goto g104_60;
+    case 62:
+    e254_61:
+        stack.pop(4);
+        goto g104_61;
+    case 64:
+    e254_63:
+        stack.pop(4);
+        goto g104_63;
+    case 65:
+    e254_64:
+        stack.pop(4);
+        goto g104_64;
+    case 66:
+    e254_65:
+        stack.pop(4);
+        goto g104_65;
+    case 67:
+    e254_66:
+        stack.pop(4);
+        goto g104_66;
+    case 80:
+    e254_79:
+        stack.pop(4);
+        goto g104_79;
+    case 87:
+    e254_86:
+        stack.pop(4);
+        goto g104_86;
+    case 88:
+    e254_87:
+        stack.pop(4);
+        goto g104_87;
+    case 89:
+    e254_88:
+        stack.pop(4);
+        goto g104_88;
+    case 90:
+    e254_89:
+        stack.pop(4);
+        goto g104_89;
+    case 91:
+    e254_90:
+        stack.pop(4);
+        goto g104_90;
+    case 92:
+    e254_91:
+        stack.pop(4);
+        goto g104_91;
+    case 93:
+    e254_92:
+        stack.pop(4);
+        goto g104_92;
+    default:
+        errorState = 254;
+        goto error;
+    }
+
+d255:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e255_54:
+        stack.push(276);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e276_54;
+    case 56:
+    e255_55:
+        stack.push(276);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e276_55;
+    case 58:
+        stack.push(276);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 276;
+        goto error;
+    case 60:
+        stack.push(276);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 276;
+        goto error;
+    case 77:
+        stack.push(276);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 276;
+        goto error;
+    default:
+        errorState = 255;
+        goto error;
+    }
+
+d256:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 256;
+        goto error;
+    }
+
+d257:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 257;
+        goto error;
+    }
+
+d258:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_0;
+    case 2:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_1;
+    case 3:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_2;
+    case 4:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_3;
+    case 10:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_9;
+    case 11:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_10;
+    case 12:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_11;
+    case 13:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_12;
+    case 14:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_13;
+    case 15:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_14;
+    case 16:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_15;
+    case 17:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_16;
+    case 18:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_17;
+    case 19:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_18;
+    case 22:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_21;
+    case 30:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_29;
+    case 52:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_51;
+    case 53:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_52;
+    case 55:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 279;
+        goto error;
+    case 61:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_60;
+    case 62:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_61;
+    case 63:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 279;
+        goto error;
+    case 64:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_63;
+    case 65:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_64;
+    case 66:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_65;
+    case 67:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_66;
+    case 80:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_79;
+    case 87:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_86;
+    case 88:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_87;
+    case 89:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_88;
+    case 90:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_89;
+    case 91:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_90;
+    case 92:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_91;
+    case 93:
+        stack.push(279);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e279_92;
+    default:
+        errorState = 258;
+        goto error;
+    }
+
+d259:
+    switch (currentToken.getId())
+    {
+    case 93:
+        stack.push(207);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d207;
+    default:
+        errorState = 259;
+        goto error;
+    }
+
+d260:
+    switch (currentToken.getId())
+    {
+    case 62:
+    e260_61:
+        stack.push(28);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d28;
+    default:
+        errorState = 260;
+        goto error;
+    }
+
+d261:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e261_0:
+        stack.pop(7);
+        goto g102_0;
+    case 2:
+    e261_1:
+        stack.pop(7);
+        goto g102_1;
+    case 3:
+    e261_2:
+        stack.pop(7);
+        goto g102_2;
+    case 4:
+    e261_3:
+        stack.pop(7);
+        goto g102_3;
+    case 10:
+    e261_9:
+        stack.pop(7);
+        goto g102_9;
+    case 11:
+    e261_10:
+        stack.pop(7);
+        goto g102_10;
+    case 12:
+    e261_11:
+        stack.pop(7);
+        goto g102_11;
+    case 13:
+    e261_12:
+        stack.pop(7);
+        goto g102_12;
+    case 14:
+    e261_13:
+        stack.pop(7);
+        goto g102_13;
+    case 15:
+    e261_14:
+        stack.pop(7);
+        goto g102_14;
+    case 16:
+    e261_15:
+        stack.pop(7);
+        goto g102_15;
+    case 17:
+    e261_16:
+        stack.pop(7);
+        goto g102_16;
+    case 18:
+    e261_17:
+        stack.pop(7);
+        goto g102_17;
+    case 19:
+    e261_18:
+        stack.pop(7);
+        goto g102_18;
+    case 22:
+    e261_21:
+        stack.pop(7);
+        goto g102_21;
+    case 30:
+    e261_29:
+        stack.pop(7);
+        goto g102_29;
+    case 52:
+    e261_51:
+        stack.pop(7);
+        goto g102_51;
+    case 53:
+    e261_52:
+        stack.pop(7);
+        goto g102_52;
+    case 61:
+    e261_60:
+        stack.pop(7);
+        goto g102_60;
+    case 62:
+    e261_61:
+        stack.pop(7);
+        goto g102_61;
+    case 64:
+    e261_63:
+        stack.pop(7);
+        goto g102_63;
+    case 65:
+    e261_64:
+        stack.pop(7);
+        goto g102_64;
+    case 66:
+    e261_65:
+        stack.pop(7);
+        goto g102_65;
+    case 67:
+    e261_66:
+        stack.pop(7);
+        goto g102_66;
+    case 80:
+    e261_79:
+        stack.pop(7);
+        goto g102_79;
+    case 87:
+    e261_86:
+        stack.pop(7);
+        goto g102_86;
+    case 88:
+    e261_87:
+        stack.pop(7);
+        goto g102_87;
+    case 89:
+    e261_88:
+        stack.pop(7);
+        goto g102_88;
+    case 90:
+    e261_89:
+        stack.pop(7);
+        goto g102_89;
+    case 91:
+    e261_90:
+        stack.pop(7);
+        goto g102_90;
+    case 92:
+    e261_91:
+        stack.pop(7);
+        goto g102_91;
+    case 93:
+    e261_92:
+        stack.pop(7);
+        goto g102_92;
+    default:
+        errorState = 261;
+        goto error;
+    }
+
+d262:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e262_0:
+        stack.pop(7);
+        goto g116_0;
+    case 2:
+    e262_1:
+        stack.pop(7);
+        goto g116_1;
+    case 3:
+    e262_2:
+        stack.pop(7);
+        goto g116_2;
+    case 4:
+    e262_3:
+        stack.pop(7);
+        goto g116_3;
+    case 10:
+    e262_9:
+        stack.pop(7);
+        goto g116_9;
+    case 11:
+    e262_10:
+        stack.pop(7);
+        goto g116_10;
+    case 12:
+    e262_11:
+        stack.pop(7);
+        goto g116_11;
+    case 13:
+    e262_12:
+        stack.pop(7);
+        goto g116_12;
+    case 14:
+    e262_13:
+        stack.pop(7);
+        goto g116_13;
+    case 15:
+    e262_14:
+        stack.pop(7);
+        goto g116_14;
+    case 16:
+    e262_15:
+        stack.pop(7);
+        goto g116_15;
+    case 17:
+    e262_16:
+        stack.pop(7);
+        goto g116_16;
+    case 18:
+    e262_17:
+        stack.pop(7);
+        goto g116_17;
+    case 19:
+    e262_18:
+        stack.pop(7);
+        goto g116_18;
+    case 22:
+    e262_21:
+        stack.pop(7);
+        goto g116_21;
+    case 30:
+    e262_29:
+        stack.pop(7);
+        goto g116_29;
+    case 52:
+    e262_51:
+        stack.pop(7);
+        goto g116_51;
+    case 53:
+    e262_52:
+        stack.pop(7);
+        goto g116_52;
+    case 61:
+    e262_60:
+        stack.pop(7);
+        goto g116_60;
+    case 62:
+    e262_61:
+        stack.pop(7);
+        goto g116_61;
+    case 63:
+    e262_62:
+        stack.pop(7);
+        goto g116_62;
+    case 64:
+    e262_63:
+        stack.pop(7);
+        goto g116_63;
+    case 65:
+    e262_64:
+        stack.pop(7);
+        goto g116_64;
+    case 66:
+    e262_65:
+        stack.pop(7);
+        goto g116_65;
+    case 67:
+    e262_66:
+        stack.pop(7);
+        goto g116_66;
+    case 80:
+    e262_79:
+        stack.pop(7);
+        goto g116_79;
+    case 87:
+    e262_86:
+        stack.pop(7);
+        goto g116_86;
+    case 88:
+    e262_87:
+        stack.pop(7);
+        goto g116_87;
+    case 89:
+    e262_88:
+        stack.pop(7);
+        goto g116_88;
+    case 90:
+    e262_89:
+        stack.pop(7);
+        goto g116_89;
+    case 91:
+    e262_90:
+        stack.pop(7);
+        goto g116_90;
+    case 92:
+    e262_91:
+        stack.pop(7);
+        goto g116_91;
+    case 93:
+    e262_92:
+        stack.pop(7);
+        goto g116_92;
+    default:
+        errorState = 262;
+        goto error;
+    }
+
+d263:
+    switch (currentToken.getId())
+    {
+    case 60:
+    e263_59:
+        stack.push(282);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d282;
+    default:
+        errorState = 263;
+        goto error;
+    }
+
+d264:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e264_54:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 56:
+    e264_55:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 58:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 59:
+    e264_58:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 60:
+    e264_59:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e283_59;
+    case 64:
+    e264_63:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 66:
+    e264_65:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 68:
+    e264_67:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 69:
+    e264_68:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 70:
+    e264_69:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 71:
+    e264_70:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 72:
+    e264_71:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 73:
+    e264_72:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 74:
+    e264_73:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 75:
+    e264_74:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 76:
+    e264_75:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 77:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 78:
+    e264_77:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 79:
+    e264_78:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 81:
+    e264_80:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    case 82:
+        stack.push(283);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 283;
+        goto error;
+    default:
+        errorState = 264;
+        goto error;
+    }
+
+d265:
+    switch (currentToken.getId())
+    {
+    case 60:
+    e265_59:
+        stack.pop(1);
+        goto g120_59;
+    default:
+        errorState = 265;
+        goto error;
+    }
+
+d266:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e284_54;
+    case 56:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 58:
+        stack.push(176);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d176;
+    case 59:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 60:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 64:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 65:
+        stack.push(80);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d80;
+    case 66:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 67:
+        stack.push(81);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d81;
+    case 68:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 69:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 70:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 71:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 72:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 73:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 74:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 75:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 76:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 77:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e284_76;
+    case 78:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 79:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 81:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 284;
+        goto error;
+    case 82:
+        stack.push(284);
+        semanticAnalyser->executeAction(4, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e284_81;
+    default:
+        errorState = 266;
+        goto error;
+    }
+
+d267:
+    switch (currentToken.getId())
+    {
+    case 65:
+    e267_64:
+        stack.push(102);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d102;
+    case 67:
+    e267_66:
+        stack.push(103);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d103;
+    default:
+        errorState = 267;
+        goto error;
+    }
+
+d268:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e268_54:
+        stack.push(285);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e285_54;
+    case 56:
+    e268_55:
+        stack.push(285);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e285_55;
+    case 58:
+        stack.push(285);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 285;
+        goto error;
+    case 60:
+        stack.push(285);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 285;
+        goto error;
+    case 77:
+        stack.push(285);
+        semanticAnalyser->executeAction(2, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 285;
+        goto error;
+    default:
+        errorState = 268;
+        goto error;
+    }
+
+d269:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 269;
+        goto error;
+    }
+
+d270:
+    switch (currentToken.getId())
+    {
+    case 12:
+        stack.push(45);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d45;
+    case 13:
+        stack.push(46);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d46;
+    case 61:
+        stack.push(49);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d49;
+    case 64:
+        stack.push(38);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d38;
+    case 65:
+        stack.push(50);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d50;
+    case 66:
+        stack.push(37);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d37;
+    case 67:
+        stack.push(51);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d51;
+    case 80:
+        stack.push(36);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d36;
+    case 87:
+        stack.push(41);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d41;
+    case 88:
+        stack.push(42);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d42;
+    case 89:
+        stack.push(43);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d43;
+    case 90:
+        stack.push(47);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d47;
+    case 91:
+        stack.push(48);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d48;
+    case 92:
+        stack.push(44);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d44;
+    case 93:
+        stack.push(71);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d71;
+    default:
+        errorState = 270;
+        goto error;
+    }
+
+d271:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e271_54:
+        stack.pop(5);
+        goto g115_54;
+    case 77:
+    e271_76:
+        stack.pop(5);
+        goto g115_76;
+    case 82:
+    e271_81:
+        stack.pop(5);
+        goto g115_81;
+    default:
+        errorState = 271;
+        goto error;
+    }
+
+d272:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.pop(7);
+        goto g117_0;
+    case 2:
+        stack.pop(7);
+        goto g117_1;
+    case 3:
+        stack.pop(7);
+        goto g117_2;
+    case 4:
+        stack.pop(7);
+        goto g117_3;
+    case 10:
+        stack.pop(7);
+        goto g117_9;
+    case 11:
+        stack.pop(7);
+        goto g117_10;
+    case 12:
+        stack.pop(7);
+        goto g117_11;
+    case 13:
+        stack.pop(7);
+        goto g117_12;
+    case 14:
+        stack.pop(7);
+        goto g117_13;
+    case 15:
+        stack.pop(7);
+        goto g117_14;
+    case 16:
+        stack.pop(7);
+        goto g117_15;
+    case 17:
+        stack.pop(7);
+        goto g117_16;
+    case 18:
+        stack.pop(7);
+        goto g117_17;
+    case 19:
+        stack.pop(7);
+        goto g117_18;
+    case 22:
+        stack.pop(7);
+        goto g117_21;
+    case 30:
+        stack.pop(7);
+        goto g117_29;
+    case 52:
+        stack.pop(7);
+        goto g117_51;
+    case 53:
+        stack.pop(7);
+        goto g117_52;
+    case 61:
+        stack.pop(7);
+        goto g117_60;
+    case 62:
+        stack.pop(7);
+        goto g117_61;
+    case 63:
+        stack.pop(7);
+        goto g117_62;
+    case 64:
+        stack.pop(7);
+        goto g117_63;
+    case 65:
+        stack.pop(7);
+        goto g117_64;
+    case 66:
+        stack.pop(7);
+        goto g117_65;
+    case 67:
+        stack.pop(7);
+        goto g117_66;
+    case 80:
+        stack.pop(7);
+        goto g117_79;
+    case 87:
+        stack.pop(7);
+        goto g117_86;
+    case 88:
+        stack.pop(7);
+        goto g117_87;
+    case 89:
+        stack.pop(7);
+        goto g117_88;
+    case 90:
+        stack.pop(7);
+        goto g117_89;
+    case 91:
+        stack.pop(7);
+        goto g117_90;
+    case 92:
+        stack.pop(7);
+        goto g117_91;
+    case 93:
+        stack.pop(7);
+        goto g117_92;
+    default:
+        errorState = 272;
+        goto error;
+    }
+
+d273:
+    switch (currentToken.getId())
+    {
+    case 2:
+    e273_1:
+        stack.pop(5);
+        goto g105_1;
+    case 3:
+    e273_2:
+        stack.pop(5);
+        goto g105_2;
+    case 4:
+    e273_3:
+        stack.pop(5);
+        goto g105_3;
+    case 10:
+    e273_9:
+        stack.pop(5);
+        goto g105_9;
+    case 11:
+    e273_10:
+        stack.pop(5);
+        goto g105_10;
+    case 12:
+    e273_11:
+        stack.pop(5);
+        goto g105_11;
+    case 13:
+    e273_12:
+        stack.pop(5);
+        goto g105_12;
+    case 14:
+    e273_13:
+        stack.pop(5);
+        goto g105_13;
+    case 15:
+    e273_14:
+        stack.pop(5);
+        goto g105_14;
+    case 16:
+    e273_15:
+        stack.pop(5);
+        goto g105_15;
+    case 17:
+    e273_16:
+        stack.pop(5);
+        goto g105_16;
+    case 18:
+    e273_17:
+        stack.pop(5);
+        goto g105_17;
+    case 19:
+    e273_18:
+        stack.pop(5);
+        goto g105_18;
+    case 22:
+    e273_21:
+        stack.pop(5);
+        goto g105_21;
+    case 52:
+    e273_51:
+        stack.pop(5);
+        goto g105_51;
+    case 53:
+    e273_52:
+        stack.pop(5);
+        goto g105_52;
+    case 61:
+    e273_60:
+        stack.pop(5);
+        goto g105_60;
+    case 62:
+    e273_61:
+        stack.pop(5);
+        goto g105_61;
+    case 63:
+    e273_62:
+        stack.pop(5);
+        goto g105_62;
+    case 64:
+    e273_63:
+        stack.pop(5);
+        goto g105_63;
+    case 65:
+    e273_64:
+        stack.pop(5);
+        goto g105_64;
+    case 66:
+    e273_65:
+        stack.pop(5);
+        goto g105_65;
+    case 67:
+    e273_66:
+        stack.pop(5);
+        goto g105_66;
+    case 80:
+    e273_79:
+        stack.pop(5);
+        goto g105_79;
+    case 87:
+    e273_86:
+        stack.pop(5);
+        goto g105_86;
+    case 88:
+    e273_87:
+        stack.pop(5);
+        goto g105_87;
+    case 89:
+    e273_88:
+        stack.pop(5);
+        goto g105_88;
+    case 90:
+    e273_89:
+        stack.pop(5);
+        goto g105_89;
+    case 91:
+    e273_90:
+        stack.pop(5);
+        goto g105_90;
+    case 92:
+    e273_91:
+        stack.pop(5);
+        goto g105_91;
+    case 93:
+    e273_92:
+        stack.pop(5);
+        goto g105_92;
+    default:
+        errorState = 273;
+        goto error;
+    }
+
+d274:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e274_0:
+        stack.pop(5);
+        goto g104_0;
+    case 2:
+    e274_1:
+        stack.pop(5);
+        goto g104_1;
+    case 3:
+    e274_2:
+        stack.pop(5);
+        goto g104_2;
+    case 4:
+    e274_3:
+        stack.pop(5);
+        goto g104_3;
+    case 10:
+    e274_9:
+        stack.pop(5);
+        goto g104_9;
+    case 11:
+    e274_10:
+        stack.pop(5);
+        goto g104_10;
+    case 12:
+    e274_11:
+        stack.pop(5);
+        goto g104_11;
+    case 13:
+    e274_12:
+        stack.pop(5);
+        goto g104_12;
+    case 14:
+    e274_13:
+        stack.pop(5);
+        goto g104_13;
+    case 15:
+    e274_14:
+        stack.pop(5);
+        goto g104_14;
+    case 16:
+    e274_15:
+        stack.pop(5);
+        goto g104_15;
+    case 17:
+    e274_16:
+        stack.pop(5);
+        goto g104_16;
+    case 18:
+    e274_17:
+        stack.pop(5);
+        goto g104_17;
+    case 19:
+    e274_18:
+        stack.pop(5);
+        goto g104_18;
+    case 22:
+    e274_21:
+        stack.pop(5);
+        goto g104_21;
+    case 30:
+    e274_29:
+        stack.pop(5);
+        goto g104_29;
+    case 52:
+    e274_51:
+        stack.pop(5);
+        goto g104_51;
+    case 53:
+    e274_52:
+        stack.pop(5);
+        goto g104_52;
+    case 61:
+    e274_60:
+        stack.pop(5);
+        goto g104_60;
+    case 62:
+    e274_61:
+        stack.pop(5);
+        goto g104_61;
+    case 64:
+    e274_63:
+        stack.pop(5);
+        goto g104_63;
+    case 65:
+    e274_64:
+        stack.pop(5);
+        goto g104_64;
+    case 66:
+    e274_65:
+        stack.pop(5);
+        goto g104_65;
+    case 67:
+    e274_66:
+        stack.pop(5);
+        goto g104_66;
+    case 80:
+    e274_79:
+        stack.pop(5);
+        goto g104_79;
+    case 87:
+    e274_86:
+        stack.pop(5);
+        goto g104_86;
+    case 88:
+    e274_87:
+        stack.pop(5);
+        goto g104_87;
+    case 89:
+    e274_88:
+        stack.pop(5);
+        goto g104_88;
+    case 90:
+    e274_89:
+        stack.pop(5);
+        goto g104_89;
+    case 91:
+    e274_90:
+        stack.pop(5);
+        goto g104_90;
+    case 92:
+    e274_91:
+        stack.pop(5);
+        goto g104_91;
+    case 93:
+    e274_92:
+        stack.pop(5);
+        goto g104_92;
+    default:
+        errorState = 274;
+        goto error;
+    }
+
+d275:
+    switch (currentToken.getId())
+    {
+    case 56:
+    e275_55:
+        stack.pop(4);
+        goto g110_55;
+    case 58:
+    e275_57:
+        stack.push(289);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d289;
+    case 60:
+    e275_59:
+        stack.pop(4);
+        goto g110_59;
+    default:
+        errorState = 275;
+        goto error;
+    }
+
+d276:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e276_54:
+        stack.pop(4);
+        goto g107_54;
+    case 56:
+    e276_55:
+        stack.pop(4);
+        goto g107_55;
+    default:
+        errorState = 276;
+        goto error;
+    }
+
+d277:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e277_54:
+        stack.pop(4);
+        goto g108_54;
+    case 56:
+    e277_55:
+        stack.pop(4);
+        goto g108_55;
+    default:
+        errorState = 277;
+        goto error;
+    }
+
+d278:
+    switch (currentToken.getId())
+    {
+    case 59:
+    e278_58:
+        stack.push(290);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d290;
+    default:
+        errorState = 278;
+        goto error;
+    }
+
+d279:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e279_0:
+        stack.pop(5);
+        goto g104_0;
+    case 2:
+    e279_1:
+        stack.pop(5);
+        goto g104_1;
+    case 3:
+    e279_2:
+        stack.pop(5);
+        goto g104_2;
+    case 4:
+    e279_3:
+        stack.pop(5);
+        goto g104_3;
+    case 10:
+    e279_9:
+        stack.pop(5);
+        goto g104_9;
+    case 11:
+    e279_10:
+        stack.pop(5);
+        goto g104_10;
+    case 12:
+    e279_11:
+        stack.pop(5);
+        goto g104_11;
+    case 13:
+    e279_12:
+        stack.pop(5);
+        goto g104_12;
+    case 14:
+    e279_13:
+        stack.pop(5);
+        goto g104_13;
+    case 15:
+    e279_14:
+        stack.pop(5);
+        goto g104_14;
+    case 16:
+    e279_15:
+        stack.pop(5);
+        goto g104_15;
+    case 17:
+    e279_16:
+        stack.pop(5);
+        goto g104_16;
+    case 18:
+    e279_17:
+        stack.pop(5);
+        goto g104_17;
+    case 19:
+    e279_18:
+        stack.pop(5);
+        goto g104_18;
+    case 22:
+    e279_21:
+        stack.pop(5);
+        goto g104_21;
+    case 30:
+    e279_29:
+        stack.pop(5);
+        goto g104_29;
+    case 52:
+    e279_51:
+        stack.pop(5);
+        goto g104_51;
+    case 53:
+    e279_52:
+        stack.pop(5);
+        goto g104_52;
+    case 61:
+    e279_60:
+        stack.pop(5);
+        goto g104_60;
+    case 62:
+    e279_61:
+        stack.pop(5);
+        goto g104_61;
+    case 64:
+    e279_63:
+        stack.pop(5);
+        goto g104_63;
+    case 65:
+    e279_64:
+        stack.pop(5);
+        goto g104_64;
+    case 66:
+    e279_65:
+        stack.pop(5);
+        goto g104_65;
+    case 67:
+    e279_66:
+        stack.pop(5);
+        goto g104_66;
+    case 80:
+    e279_79:
+        stack.pop(5);
+        goto g104_79;
+    case 87:
+    e279_86:
+        stack.pop(5);
+        goto g104_86;
+    case 88:
+    e279_87:
+        stack.pop(5);
+        goto g104_87;
+    case 89:
+    e279_88:
+        stack.pop(5);
+        goto g104_88;
+    case 90:
+    e279_89:
+        stack.pop(5);
+        goto g104_89;
+    case 91:
+    e279_90:
+        stack.pop(5);
+        goto g104_90;
+    case 92:
+    e279_91:
+        stack.pop(5);
+        goto g104_91;
+    case 93:
+    e279_92:
+        stack.pop(5);
+        goto g104_92;
+    default:
+        errorState = 279;
+        goto error;
+    }
+
+d280:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e280_54:
+        stack.push(291);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d291;
+    case 56:
+    e280_55:
+        stack.push(232);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d232;
+    default:
+        errorState = 280;
+        goto error;
+    }
+
+d281:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e281_0:
+        stack.pop(8);
+        goto g102_0;
+    case 2:
+    e281_1:
+        stack.pop(8);
+        goto g102_1;
+    case 3:
+    e281_2:
+        stack.pop(8);
+        goto g102_2;
+    case 4:
+    e281_3:
+        stack.pop(8);
+        goto g102_3;
+    case 10:
+    e281_9:
+        stack.pop(8);
+        goto g102_9;
+    case 11:
+    e281_10:
+        stack.pop(8);
+        goto g102_10;
+    case 12:
+    e281_11:
+        stack.pop(8);
+        goto g102_11;
+    case 13:
+    e281_12:
+        stack.pop(8);
+        goto g102_12;
+    case 14:
+    e281_13:
+        stack.pop(8);
+        goto g102_13;
+    case 15:
+    e281_14:
+        stack.pop(8);
+        goto g102_14;
+    case 16:
+    e281_15:
+        stack.pop(8);
+        goto g102_15;
+    case 17:
+    e281_16:
+        stack.pop(8);
+        goto g102_16;
+    case 18:
+    e281_17:
+        stack.pop(8);
+        goto g102_17;
+    case 19:
+    e281_18:
+        stack.pop(8);
+        goto g102_18;
+    case 22:
+    e281_21:
+        stack.pop(8);
+        goto g102_21;
+    case 30:
+    e281_29:
+        stack.pop(8);
+        goto g102_29;
+    case 52:
+    e281_51:
+        stack.pop(8);
+        goto g102_51;
+    case 53:
+    e281_52:
+        stack.pop(8);
+        goto g102_52;
+    case 61:
+    e281_60:
+        stack.pop(8);
+        goto g102_60;
+    case 62:
+    e281_61:
+        stack.pop(8);
+        goto g102_61;
+    case 64:
+    e281_63:
+        stack.pop(8);
+        goto g102_63;
+    case 65:
+    e281_64:
+        stack.pop(8);
+        goto g102_64;
+    case 66:
+    e281_65:
+        stack.pop(8);
+        goto g102_65;
+    case 67:
+    e281_66:
+        stack.pop(8);
+        goto g102_66;
+    case 80:
+    e281_79:
+        stack.pop(8);
+        goto g102_79;
+    case 87:
+    e281_86:
+        stack.pop(8);
+        goto g102_86;
+    case 88:
+    e281_87:
+        stack.pop(8);
+        goto g102_87;
+    case 89:
+    e281_88:
+        stack.pop(8);
+        goto g102_88;
+    case 90:
+    e281_89:
+        stack.pop(8);
+        goto g102_89;
+    case 91:
+    e281_90:
+        stack.pop(8);
+        goto g102_90;
+    case 92:
+    e281_91:
+        stack.pop(8);
+        goto g102_91;
+    case 93:
+    e281_92:
+        stack.pop(8);
+        goto g102_92;
+    default:
+        errorState = 281;
+        goto error;
+    }
+
+d282:
+    switch (currentToken.getId())
+    {
+    case 62:
+        stack.push(28);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d28;
+    default:
+        errorState = 282;
+        goto error;
+    }
+
+d283:
+    switch (currentToken.getId())
+    {
+    case 60:
+    e283_59:
+        stack.pop(2);
+        goto g120_59;
+    default:
+        errorState = 283;
+        goto error;
+    }
+
+d284:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e284_54:
+        stack.pop(2);
+        goto g115_54;
+    case 58:
+        stack.push(145);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d145;
+    case 77:
+    e284_76:
+        stack.pop(2);
+        goto g115_76;
+    case 82:
+    e284_81:
+        stack.pop(2);
+        goto g115_81;
+    default:
+        errorState = 284;
+        goto error;
+    }
+
+d285:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e285_54:
+        stack.pop(4);
+        goto g122_54;
+    case 56:
+    e285_55:
+        stack.pop(4);
+        goto g122_55;
+    default:
+        errorState = 285;
+        goto error;
+    }
+
+d286:
+    switch (currentToken.getId())
+    {
+    case 55:
+    e286_54:
+        stack.pop(4);
+        goto g123_54;
+    case 56:
+    e286_55:
+        stack.pop(4);
+        goto g123_55;
+    default:
+        errorState = 286;
+        goto error;
+    }
+
+d287:
+    switch (currentToken.getId())
+    {
+    case 59:
+    e287_58:
+        stack.push(293);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d293;
+    default:
+        errorState = 287;
+        goto error;
+    }
+
+d288:
+    switch (currentToken.getId())
+    {
+    case 2:
+    e288_1:
+        stack.pop(6);
+        goto g105_1;
+    case 3:
+    e288_2:
+        stack.pop(6);
+        goto g105_2;
+    case 4:
+    e288_3:
+        stack.pop(6);
+        goto g105_3;
+    case 10:
+    e288_9:
+        stack.pop(6);
+        goto g105_9;
+    case 11:
+    e288_10:
+        stack.pop(6);
+        goto g105_10;
+    case 12:
+    e288_11:
+        stack.pop(6);
+        goto g105_11;
+    case 13:
+    e288_12:
+        stack.pop(6);
+        goto g105_12;
+    case 14:
+    e288_13:
+        stack.pop(6);
+        goto g105_13;
+    case 15:
+    e288_14:
+        stack.pop(6);
+        goto g105_14;
+    case 16:
+    e288_15:
+        stack.pop(6);
+        goto g105_15;
+    case 17:
+    e288_16:
+        stack.pop(6);
+        goto g105_16;
+    case 18:
+    e288_17:
+        stack.pop(6);
+        goto g105_17;
+    case 19:
+    e288_18:
+        stack.pop(6);
+        goto g105_18;
+    case 22:
+    e288_21:
+        stack.pop(6);
+        goto g105_21;
+    case 52:
+    e288_51:
+        stack.pop(6);
+        goto g105_51;
+    case 53:
+    e288_52:
+        stack.pop(6);
+        goto g105_52;
+    case 61:
+    e288_60:
+        stack.pop(6);
+        goto g105_60;
+    case 62:
+    e288_61:
+        stack.pop(6);
+        goto g105_61;
+    case 63:
+    e288_62:
+        stack.pop(6);
+        goto g105_62;
+    case 64:
+    e288_63:
+        stack.pop(6);
+        goto g105_63;
+    case 65:
+    e288_64:
+        stack.pop(6);
+        goto g105_64;
+    case 66:
+    e288_65:
+        stack.pop(6);
+        goto g105_65;
+    case 67:
+    e288_66:
+        stack.pop(6);
+        goto g105_66;
+    case 80:
+    e288_79:
+        stack.pop(6);
+        goto g105_79;
+    case 87:
+    e288_86:
+        stack.pop(6);
+        goto g105_86;
+    case 88:
+    e288_87:
+        stack.pop(6);
+        goto g105_87;
+    case 89:
+    e288_88:
+        stack.pop(6);
+        goto g105_88;
+    case 90:
+    e288_89:
+        stack.pop(6);
+        goto g105_89;
+    case 91:
+    e288_90:
+        stack.pop(6);
+        goto g105_90;
+    case 92:
+    e288_91:
+        stack.pop(6);
+        goto g105_91;
+    case 93:
+    e288_92:
+        stack.pop(6);
+        goto g105_92;
+    default:
+        errorState = 288;
+        goto error;
+    }
+
+d289:
+    switch (currentToken.getId())
+    {
+    case 59:
+        stack.push(294);
+        shiftedTokens++;
+        previousToken = currentToken;
+        readToken();
+        goto d294;
+    default:
+        errorState = 289;
+        goto error;
+    }
+
+d290:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(5);
+        goto g108_54;
+    case 56:
+        stack.pop(5);
+        goto g108_55;
+    default:
+        errorState = 290;
+        goto error;
+    }
+
+d291:
+    switch (currentToken.getId())
+    {
+    case 1:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_0;
+    case 2:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_1;
+    case 3:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_2;
+    case 4:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_3;
+    case 10:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_9;
+    case 11:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_10;
+    case 12:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_11;
+    case 13:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_12;
+    case 14:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_13;
+    case 15:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_14;
+    case 16:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_15;
+    case 17:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_16;
+    case 18:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_17;
+    case 19:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_18;
+    case 22:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_21;
+    case 30:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_29;
+    case 52:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_51;
+    case 53:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_52;
+    case 55:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 295;
+        goto error;
+    case 61:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_60;
+    case 62:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_61;
+    case 63:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        errorState = 295;
+        goto error;
+    case 64:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_63;
+    case 65:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_64;
+    case 66:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_65;
+    case 67:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_66;
+    case 80:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_79;
+    case 87:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_86;
+    case 88:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_87;
+    case 89:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_88;
+    case 90:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_89;
+    case 91:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_90;
+    case 92:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_91;
+    case 93:
+        stack.push(295);
+        semanticAnalyser->executeAction(3, previousToken.getId() != EPSILON ? &previousToken : 0);
+        goto e295_92;
+    default:
+        errorState = 291;
+        goto error;
+    }
+
+d292:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e292_0:
+        stack.pop(9);
+        goto g117_0;
+    case 2:
+    e292_1:
+        stack.pop(9);
+        goto g117_1;
+    case 3:
+    e292_2:
+        stack.pop(9);
+        goto g117_2;
+    case 4:
+    e292_3:
+        stack.pop(9);
+        goto g117_3;
+    case 10:
+    e292_9:
+        stack.pop(9);
+        goto g117_9;
+    case 11:
+    e292_10:
+        stack.pop(9);
+        goto g117_10;
+    case 12:
+    e292_11:
+        stack.pop(9);
+        goto g117_11;
+    case 13:
+    e292_12:
+        stack.pop(9);
+        goto g117_12;
+    case 14:
+    e292_13:
+        stack.pop(9);
+        goto g117_13;
+    case 15:
+    e292_14:
+        stack.pop(9);
+        goto g117_14;
+    case 16:
+    e292_15:
+        stack.pop(9);
+        goto g117_15;
+    case 17:
+    e292_16:
+        stack.pop(9);
+        goto g117_16;
+    case 18:
+    e292_17:
+        stack.pop(9);
+        goto g117_17;
+    case 19:
+    e292_18:
+        stack.pop(9);
+        goto g117_18;
+    case 22:
+    e292_21:
+        stack.pop(9);
+        goto g117_21;
+    case 30:
+    e292_29:
+        stack.pop(9);
+        goto g117_29;
+    case 52:
+    e292_51:
+        stack.pop(9);
+        goto g117_51;
+    case 53:
+    e292_52:
+        stack.pop(9);
+        goto g117_52;
+    case 61:
+    e292_60:
+        stack.pop(9);
+        goto g117_60;
+    case 62:
+    e292_61:
+        stack.pop(9);
+        goto g117_61;
+    case 63:
+    e292_62:
+        stack.pop(9);
+        goto g117_62;
+    case 64:
+    e292_63:
+        stack.pop(9);
+        goto g117_63;
+    case 65:
+    e292_64:
+        stack.pop(9);
+        goto g117_64;
+    case 66:
+    e292_65:
+        stack.pop(9);
+        goto g117_65;
+    case 67:
+    e292_66:
+        stack.pop(9);
+        goto g117_66;
+    case 80:
+    e292_79:
+        stack.pop(9);
+        goto g117_79;
+    case 87:
+    e292_86:
+        stack.pop(9);
+        goto g117_86;
+    case 88:
+    e292_87:
+        stack.pop(9);
+        goto g117_87;
+    case 89:
+    e292_88:
+        stack.pop(9);
+        goto g117_88;
+    case 90:
+    e292_89:
+        stack.pop(9);
+        goto g117_89;
+    case 91:
+    e292_90:
+        stack.pop(9);
+        goto g117_90;
+    case 92:
+    e292_91:
+        stack.pop(9);
+        goto g117_91;
+    case 93:
+    e292_92:
+        stack.pop(9);
+        goto g117_92;
+    default:
+        errorState = 292;
+        goto error;
+    }
+
+d293:
+    switch (currentToken.getId())
+    {
+    case 55:
+        stack.pop(5);
+        goto g123_54;
+    case 56:
+        stack.pop(5);
+        goto g123_55;
+    default:
+        errorState = 293;
+        goto error;
+    }
+
+d294:
+    switch (currentToken.getId())
+    {
+    case 56:
+        stack.pop(6);
+        goto g110_55;
+    case 60:
+        stack.pop(6);
+        goto g110_59;
+    default:
+        errorState = 294;
+        goto error;
+    }
+
+d295:
+    switch (currentToken.getId())
+    {
+    case 1:
+    e295_0:
+        stack.pop(7);
+        goto g104_0;
+    case 2:
+    e295_1:
+        stack.pop(7);
+        goto g104_1;
+    case 3:
+    e295_2:
+        stack.pop(7);
+        goto g104_2;
+    case 4:
+    e295_3:
+        stack.pop(7);
+        goto g104_3;
+    case 10:
+    e295_9:
+        stack.pop(7);
+        goto g104_9;
+    case 11:
+    e295_10:
+        stack.pop(7);
+        goto g104_10;
+    case 12:
+    e295_11:
+        stack.pop(7);
+        goto g104_11;
+    case 13:
+    e295_12:
+        stack.pop(7);
+        goto g104_12;
+    case 14:
+    e295_13:
+        stack.pop(7);
+        goto g104_13;
+    case 15:
+    e295_14:
+        stack.pop(7);
+        goto g104_14;
+    case 16:
+    e295_15:
+        stack.pop(7);
+        goto g104_15;
+    case 17:
+    e295_16:
+        stack.pop(7);
+        goto g104_16;
+    case 18:
+    e295_17:
+        stack.pop(7);
+        goto g104_17;
+    case 19:
+    e295_18:
+        stack.pop(7);
+        goto g104_18;
+    case 22:
+    e295_21:
+        stack.pop(7);
+        goto g104_21;
+    case 30:
+    e295_29:
+        stack.pop(7);
+        goto g104_29;
+    case 52:
+    e295_51:
+        stack.pop(7);
+        goto g104_51;
+    case 53:
+    e295_52:
+        stack.pop(7);
+        goto g104_52;
+    case 61:
+    e295_60:
+        stack.pop(7);
+        goto g104_60;
+    case 62:
+    e295_61:
+        stack.pop(7);
+        goto g104_61;
+    case 64:
+    e295_63:
+        stack.pop(7);
+        goto g104_63;
+    case 65:
+    e295_64:
+        stack.pop(7);
+        goto g104_64;
+    case 66:
+    e295_65:
+        stack.pop(7);
+        goto g104_65;
+    case 67:
+    e295_66:
+        stack.pop(7);
+        goto g104_66;
+    case 80:
+    e295_79:
+        stack.pop(7);
+        goto g104_79;
+    case 87:
+    e295_86:
+        stack.pop(7);
+        goto g104_86;
+    case 88:
+    e295_87:
+        stack.pop(7);
+        goto g104_87;
+    case 89:
+    e295_88:
+        stack.pop(7);
+        goto g104_88;
+    case 90:
+    e295_89:
+        stack.pop(7);
+        goto g104_89;
+    case 91:
+    e295_90:
+        stack.pop(7);
+        goto g104_90;
+    case 92:
+    e295_91:
+        stack.pop(7);
+        goto g104_91;
+    case 93:
+    e295_92:
+        stack.pop(7);
+        goto g104_92;
+    default:
+        errorState = 295;
+        goto error;
+    }
+
+g95_0:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_0;
+    }
+
+g95_1:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_1;
+    }
+
+g95_2:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_2;
+    }
+
+g95_3:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_3;
+    }
+
+g95_9:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_9;
+    }
+
+g95_10:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_10;
+    }
+
+g95_11:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_11;
+    }
+
+g95_12:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_12;
+    }
+
+g95_13:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_13;
+    }
+
+g95_14:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_14;
+    }
+
+g95_15:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_15;
+    }
+
+g95_16:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_16;
+    }
+
+g95_17:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_17;
+    }
+
+g95_18:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_18;
+    }
+
+g95_21:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_21;
+    }
+
+g95_29:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_29;
+    }
+
+g95_51:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_51;
+    }
+
+g95_52:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_52;
+    }
+
+g95_60:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_60;
+    }
+
+g95_61:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_61;
+    }
+
+g95_63:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_63;
+    }
+
+g95_64:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_64;
+    }
+
+g95_65:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_65;
+    }
+
+g95_66:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_66;
+    }
+
+g95_79:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_79;
+    }
+
+g95_86:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_86;
+    }
+
+g95_87:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_87;
+    }
+
+g95_88:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_88;
+    }
+
+g95_89:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_89;
+    }
+
+g95_90:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_90;
+    }
+
+g95_91:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_91;
+    }
+
+g95_92:
+    switch (stack.top())
+    {
+    default:
+        stack.push(1);
+        goto e1_92;
+    }
+
+g96_0:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_0;
+    default:
+        stack.push(2);
+        goto e2_0;
+    }
+
+g96_1:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_1;
+    default:
+        stack.push(2);
+        goto e2_1;
+    }
+
+g96_2:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_2;
+    default:
+        stack.push(2);
+        goto e2_2;
+    }
+
+g96_3:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_3;
+    default:
+        stack.push(2);
+        goto e2_3;
+    }
+
+g96_9:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_9;
+    default:
+        stack.push(2);
+        goto e2_9;
+    }
+
+g96_10:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_10;
+    default:
+        stack.push(2);
+        goto e2_10;
+    }
+
+g96_11:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_11;
+    default:
+        stack.push(2);
+        goto e2_11;
+    }
+
+g96_12:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_12;
+    default:
+        stack.push(2);
+        goto e2_12;
+    }
+
+g96_13:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_13;
+    default:
+        stack.push(2);
+        goto e2_13;
+    }
+
+g96_14:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_14;
+    default:
+        stack.push(2);
+        goto e2_14;
+    }
+
+g96_15:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_15;
+    default:
+        stack.push(2);
+        goto e2_15;
+    }
+
+g96_16:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_16;
+    default:
+        stack.push(2);
+        goto e2_16;
+    }
+
+g96_17:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_17;
+    default:
+        stack.push(2);
+        goto e2_17;
+    }
+
+g96_18:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_18;
+    default:
+        stack.push(2);
+        goto e2_18;
+    }
+
+g96_21:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_21;
+    default:
+        stack.push(2);
+        goto e2_21;
+    }
+
+g96_29:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_29;
+    default:
+        stack.push(2);
+        goto e2_29;
+    }
+
+g96_51:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_51;
+    default:
+        stack.push(2);
+        goto e2_51;
+    }
+
+g96_52:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_52;
+    default:
+        stack.push(2);
+        goto e2_52;
+    }
+
+g96_60:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_60;
+    default:
+        stack.push(2);
+        goto e2_60;
+    }
+
+g96_61:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_61;
+    default:
+        stack.push(2);
+        goto e2_61;
+    }
+
+g96_63:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_63;
+    default:
+        stack.push(2);
+        goto e2_63;
+    }
+
+g96_64:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_64;
+    default:
+        stack.push(2);
+        goto e2_64;
+    }
+
+g96_65:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_65;
+    default:
+        stack.push(2);
+        goto e2_65;
+    }
+
+g96_66:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_66;
+    default:
+        stack.push(2);
+        goto e2_66;
+    }
+
+g96_79:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_79;
+    default:
+        stack.push(2);
+        goto e2_79;
+    }
+
+g96_86:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_86;
+    default:
+        stack.push(2);
+        goto e2_86;
+    }
+
+g96_87:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_87;
+    default:
+        stack.push(2);
+        goto e2_87;
+    }
+
+g96_88:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_88;
+    default:
+        stack.push(2);
+        goto e2_88;
+    }
+
+g96_89:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_89;
+    default:
+        stack.push(2);
+        goto e2_89;
+    }
+
+g96_90:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_90;
+    default:
+        stack.push(2);
+        goto e2_90;
+    }
+
+g96_91:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_91;
+    default:
+        stack.push(2);
+        goto e2_91;
+    }
+
+g96_92:
+    switch (stack.top())
+    {
+    case 1:
+        stack.push(52);
+        goto e52_92;
+    default:
+        stack.push(2);
+        goto e2_92;
+    }
+
+g97_0:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_0;
+    default:
+        stack.push(3);
+        goto e3_0;
+    }
+
+g97_1:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_1;
+    default:
+        stack.push(3);
+        goto e3_1;
+    }
+
+g97_2:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_2;
+    default:
+        stack.push(3);
+        goto e3_2;
+    }
+
+g97_3:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_3;
+    default:
+        stack.push(3);
+        goto e3_3;
+    }
+
+g97_9:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_9;
+    default:
+        stack.push(3);
+        goto e3_9;
+    }
+
+g97_10:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_10;
+    default:
+        stack.push(3);
+        goto e3_10;
+    }
+
+g97_11:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_11;
+    default:
+        stack.push(3);
+        goto e3_11;
+    }
+
+g97_12:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_12;
+    default:
+        stack.push(3);
+        goto e3_12;
+    }
+
+g97_13:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_13;
+    default:
+        stack.push(3);
+        goto e3_13;
+    }
+
+g97_14:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_14;
+    default:
+        stack.push(3);
+        goto e3_14;
+    }
+
+g97_15:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_15;
+    default:
+        stack.push(3);
+        goto e3_15;
+    }
+
+g97_16:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_16;
+    default:
+        stack.push(3);
+        goto e3_16;
+    }
+
+g97_17:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_17;
+    default:
+        stack.push(3);
+        goto e3_17;
+    }
+
+g97_18:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_18;
+    default:
+        stack.push(3);
+        goto e3_18;
+    }
+
+g97_21:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_21;
+    default:
+        stack.push(3);
+        goto e3_21;
+    }
+
+g97_29:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_29;
+    default:
+        stack.push(3);
+        goto e3_29;
+    }
+
+g97_51:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_51;
+    default:
+        stack.push(3);
+        goto e3_51;
+    }
+
+g97_52:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_52;
+    default:
+        stack.push(3);
+        goto e3_52;
+    }
+
+g97_60:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_60;
+    default:
+        stack.push(3);
+        goto e3_60;
+    }
+
+g97_61:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_61;
+    default:
+        stack.push(3);
+        goto e3_61;
+    }
+
+g97_63:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_63;
+    default:
+        stack.push(3);
+        goto e3_63;
+    }
+
+g97_64:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_64;
+    default:
+        stack.push(3);
+        goto e3_64;
+    }
+
+g97_65:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_65;
+    default:
+        stack.push(3);
+        goto e3_65;
+    }
+
+g97_66:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_66;
+    default:
+        stack.push(3);
+        goto e3_66;
+    }
+
+g97_79:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_79;
+    default:
+        stack.push(3);
+        goto e3_79;
+    }
+
+g97_86:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_86;
+    default:
+        stack.push(3);
+        goto e3_86;
+    }
+
+g97_87:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_87;
+    default:
+        stack.push(3);
+        goto e3_87;
+    }
+
+g97_88:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_88;
+    default:
+        stack.push(3);
+        goto e3_88;
+    }
+
+g97_89:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_89;
+    default:
+        stack.push(3);
+        goto e3_89;
+    }
+
+g97_90:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_90;
+    default:
+        stack.push(3);
+        goto e3_90;
+    }
+
+g97_91:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_91;
+    default:
+        stack.push(3);
+        goto e3_91;
+    }
+
+g97_92:
+    switch (stack.top())
+    {
+    case 2: case 52:
+        stack.push(53);
+        goto e53_92;
+    default:
+        stack.push(3);
+        goto e3_92;
+    }
+
+g98_0:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_0;
+    }
+
+g98_1:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_1;
+    }
+
+g98_2:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_2;
+    }
+
+g98_3:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_3;
+    }
+
+g98_9:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_9;
+    }
+
+g98_10:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_10;
+    }
+
+g98_11:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_11;
+    }
+
+g98_12:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_12;
+    }
+
+g98_13:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_13;
+    }
+
+g98_14:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_14;
+    }
+
+g98_15:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_15;
+    }
+
+g98_16:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_16;
+    }
+
+g98_17:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_17;
+    }
+
+g98_18:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_18;
+    }
+
+g98_21:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_21;
+    }
+
+g98_29:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_29;
+    }
+
+g98_51:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_51;
+    }
+
+g98_52:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_52;
+    }
+
+g98_60:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_60;
+    }
+
+g98_61:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_61;
+    }
+
+g98_63:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_63;
+    }
+
+g98_64:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_64;
+    }
+
+g98_65:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_65;
+    }
+
+g98_66:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_66;
+    }
+
+g98_79:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_79;
+    }
+
+g98_86:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_86;
+    }
+
+g98_87:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_87;
+    }
+
+g98_88:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_88;
+    }
+
+g98_89:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_89;
+    }
+
+g98_90:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_90;
+    }
+
+g98_91:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_91;
+    }
+
+g98_92:
+    switch (stack.top())
+    {
+    default:
+        stack.push(5);
+        goto e5_92;
+    }
+
+g99_54:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_54;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_54;
+    default:
+        stack.push(72);
+        goto e72_54;
+    }
+
+g99_55:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_55;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_55;
+    default:
+        stack.push(72);
+        goto e72_55;
+    }
+
+g99_58:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_58;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_58;
+    default:
+        stack.push(72);
+        goto e72_58;
+    }
+
+g99_59:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_59;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_59;
+    default:
+        stack.push(72);
+        goto e72_59;
+    }
+
+g99_63:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_63;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_63;
+    default:
+        stack.push(72);
+        goto e72_63;
+    }
+
+g99_65:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_65;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_65;
+    default:
+        stack.push(72);
+        goto e72_65;
+    }
+
+g99_67:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_67;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_67;
+    default:
+        stack.push(72);
+        goto e72_67;
+    }
+
+g99_68:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_68;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_68;
+    default:
+        stack.push(72);
+        goto e72_68;
+    }
+
+g99_69:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_69;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_69;
+    default:
+        stack.push(72);
+        goto e72_69;
+    }
+
+g99_70:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_70;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_70;
+    default:
+        stack.push(72);
+        goto e72_70;
+    }
+
+g99_71:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_71;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_71;
+    default:
+        stack.push(72);
+        goto e72_71;
+    }
+
+g99_72:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_72;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_72;
+    default:
+        stack.push(72);
+        goto e72_72;
+    }
+
+g99_73:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_73;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_73;
+    default:
+        stack.push(72);
+        goto e72_73;
+    }
+
+g99_74:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_74;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_74;
+    default:
+        stack.push(72);
+        goto e72_74;
+    }
+
+g99_75:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_75;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_75;
+    default:
+        stack.push(72);
+        goto e72_75;
+    }
+
+g99_77:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_77;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_77;
+    default:
+        stack.push(72);
+        goto e72_77;
+    }
+
+g99_78:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_78;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_78;
+    default:
+        stack.push(72);
+        goto e72_78;
+    }
+
+g99_80:
+    switch (stack.top())
+    {
+    case 0: case 1: case 2: case 52:
+        stack.push(13);
+        goto e13_80;
+    case 77: case 127:
+        stack.push(135);
+        goto e135_80;
+    default:
+        stack.push(72);
+        goto e72_80;
+    }
+
+g100_55:
+    switch (stack.top())
+    {
+    default:
+        stack.push(140);
+        goto e140_55;
+    }
+
+g100_59:
+    switch (stack.top())
+    {
+    default:
+        stack.push(140);
+        goto e140_59;
+    }
+
+g101_55:
+    switch (stack.top())
+    {
+    case 189:
+        stack.push(224);
+        goto e224_55;
+    default:
+        stack.push(142);
+        goto e142_55;
+    }
+
+g101_59:
+    switch (stack.top())
+    {
+    case 189:
+        stack.push(224);
+        goto e224_59;
+    default:
+        stack.push(142);
+        goto e142_59;
+    }
+
+g102_0:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_0;
+    }
+
+g102_1:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_1;
+    }
+
+g102_2:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_2;
+    }
+
+g102_3:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_3;
+    }
+
+g102_9:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_9;
+    }
+
+g102_10:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_10;
+    }
+
+g102_11:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_11;
+    }
+
+g102_12:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_12;
+    }
+
+g102_13:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_13;
+    }
+
+g102_14:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_14;
+    }
+
+g102_15:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_15;
+    }
+
+g102_16:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_16;
+    }
+
+g102_17:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_17;
+    }
+
+g102_18:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_18;
+    }
+
+g102_21:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_21;
+    }
+
+g102_29:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_29;
+    }
+
+g102_51:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_51;
+    }
+
+g102_52:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_52;
+    }
+
+g102_60:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_60;
+    }
+
+g102_61:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_61;
+    }
+
+g102_63:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_63;
+    }
+
+g102_64:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_64;
+    }
+
+g102_65:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_65;
+    }
+
+g102_66:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_66;
+    }
+
+g102_79:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_79;
+    }
+
+g102_86:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_86;
+    }
+
+g102_87:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_87;
+    }
+
+g102_88:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_88;
+    }
+
+g102_89:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_89;
+    }
+
+g102_90:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_90;
+    }
+
+g102_91:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_91;
+    }
+
+g102_92:
+    switch (stack.top())
+    {
+    default:
+        stack.push(4);
+        goto e4_92;
+    }
+
+g103_58:
+    switch (stack.top())
+    {
+    case 168:
+        stack.push(208);
+        goto e208_58;
+    case 176:
+        stack.push(218);
+        goto e218_58;
+    case 257:
+        stack.push(278);
+        goto e278_58;
+    case 270:
+        stack.push(287);
+        goto e287_58;
+    default:
+        stack.push(191);
+        goto e191_58;
+    }
+
+g104_0:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_0;
+    }
+
+g104_1:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_1;
+    }
+
+g104_2:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_2;
+    }
+
+g104_3:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_3;
+    }
+
+g104_9:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_9;
+    }
+
+g104_10:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_10;
+    }
+
+g104_11:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_11;
+    }
+
+g104_12:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_12;
+    }
+
+g104_13:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_13;
+    }
+
+g104_14:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_14;
+    }
+
+g104_15:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_15;
+    }
+
+g104_16:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_16;
+    }
+
+g104_17:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_17;
+    }
+
+g104_18:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_18;
+    }
+
+g104_21:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_21;
+    }
+
+g104_29:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_29;
+    }
+
+g104_51:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_51;
+    }
+
+g104_52:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_52;
+    }
+
+g104_60:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_60;
+    }
+
+g104_61:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_61;
+    }
+
+g104_63:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_63;
+    }
+
+g104_64:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_64;
+    }
+
+g104_65:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_65;
+    }
+
+g104_66:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_66;
+    }
+
+g104_79:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_79;
+    }
+
+g104_86:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_86;
+    }
+
+g104_87:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_87;
+    }
+
+g104_88:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_88;
+    }
+
+g104_89:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_89;
+    }
+
+g104_90:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_90;
+    }
+
+g104_91:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_91;
+    }
+
+g104_92:
+    switch (stack.top())
+    {
+    default:
+        stack.push(164);
+        goto e164_92;
+    }
+
+g105_1:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_1;
+    default:
+        stack.push(129);
+        goto e129_1;
+    }
+
+g105_2:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_2;
+    default:
+        stack.push(129);
+        goto e129_2;
+    }
+
+g105_3:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_3;
+    default:
+        stack.push(129);
+        goto e129_3;
+    }
+
+g105_9:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_9;
+    default:
+        stack.push(129);
+        goto e129_9;
+    }
+
+g105_10:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_10;
+    default:
+        stack.push(129);
+        goto e129_10;
+    }
+
+g105_11:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_11;
+    default:
+        stack.push(129);
+        goto e129_11;
+    }
+
+g105_12:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_12;
+    default:
+        stack.push(129);
+        goto e129_12;
+    }
+
+g105_13:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_13;
+    default:
+        stack.push(129);
+        goto e129_13;
+    }
+
+g105_14:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_14;
+    default:
+        stack.push(129);
+        goto e129_14;
+    }
+
+g105_15:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_15;
+    default:
+        stack.push(129);
+        goto e129_15;
+    }
+
+g105_16:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_16;
+    default:
+        stack.push(129);
+        goto e129_16;
+    }
+
+g105_17:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_17;
+    default:
+        stack.push(129);
+        goto e129_17;
+    }
+
+g105_18:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_18;
+    default:
+        stack.push(129);
+        goto e129_18;
+    }
+
+g105_21:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_21;
+    default:
+        stack.push(129);
+        goto e129_21;
+    }
+
+g105_51:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_51;
+    default:
+        stack.push(129);
+        goto e129_51;
+    }
+
+g105_52:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_52;
+    default:
+        stack.push(129);
+        goto e129_52;
+    }
+
+g105_60:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_60;
+    default:
+        stack.push(129);
+        goto e129_60;
+    }
+
+g105_61:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_61;
+    default:
+        stack.push(129);
+        goto e129_61;
+    }
+
+g105_62:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_62;
+    default:
+        stack.push(129);
+        goto e129_62;
+    }
+
+g105_63:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_63;
+    default:
+        stack.push(129);
+        goto e129_63;
+    }
+
+g105_64:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_64;
+    default:
+        stack.push(129);
+        goto e129_64;
+    }
+
+g105_65:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_65;
+    default:
+        stack.push(129);
+        goto e129_65;
+    }
+
+g105_66:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_66;
+    default:
+        stack.push(129);
+        goto e129_66;
+    }
+
+g105_79:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_79;
+    default:
+        stack.push(129);
+        goto e129_79;
+    }
+
+g105_86:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_86;
+    default:
+        stack.push(129);
+        goto e129_86;
+    }
+
+g105_87:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_87;
+    default:
+        stack.push(129);
+        goto e129_87;
+    }
+
+g105_88:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_88;
+    default:
+        stack.push(129);
+        goto e129_88;
+    }
+
+g105_89:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_89;
+    default:
+        stack.push(129);
+        goto e129_89;
+    }
+
+g105_90:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_90;
+    default:
+        stack.push(129);
+        goto e129_90;
+    }
+
+g105_91:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_91;
+    default:
+        stack.push(129);
+        goto e129_91;
+    }
+
+g105_92:
+    switch (stack.top())
+    {
+    case 273:
+        stack.push(288);
+        goto e288_92;
+    default:
+        stack.push(129);
+        goto e129_92;
+    }
+
+g106_92:
+    switch (stack.top())
+    {
+    case 67:
+        stack.push(117);
+        goto e117_92;
+    case 77: case 127: case 273:
+        stack.push(137);
+        goto e137_92;
+    case 165: case 169: case 228:
+        stack.push(203);
+        goto e203_92;
+    default:
+        stack.push(6);
+        goto e6_92;
+    }
+
+g107_54:
+    switch (stack.top())
+    {
+    case 186:
+        stack.push(222);
+        goto e222_54;
+    case 259:
+        stack.push(280);
+        goto e280_54;
+    default:
+        stack.push(205);
+        goto e205_54;
+    }
+
+g107_55:
+    switch (stack.top())
+    {
+    case 186:
+        stack.push(222);
+        goto e222_55;
+    case 259:
+        stack.push(280);
+        goto e280_55;
+    default:
+        stack.push(205);
+        goto e205_55;
+    }
+
+g108_54:
+    switch (stack.top())
+    {
+    case 232:
+        stack.push(255);
+        goto e255_54;
+    default:
+        stack.push(206);
+        goto e206_54;
+    }
+
+g108_55:
+    switch (stack.top())
+    {
+    case 232:
+        stack.push(255);
+        goto e255_55;
+    default:
+        stack.push(206);
+        goto e206_55;
+    }
+
+g109_55:
+    switch (stack.top())
+    {
+    case 169:
+        stack.push(209);
+        goto e209_55;
+    default:
+        stack.push(200);
+        goto e200_55;
+    }
+
+g109_59:
+    switch (stack.top())
+    {
+    case 169:
+        stack.push(209);
+        goto e209_59;
+    default:
+        stack.push(200);
+        goto e200_59;
+    }
+
+g110_55:
+    switch (stack.top())
+    {
+    case 228:
+        stack.push(251);
+        goto e251_55;
+    default:
+        stack.push(202);
+        goto e202_55;
+    }
+
+g110_59:
+    switch (stack.top())
+    {
+    case 228:
+        stack.push(251);
+        goto e251_59;
+    default:
+        stack.push(202);
+        goto e202_59;
+    }
+
+g111_0:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        errorState = 133;
+        goto error;
+    case 170:
+        stack.push(211);
+        goto e211_0;
+    case 171:
+        stack.push(212);
+        goto e212_0;
+    case 229:
+        stack.push(252);
+        goto e252_0;
+    case 237:
+        stack.push(261);
+        goto e261_0;
+    case 238:
+        stack.push(262);
+        goto e262_0;
+    case 250:
+        stack.push(274);
+        goto e274_0;
+    case 260:
+        stack.push(281);
+        goto e281_0;
+    case 282:
+        stack.push(292);
+        goto e292_0;
+    default:
+        stack.push(11);
+        goto e11_0;
+    }
+
+g111_1:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_1;
+    case 170:
+        stack.push(211);
+        goto e211_1;
+    case 171:
+        stack.push(212);
+        goto e212_1;
+    case 229:
+        stack.push(252);
+        goto e252_1;
+    case 237:
+        stack.push(261);
+        goto e261_1;
+    case 238:
+        stack.push(262);
+        goto e262_1;
+    case 250:
+        stack.push(274);
+        goto e274_1;
+    case 260:
+        stack.push(281);
+        goto e281_1;
+    case 282:
+        stack.push(292);
+        goto e292_1;
+    default:
+        stack.push(11);
+        goto e11_1;
+    }
+
+g111_2:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_2;
+    case 170:
+        stack.push(211);
+        goto e211_2;
+    case 171:
+        stack.push(212);
+        goto e212_2;
+    case 229:
+        stack.push(252);
+        goto e252_2;
+    case 237:
+        stack.push(261);
+        goto e261_2;
+    case 238:
+        stack.push(262);
+        goto e262_2;
+    case 250:
+        stack.push(274);
+        goto e274_2;
+    case 260:
+        stack.push(281);
+        goto e281_2;
+    case 282:
+        stack.push(292);
+        goto e292_2;
+    default:
+        stack.push(11);
+        goto e11_2;
+    }
+
+g111_3:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_3;
+    case 170:
+        stack.push(211);
+        goto e211_3;
+    case 171:
+        stack.push(212);
+        goto e212_3;
+    case 229:
+        stack.push(252);
+        goto e252_3;
+    case 237:
+        stack.push(261);
+        goto e261_3;
+    case 238:
+        stack.push(262);
+        goto e262_3;
+    case 250:
+        stack.push(274);
+        goto e274_3;
+    case 260:
+        stack.push(281);
+        goto e281_3;
+    case 282:
+        stack.push(292);
+        goto e292_3;
+    default:
+        stack.push(11);
+        goto e11_3;
+    }
+
+g111_5:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        errorState = 133;
+        goto error;
+    case 170:
+        stack.push(211);
+        goto e211_5;
+    case 171:
+        stack.push(212);
+        errorState = 212;
+        goto error;
+    case 229:
+        stack.push(252);
+        errorState = 252;
+        goto error;
+    case 237:
+        stack.push(261);
+        errorState = 261;
+        goto error;
+    case 238:
+        stack.push(262);
+        errorState = 262;
+        goto error;
+    case 250:
+        stack.push(274);
+        errorState = 274;
+        goto error;
+    case 260:
+        stack.push(281);
+        errorState = 281;
+        goto error;
+    case 282:
+        stack.push(292);
+        errorState = 292;
+        goto error;
+    default:
+        stack.push(11);
+        errorState = 11;
+        goto error;
+    }
+
+g111_9:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_9;
+    case 170:
+        stack.push(211);
+        goto e211_9;
+    case 171:
+        stack.push(212);
+        goto e212_9;
+    case 229:
+        stack.push(252);
+        goto e252_9;
+    case 237:
+        stack.push(261);
+        goto e261_9;
+    case 238:
+        stack.push(262);
+        goto e262_9;
+    case 250:
+        stack.push(274);
+        goto e274_9;
+    case 260:
+        stack.push(281);
+        goto e281_9;
+    case 282:
+        stack.push(292);
+        goto e292_9;
+    default:
+        stack.push(11);
+        goto e11_9;
+    }
+
+g111_10:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_10;
+    case 170:
+        stack.push(211);
+        goto e211_10;
+    case 171:
+        stack.push(212);
+        goto e212_10;
+    case 229:
+        stack.push(252);
+        goto e252_10;
+    case 237:
+        stack.push(261);
+        goto e261_10;
+    case 238:
+        stack.push(262);
+        goto e262_10;
+    case 250:
+        stack.push(274);
+        goto e274_10;
+    case 260:
+        stack.push(281);
+        goto e281_10;
+    case 282:
+        stack.push(292);
+        goto e292_10;
+    default:
+        stack.push(11);
+        goto e11_10;
+    }
+
+g111_11:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_11;
+    case 170:
+        stack.push(211);
+        goto e211_11;
+    case 171:
+        stack.push(212);
+        goto e212_11;
+    case 229:
+        stack.push(252);
+        goto e252_11;
+    case 237:
+        stack.push(261);
+        goto e261_11;
+    case 238:
+        stack.push(262);
+        goto e262_11;
+    case 250:
+        stack.push(274);
+        goto e274_11;
+    case 260:
+        stack.push(281);
+        goto e281_11;
+    case 282:
+        stack.push(292);
+        goto e292_11;
+    default:
+        stack.push(11);
+        goto e11_11;
+    }
+
+g111_12:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_12;
+    case 170:
+        stack.push(211);
+        goto e211_12;
+    case 171:
+        stack.push(212);
+        goto e212_12;
+    case 229:
+        stack.push(252);
+        goto e252_12;
+    case 237:
+        stack.push(261);
+        goto e261_12;
+    case 238:
+        stack.push(262);
+        goto e262_12;
+    case 250:
+        stack.push(274);
+        goto e274_12;
+    case 260:
+        stack.push(281);
+        goto e281_12;
+    case 282:
+        stack.push(292);
+        goto e292_12;
+    default:
+        stack.push(11);
+        goto e11_12;
+    }
+
+g111_13:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_13;
+    case 170:
+        stack.push(211);
+        goto e211_13;
+    case 171:
+        stack.push(212);
+        goto e212_13;
+    case 229:
+        stack.push(252);
+        goto e252_13;
+    case 237:
+        stack.push(261);
+        goto e261_13;
+    case 238:
+        stack.push(262);
+        goto e262_13;
+    case 250:
+        stack.push(274);
+        goto e274_13;
+    case 260:
+        stack.push(281);
+        goto e281_13;
+    case 282:
+        stack.push(292);
+        goto e292_13;
+    default:
+        stack.push(11);
+        goto e11_13;
+    }
+
+g111_14:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        goto e68_14;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_14;
+    case 170:
+        stack.push(211);
+        goto e211_14;
+    case 171:
+        stack.push(212);
+        goto e212_14;
+    case 229:
+        stack.push(252);
+        goto e252_14;
+    case 237:
+        stack.push(261);
+        goto e261_14;
+    case 238:
+        stack.push(262);
+        goto e262_14;
+    case 250:
+        stack.push(274);
+        goto e274_14;
+    case 260:
+        stack.push(281);
+        goto e281_14;
+    case 282:
+        stack.push(292);
+        goto e292_14;
+    default:
+        stack.push(11);
+        goto e11_14;
+    }
+
+g111_15:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_15;
+    case 170:
+        stack.push(211);
+        goto e211_15;
+    case 171:
+        stack.push(212);
+        goto e212_15;
+    case 229:
+        stack.push(252);
+        goto e252_15;
+    case 237:
+        stack.push(261);
+        goto e261_15;
+    case 238:
+        stack.push(262);
+        goto e262_15;
+    case 250:
+        stack.push(274);
+        goto e274_15;
+    case 260:
+        stack.push(281);
+        goto e281_15;
+    case 282:
+        stack.push(292);
+        goto e292_15;
+    default:
+        stack.push(11);
+        goto e11_15;
+    }
+
+g111_16:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_16;
+    case 170:
+        stack.push(211);
+        goto e211_16;
+    case 171:
+        stack.push(212);
+        goto e212_16;
+    case 229:
+        stack.push(252);
+        goto e252_16;
+    case 237:
+        stack.push(261);
+        goto e261_16;
+    case 238:
+        stack.push(262);
+        goto e262_16;
+    case 250:
+        stack.push(274);
+        goto e274_16;
+    case 260:
+        stack.push(281);
+        goto e281_16;
+    case 282:
+        stack.push(292);
+        goto e292_16;
+    default:
+        stack.push(11);
+        goto e11_16;
+    }
+
+g111_17:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_17;
+    case 170:
+        stack.push(211);
+        goto e211_17;
+    case 171:
+        stack.push(212);
+        goto e212_17;
+    case 229:
+        stack.push(252);
+        goto e252_17;
+    case 237:
+        stack.push(261);
+        goto e261_17;
+    case 238:
+        stack.push(262);
+        goto e262_17;
+    case 250:
+        stack.push(274);
+        goto e274_17;
+    case 260:
+        stack.push(281);
+        goto e281_17;
+    case 282:
+        stack.push(292);
+        goto e292_17;
+    default:
+        stack.push(11);
+        goto e11_17;
+    }
+
+g111_18:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_18;
+    case 170:
+        stack.push(211);
+        goto e211_18;
+    case 171:
+        stack.push(212);
+        goto e212_18;
+    case 229:
+        stack.push(252);
+        goto e252_18;
+    case 237:
+        stack.push(261);
+        goto e261_18;
+    case 238:
+        stack.push(262);
+        goto e262_18;
+    case 250:
+        stack.push(274);
+        goto e274_18;
+    case 260:
+        stack.push(281);
+        goto e281_18;
+    case 282:
+        stack.push(292);
+        goto e292_18;
+    default:
+        stack.push(11);
+        goto e11_18;
+    }
+
+g111_21:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_21;
+    case 170:
+        stack.push(211);
+        goto e211_21;
+    case 171:
+        stack.push(212);
+        goto e212_21;
+    case 229:
+        stack.push(252);
+        goto e252_21;
+    case 237:
+        stack.push(261);
+        goto e261_21;
+    case 238:
+        stack.push(262);
+        goto e262_21;
+    case 250:
+        stack.push(274);
+        goto e274_21;
+    case 260:
+        stack.push(281);
+        goto e281_21;
+    case 282:
+        stack.push(292);
+        goto e292_21;
+    default:
+        stack.push(11);
+        goto e11_21;
+    }
+
+g111_29:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        errorState = 133;
+        goto error;
+    case 170:
+        stack.push(211);
+        goto e211_29;
+    case 171:
+        stack.push(212);
+        goto e212_29;
+    case 229:
+        stack.push(252);
+        goto e252_29;
+    case 237:
+        stack.push(261);
+        goto e261_29;
+    case 238:
+        stack.push(262);
+        goto e262_29;
+    case 250:
+        stack.push(274);
+        goto e274_29;
+    case 260:
+        stack.push(281);
+        goto e281_29;
+    case 282:
+        stack.push(292);
+        goto e292_29;
+    default:
+        stack.push(11);
+        goto e11_29;
+    }
+
+g111_51:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_51;
+    case 170:
+        stack.push(211);
+        goto e211_51;
+    case 171:
+        stack.push(212);
+        goto e212_51;
+    case 229:
+        stack.push(252);
+        goto e252_51;
+    case 237:
+        stack.push(261);
+        goto e261_51;
+    case 238:
+        stack.push(262);
+        goto e262_51;
+    case 250:
+        stack.push(274);
+        goto e274_51;
+    case 260:
+        stack.push(281);
+        goto e281_51;
+    case 282:
+        stack.push(292);
+        goto e292_51;
+    default:
+        stack.push(11);
+        goto e11_51;
+    }
+
+g111_52:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_52;
+    case 170:
+        stack.push(211);
+        goto e211_52;
+    case 171:
+        stack.push(212);
+        goto e212_52;
+    case 229:
+        stack.push(252);
+        goto e252_52;
+    case 237:
+        stack.push(261);
+        goto e261_52;
+    case 238:
+        stack.push(262);
+        goto e262_52;
+    case 250:
+        stack.push(274);
+        goto e274_52;
+    case 260:
+        stack.push(281);
+        goto e281_52;
+    case 282:
+        stack.push(292);
+        goto e292_52;
+    default:
+        stack.push(11);
+        goto e11_52;
+    }
+
+g111_60:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_60;
+    case 170:
+        stack.push(211);
+        goto e211_60;
+    case 171:
+        stack.push(212);
+        goto e212_60;
+    case 229:
+        stack.push(252);
+        goto e252_60;
+    case 237:
+        stack.push(261);
+        goto e261_60;
+    case 238:
+        stack.push(262);
+        goto e262_60;
+    case 250:
+        stack.push(274);
+        goto e274_60;
+    case 260:
+        stack.push(281);
+        goto e281_60;
+    case 282:
+        stack.push(292);
+        goto e292_60;
+    default:
+        stack.push(11);
+        goto e11_60;
+    }
+
+g111_61:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_61;
+    case 170:
+        stack.push(211);
+        goto e211_61;
+    case 171:
+        stack.push(212);
+        goto e212_61;
+    case 229:
+        stack.push(252);
+        goto e252_61;
+    case 237:
+        stack.push(261);
+        goto e261_61;
+    case 238:
+        stack.push(262);
+        goto e262_61;
+    case 250:
+        stack.push(274);
+        goto e274_61;
+    case 260:
+        stack.push(281);
+        goto e281_61;
+    case 282:
+        stack.push(292);
+        goto e292_61;
+    default:
+        stack.push(11);
+        goto e11_61;
+    }
+
+g111_62:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_62;
+    case 170:
+        stack.push(211);
+        goto e211_62;
+    case 171:
+        stack.push(212);
+        goto e212_62;
+    case 229:
+        stack.push(252);
+        errorState = 252;
+        goto error;
+    case 237:
+        stack.push(261);
+        errorState = 261;
+        goto error;
+    case 238:
+        stack.push(262);
+        goto e262_62;
+    case 250:
+        stack.push(274);
+        errorState = 274;
+        goto error;
+    case 260:
+        stack.push(281);
+        errorState = 281;
+        goto error;
+    case 282:
+        stack.push(292);
+        goto e292_62;
+    default:
+        stack.push(11);
+        errorState = 11;
+        goto error;
+    }
+
+g111_63:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_63;
+    case 170:
+        stack.push(211);
+        goto e211_63;
+    case 171:
+        stack.push(212);
+        goto e212_63;
+    case 229:
+        stack.push(252);
+        goto e252_63;
+    case 237:
+        stack.push(261);
+        goto e261_63;
+    case 238:
+        stack.push(262);
+        goto e262_63;
+    case 250:
+        stack.push(274);
+        goto e274_63;
+    case 260:
+        stack.push(281);
+        goto e281_63;
+    case 282:
+        stack.push(292);
+        goto e292_63;
+    default:
+        stack.push(11);
+        goto e11_63;
+    }
+
+g111_64:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_64;
+    case 170:
+        stack.push(211);
+        goto e211_64;
+    case 171:
+        stack.push(212);
+        goto e212_64;
+    case 229:
+        stack.push(252);
+        goto e252_64;
+    case 237:
+        stack.push(261);
+        goto e261_64;
+    case 238:
+        stack.push(262);
+        goto e262_64;
+    case 250:
+        stack.push(274);
+        goto e274_64;
+    case 260:
+        stack.push(281);
+        goto e281_64;
+    case 282:
+        stack.push(292);
+        goto e292_64;
+    default:
+        stack.push(11);
+        goto e11_64;
+    }
+
+g111_65:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_65;
+    case 170:
+        stack.push(211);
+        goto e211_65;
+    case 171:
+        stack.push(212);
+        goto e212_65;
+    case 229:
+        stack.push(252);
+        goto e252_65;
+    case 237:
+        stack.push(261);
+        goto e261_65;
+    case 238:
+        stack.push(262);
+        goto e262_65;
+    case 250:
+        stack.push(274);
+        goto e274_65;
+    case 260:
+        stack.push(281);
+        goto e281_65;
+    case 282:
+        stack.push(292);
+        goto e292_65;
+    default:
+        stack.push(11);
+        goto e11_65;
+    }
+
+g111_66:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_66;
+    case 170:
+        stack.push(211);
+        goto e211_66;
+    case 171:
+        stack.push(212);
+        goto e212_66;
+    case 229:
+        stack.push(252);
+        goto e252_66;
+    case 237:
+        stack.push(261);
+        goto e261_66;
+    case 238:
+        stack.push(262);
+        goto e262_66;
+    case 250:
+        stack.push(274);
+        goto e274_66;
+    case 260:
+        stack.push(281);
+        goto e281_66;
+    case 282:
+        stack.push(292);
+        goto e292_66;
+    default:
+        stack.push(11);
+        goto e11_66;
+    }
+
+g111_79:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_79;
+    case 170:
+        stack.push(211);
+        goto e211_79;
+    case 171:
+        stack.push(212);
+        goto e212_79;
+    case 229:
+        stack.push(252);
+        goto e252_79;
+    case 237:
+        stack.push(261);
+        goto e261_79;
+    case 238:
+        stack.push(262);
+        goto e262_79;
+    case 250:
+        stack.push(274);
+        goto e274_79;
+    case 260:
+        stack.push(281);
+        goto e281_79;
+    case 282:
+        stack.push(292);
+        goto e292_79;
+    default:
+        stack.push(11);
+        goto e11_79;
+    }
+
+g111_86:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_86;
+    case 170:
+        stack.push(211);
+        goto e211_86;
+    case 171:
+        stack.push(212);
+        goto e212_86;
+    case 229:
+        stack.push(252);
+        goto e252_86;
+    case 237:
+        stack.push(261);
+        goto e261_86;
+    case 238:
+        stack.push(262);
+        goto e262_86;
+    case 250:
+        stack.push(274);
+        goto e274_86;
+    case 260:
+        stack.push(281);
+        goto e281_86;
+    case 282:
+        stack.push(292);
+        goto e292_86;
+    default:
+        stack.push(11);
+        goto e11_86;
+    }
+
+g111_87:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_87;
+    case 170:
+        stack.push(211);
+        goto e211_87;
+    case 171:
+        stack.push(212);
+        goto e212_87;
+    case 229:
+        stack.push(252);
+        goto e252_87;
+    case 237:
+        stack.push(261);
+        goto e261_87;
+    case 238:
+        stack.push(262);
+        goto e262_87;
+    case 250:
+        stack.push(274);
+        goto e274_87;
+    case 260:
+        stack.push(281);
+        goto e281_87;
+    case 282:
+        stack.push(292);
+        goto e292_87;
+    default:
+        stack.push(11);
+        goto e11_87;
+    }
+
+g111_88:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_88;
+    case 170:
+        stack.push(211);
+        goto e211_88;
+    case 171:
+        stack.push(212);
+        goto e212_88;
+    case 229:
+        stack.push(252);
+        goto e252_88;
+    case 237:
+        stack.push(261);
+        goto e261_88;
+    case 238:
+        stack.push(262);
+        goto e262_88;
+    case 250:
+        stack.push(274);
+        goto e274_88;
+    case 260:
+        stack.push(281);
+        goto e281_88;
+    case 282:
+        stack.push(292);
+        goto e292_88;
+    default:
+        stack.push(11);
+        goto e11_88;
+    }
+
+g111_89:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_89;
+    case 170:
+        stack.push(211);
+        goto e211_89;
+    case 171:
+        stack.push(212);
+        goto e212_89;
+    case 229:
+        stack.push(252);
+        goto e252_89;
+    case 237:
+        stack.push(261);
+        goto e261_89;
+    case 238:
+        stack.push(262);
+        goto e262_89;
+    case 250:
+        stack.push(274);
+        goto e274_89;
+    case 260:
+        stack.push(281);
+        goto e281_89;
+    case 282:
+        stack.push(292);
+        goto e292_89;
+    default:
+        stack.push(11);
+        goto e11_89;
+    }
+
+g111_90:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_90;
+    case 170:
+        stack.push(211);
+        goto e211_90;
+    case 171:
+        stack.push(212);
+        goto e212_90;
+    case 229:
+        stack.push(252);
+        goto e252_90;
+    case 237:
+        stack.push(261);
+        goto e261_90;
+    case 238:
+        stack.push(262);
+        goto e262_90;
+    case 250:
+        stack.push(274);
+        goto e274_90;
+    case 260:
+        stack.push(281);
+        goto e281_90;
+    case 282:
+        stack.push(292);
+        goto e292_90;
+    default:
+        stack.push(11);
+        goto e11_90;
+    }
+
+g111_91:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_91;
+    case 170:
+        stack.push(211);
+        goto e211_91;
+    case 171:
+        stack.push(212);
+        goto e212_91;
+    case 229:
+        stack.push(252);
+        goto e252_91;
+    case 237:
+        stack.push(261);
+        goto e261_91;
+    case 238:
+        stack.push(262);
+        goto e262_91;
+    case 250:
+        stack.push(274);
+        goto e274_91;
+    case 260:
+        stack.push(281);
+        goto e281_91;
+    case 282:
+        stack.push(292);
+        goto e292_91;
+    default:
+        stack.push(11);
+        goto e11_91;
+    }
+
+g111_92:
+    switch (stack.top())
+    {
+    case 24:
+        stack.push(68);
+        errorState = 68;
+        goto error;
+    case 77: case 127:
+        stack.push(133);
+        goto e133_92;
+    case 170:
+        stack.push(211);
+        goto e211_92;
+    case 171:
+        stack.push(212);
+        goto e212_92;
+    case 229:
+        stack.push(252);
+        goto e252_92;
+    case 237:
+        stack.push(261);
+        goto e261_92;
+    case 238:
+        stack.push(262);
+        goto e262_92;
+    case 250:
+        stack.push(274);
+        goto e274_92;
+    case 260:
+        stack.push(281);
+        goto e281_92;
+    case 282:
+        stack.push(292);
+        goto e292_92;
+    default:
+        stack.push(11);
+        goto e11_92;
+    }
+
+g112_1:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_1;
+    }
+
+g112_2:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_2;
+    }
+
+g112_3:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_3;
+    }
+
+g112_9:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_9;
+    }
+
+g112_10:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_10;
+    }
+
+g112_11:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_11;
+    }
+
+g112_12:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_12;
+    }
+
+g112_13:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_13;
+    }
+
+g112_14:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_14;
+    }
+
+g112_15:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_15;
+    }
+
+g112_16:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_16;
+    }
+
+g112_17:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_17;
+    }
+
+g112_18:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_18;
+    }
+
+g112_21:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_21;
+    }
+
+g112_51:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_51;
+    }
+
+g112_52:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_52;
+    }
+
+g112_60:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_60;
+    }
+
+g112_61:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_61;
+    }
+
+g112_62:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_62;
+    }
+
+g112_63:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_63;
+    }
+
+g112_64:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_64;
+    }
+
+g112_65:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_65;
+    }
+
+g112_66:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_66;
+    }
+
+g112_79:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_79;
+    }
+
+g112_86:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_86;
+    }
+
+g112_87:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_87;
+    }
+
+g112_88:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_88;
+    }
+
+g112_89:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_89;
+    }
+
+g112_90:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_90;
+    }
+
+g112_91:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_91;
+    }
+
+g112_92:
+    switch (stack.top())
+    {
+    default:
+        stack.push(127);
+        goto e127_92;
+    }
+
+g113_1:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_1;
+    default:
+        stack.push(128);
+        goto e128_1;
+    }
+
+g113_2:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_2;
+    default:
+        stack.push(128);
+        goto e128_2;
+    }
+
+g113_3:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_3;
+    default:
+        stack.push(128);
+        goto e128_3;
+    }
+
+g113_9:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_9;
+    default:
+        stack.push(128);
+        goto e128_9;
+    }
+
+g113_10:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_10;
+    default:
+        stack.push(128);
+        goto e128_10;
+    }
+
+g113_11:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_11;
+    default:
+        stack.push(128);
+        goto e128_11;
+    }
+
+g113_12:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_12;
+    default:
+        stack.push(128);
+        goto e128_12;
+    }
+
+g113_13:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_13;
+    default:
+        stack.push(128);
+        goto e128_13;
+    }
+
+g113_14:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_14;
+    default:
+        stack.push(128);
+        goto e128_14;
+    }
+
+g113_15:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_15;
+    default:
+        stack.push(128);
+        goto e128_15;
+    }
+
+g113_16:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_16;
+    default:
+        stack.push(128);
+        goto e128_16;
+    }
+
+g113_17:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_17;
+    default:
+        stack.push(128);
+        goto e128_17;
+    }
+
+g113_18:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_18;
+    default:
+        stack.push(128);
+        goto e128_18;
+    }
+
+g113_21:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_21;
+    default:
+        stack.push(128);
+        goto e128_21;
+    }
+
+g113_51:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_51;
+    default:
+        stack.push(128);
+        goto e128_51;
+    }
+
+g113_52:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_52;
+    default:
+        stack.push(128);
+        goto e128_52;
+    }
+
+g113_60:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_60;
+    default:
+        stack.push(128);
+        goto e128_60;
+    }
+
+g113_61:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_61;
+    default:
+        stack.push(128);
+        goto e128_61;
+    }
+
+g113_62:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_62;
+    default:
+        stack.push(128);
+        goto e128_62;
+    }
+
+g113_63:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_63;
+    default:
+        stack.push(128);
+        goto e128_63;
+    }
+
+g113_64:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_64;
+    default:
+        stack.push(128);
+        goto e128_64;
+    }
+
+g113_65:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_65;
+    default:
+        stack.push(128);
+        goto e128_65;
+    }
+
+g113_66:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_66;
+    default:
+        stack.push(128);
+        goto e128_66;
+    }
+
+g113_79:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_79;
+    default:
+        stack.push(128);
+        goto e128_79;
+    }
+
+g113_86:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_86;
+    default:
+        stack.push(128);
+        goto e128_86;
+    }
+
+g113_87:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_87;
+    default:
+        stack.push(128);
+        goto e128_87;
+    }
+
+g113_88:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_88;
+    default:
+        stack.push(128);
+        goto e128_88;
+    }
+
+g113_89:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_89;
+    default:
+        stack.push(128);
+        goto e128_89;
+    }
+
+g113_90:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_90;
+    default:
+        stack.push(128);
+        goto e128_90;
+    }
+
+g113_91:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_91;
+    default:
+        stack.push(128);
+        goto e128_91;
+    }
+
+g113_92:
+    switch (stack.top())
+    {
+    case 127:
+        stack.push(183);
+        goto e183_92;
+    default:
+        stack.push(128);
+        goto e128_92;
+    }
+
+g114_1:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_1;
+    }
+
+g114_2:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_2;
+    }
+
+g114_3:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_3;
+    }
+
+g114_9:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_9;
+    }
+
+g114_10:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_10;
+    }
+
+g114_11:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_11;
+    }
+
+g114_12:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_12;
+    }
+
+g114_13:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_13;
+    }
+
+g114_14:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_14;
+    }
+
+g114_15:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_15;
+    }
+
+g114_16:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_16;
+    }
+
+g114_17:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_17;
+    }
+
+g114_18:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_18;
+    }
+
+g114_21:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_21;
+    }
+
+g114_51:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_51;
+    }
+
+g114_52:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_52;
+    }
+
+g114_60:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_60;
+    }
+
+g114_61:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_61;
+    }
+
+g114_62:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_62;
+    }
+
+g114_63:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_63;
+    }
+
+g114_64:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_64;
+    }
+
+g114_65:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_65;
+    }
+
+g114_66:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_66;
+    }
+
+g114_79:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_79;
+    }
+
+g114_86:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_86;
+    }
+
+g114_87:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_87;
+    }
+
+g114_88:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_88;
+    }
+
+g114_89:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_89;
+    }
+
+g114_90:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_90;
+    }
+
+g114_91:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_91;
+    }
+
+g114_92:
+    switch (stack.top())
+    {
+    default:
+        stack.push(134);
+        goto e134_92;
+    }
+
+g115_54:
+    switch (stack.top())
+    {
+    case 74:
+        stack.push(123);
+        goto e123_54;
+    case 77: case 127:
+        stack.push(138);
+        errorState = 138;
+        goto error;
+    case 179:
+        stack.push(220);
+        goto e220_54;
+    default:
+        stack.push(118);
+        errorState = 118;
+        goto error;
+    }
+
+g115_76:
+    switch (stack.top())
+    {
+    case 74:
+        stack.push(123);
+        errorState = 123;
+        goto error;
+    case 77: case 127:
+        stack.push(138);
+        goto e138_76;
+    case 179:
+        stack.push(220);
+        errorState = 220;
+        goto error;
+    default:
+        stack.push(118);
+        goto e118_76;
+    }
+
+g115_81:
+    switch (stack.top())
+    {
+    case 74:
+        stack.push(123);
+        goto e123_81;
+    case 77: case 127:
+        stack.push(138);
+        errorState = 138;
+        goto error;
+    case 179:
+        stack.push(220);
+        goto e220_81;
+    default:
+        stack.push(118);
+        errorState = 118;
+        goto error;
+    }
+
+g116_0:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        errorState = 130;
+        goto error;
+    default:
+        stack.push(8);
+        goto e8_0;
+    }
+
+g116_1:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_1;
+    default:
+        stack.push(8);
+        goto e8_1;
+    }
+
+g116_2:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_2;
+    default:
+        stack.push(8);
+        goto e8_2;
+    }
+
+g116_3:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_3;
+    default:
+        stack.push(8);
+        goto e8_3;
+    }
+
+g116_9:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_9;
+    default:
+        stack.push(8);
+        goto e8_9;
+    }
+
+g116_10:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_10;
+    default:
+        stack.push(8);
+        goto e8_10;
+    }
+
+g116_11:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_11;
+    default:
+        stack.push(8);
+        goto e8_11;
+    }
+
+g116_12:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_12;
+    default:
+        stack.push(8);
+        goto e8_12;
+    }
+
+g116_13:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_13;
+    default:
+        stack.push(8);
+        goto e8_13;
+    }
+
+g116_14:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_14;
+    default:
+        stack.push(8);
+        goto e8_14;
+    }
+
+g116_15:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_15;
+    default:
+        stack.push(8);
+        goto e8_15;
+    }
+
+g116_16:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_16;
+    default:
+        stack.push(8);
+        goto e8_16;
+    }
+
+g116_17:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_17;
+    default:
+        stack.push(8);
+        goto e8_17;
+    }
+
+g116_18:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_18;
+    default:
+        stack.push(8);
+        goto e8_18;
+    }
+
+g116_21:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_21;
+    default:
+        stack.push(8);
+        goto e8_21;
+    }
+
+g116_29:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        errorState = 130;
+        goto error;
+    default:
+        stack.push(8);
+        goto e8_29;
+    }
+
+g116_51:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_51;
+    default:
+        stack.push(8);
+        goto e8_51;
+    }
+
+g116_52:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_52;
+    default:
+        stack.push(8);
+        goto e8_52;
+    }
+
+g116_60:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_60;
+    default:
+        stack.push(8);
+        goto e8_60;
+    }
+
+g116_61:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_61;
+    default:
+        stack.push(8);
+        goto e8_61;
+    }
+
+g116_62:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_62;
+    default:
+        stack.push(8);
+        errorState = 8;
+        goto error;
+    }
+
+g116_63:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_63;
+    default:
+        stack.push(8);
+        goto e8_63;
+    }
+
+g116_64:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_64;
+    default:
+        stack.push(8);
+        goto e8_64;
+    }
+
+g116_65:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_65;
+    default:
+        stack.push(8);
+        goto e8_65;
+    }
+
+g116_66:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_66;
+    default:
+        stack.push(8);
+        goto e8_66;
+    }
+
+g116_79:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_79;
+    default:
+        stack.push(8);
+        goto e8_79;
+    }
+
+g116_86:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_86;
+    default:
+        stack.push(8);
+        goto e8_86;
+    }
+
+g116_87:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_87;
+    default:
+        stack.push(8);
+        goto e8_87;
+    }
+
+g116_88:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_88;
+    default:
+        stack.push(8);
+        goto e8_88;
+    }
+
+g116_89:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_89;
+    default:
+        stack.push(8);
+        goto e8_89;
+    }
+
+g116_90:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_90;
+    default:
+        stack.push(8);
+        goto e8_90;
+    }
+
+g116_91:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_91;
+    default:
+        stack.push(8);
+        goto e8_91;
+    }
+
+g116_92:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(130);
+        goto e130_92;
+    default:
+        stack.push(8);
+        goto e8_92;
+    }
+
+g117_0:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        errorState = 131;
+        goto error;
+    default:
+        stack.push(9);
+        goto e9_0;
+    }
+
+g117_1:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_1;
+    default:
+        stack.push(9);
+        goto e9_1;
+    }
+
+g117_2:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_2;
+    default:
+        stack.push(9);
+        goto e9_2;
+    }
+
+g117_3:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_3;
+    default:
+        stack.push(9);
+        goto e9_3;
+    }
+
+g117_9:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_9;
+    default:
+        stack.push(9);
+        goto e9_9;
+    }
+
+g117_10:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_10;
+    default:
+        stack.push(9);
+        goto e9_10;
+    }
+
+g117_11:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_11;
+    default:
+        stack.push(9);
+        goto e9_11;
+    }
+
+g117_12:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_12;
+    default:
+        stack.push(9);
+        goto e9_12;
+    }
+
+g117_13:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_13;
+    default:
+        stack.push(9);
+        goto e9_13;
+    }
+
+g117_14:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_14;
+    default:
+        stack.push(9);
+        goto e9_14;
+    }
+
+g117_15:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_15;
+    default:
+        stack.push(9);
+        goto e9_15;
+    }
+
+g117_16:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_16;
+    default:
+        stack.push(9);
+        goto e9_16;
+    }
+
+g117_17:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_17;
+    default:
+        stack.push(9);
+        goto e9_17;
+    }
+
+g117_18:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_18;
+    default:
+        stack.push(9);
+        goto e9_18;
+    }
+
+g117_21:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_21;
+    default:
+        stack.push(9);
+        goto e9_21;
+    }
+
+g117_29:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        errorState = 131;
+        goto error;
+    default:
+        stack.push(9);
+        goto e9_29;
+    }
+
+g117_51:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_51;
+    default:
+        stack.push(9);
+        goto e9_51;
+    }
+
+g117_52:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_52;
+    default:
+        stack.push(9);
+        goto e9_52;
+    }
+
+g117_60:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_60;
+    default:
+        stack.push(9);
+        goto e9_60;
+    }
+
+g117_61:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_61;
+    default:
+        stack.push(9);
+        goto e9_61;
+    }
+
+g117_62:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_62;
+    default:
+        stack.push(9);
+        errorState = 9;
+        goto error;
+    }
+
+g117_63:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_63;
+    default:
+        stack.push(9);
+        goto e9_63;
+    }
+
+g117_64:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_64;
+    default:
+        stack.push(9);
+        goto e9_64;
+    }
+
+g117_65:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_65;
+    default:
+        stack.push(9);
+        goto e9_65;
+    }
+
+g117_66:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_66;
+    default:
+        stack.push(9);
+        goto e9_66;
+    }
+
+g117_79:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_79;
+    default:
+        stack.push(9);
+        goto e9_79;
+    }
+
+g117_86:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_86;
+    default:
+        stack.push(9);
+        goto e9_86;
+    }
+
+g117_87:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_87;
+    default:
+        stack.push(9);
+        goto e9_87;
+    }
+
+g117_88:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_88;
+    default:
+        stack.push(9);
+        goto e9_88;
+    }
+
+g117_89:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_89;
+    default:
+        stack.push(9);
+        goto e9_89;
+    }
+
+g117_90:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_90;
+    default:
+        stack.push(9);
+        goto e9_90;
+    }
+
+g117_91:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_91;
+    default:
+        stack.push(9);
+        goto e9_91;
+    }
+
+g117_92:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(131);
+        goto e131_92;
+    default:
+        stack.push(9);
+        goto e9_92;
+    }
+
+g118_54:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(265);
+        errorState = 265;
+        goto error;
+    default:
+        stack.push(115);
+        goto e115_54;
+    }
+
+g118_59:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(265);
+        goto e265_59;
+    default:
+        stack.push(115);
+        errorState = 115;
+        goto error;
+    }
+
+g119_54:
+    switch (stack.top())
+    {
+    default:
+        stack.push(113);
+        goto e113_54;
+    }
+
+g120_59:
+    switch (stack.top())
+    {
+    default:
+        stack.push(263);
+        goto e263_59;
+    }
+
+g121_54:
+    switch (stack.top())
+    {
+    default:
+        stack.push(114);
+        goto e114_54;
+    }
+
+g122_54:
+    switch (stack.top())
+    {
+    default:
+        stack.push(214);
+        goto e214_54;
+    }
+
+g122_55:
+    switch (stack.top())
+    {
+    default:
+        stack.push(214);
+        goto e214_55;
+    }
+
+g123_54:
+    switch (stack.top())
+    {
+    case 241:
+        stack.push(268);
+        goto e268_54;
+    default:
+        stack.push(215);
+        goto e215_54;
+    }
+
+g123_55:
+    switch (stack.top())
+    {
+    case 241:
+        stack.push(268);
+        goto e268_55;
+    default:
+        stack.push(215);
+        goto e215_55;
+    }
+
+g124_0:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        errorState = 132;
+        goto error;
+    default:
+        stack.push(10);
+        goto e10_0;
+    }
+
+g124_1:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_1;
+    default:
+        stack.push(10);
+        goto e10_1;
+    }
+
+g124_2:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_2;
+    default:
+        stack.push(10);
+        goto e10_2;
+    }
+
+g124_3:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_3;
+    default:
+        stack.push(10);
+        goto e10_3;
+    }
+
+g124_9:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_9;
+    default:
+        stack.push(10);
+        goto e10_9;
+    }
+
+g124_10:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_10;
+    default:
+        stack.push(10);
+        goto e10_10;
+    }
+
+g124_11:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_11;
+    default:
+        stack.push(10);
+        goto e10_11;
+    }
+
+g124_12:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_12;
+    default:
+        stack.push(10);
+        goto e10_12;
+    }
+
+g124_13:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_13;
+    default:
+        stack.push(10);
+        goto e10_13;
+    }
+
+g124_14:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_14;
+    default:
+        stack.push(10);
+        goto e10_14;
+    }
+
+g124_15:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_15;
+    default:
+        stack.push(10);
+        goto e10_15;
+    }
+
+g124_16:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_16;
+    default:
+        stack.push(10);
+        goto e10_16;
+    }
+
+g124_17:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_17;
+    default:
+        stack.push(10);
+        goto e10_17;
+    }
+
+g124_18:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_18;
+    default:
+        stack.push(10);
+        goto e10_18;
+    }
+
+g124_21:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_21;
+    default:
+        stack.push(10);
+        goto e10_21;
+    }
+
+g124_29:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        errorState = 132;
+        goto error;
+    default:
+        stack.push(10);
+        goto e10_29;
+    }
+
+g124_51:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_51;
+    default:
+        stack.push(10);
+        goto e10_51;
+    }
+
+g124_52:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_52;
+    default:
+        stack.push(10);
+        goto e10_52;
+    }
+
+g124_60:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_60;
+    default:
+        stack.push(10);
+        goto e10_60;
+    }
+
+g124_61:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_61;
+    default:
+        stack.push(10);
+        goto e10_61;
+    }
+
+g124_62:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_62;
+    default:
+        stack.push(10);
+        errorState = 10;
+        goto error;
+    }
+
+g124_63:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_63;
+    default:
+        stack.push(10);
+        goto e10_63;
+    }
+
+g124_64:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_64;
+    default:
+        stack.push(10);
+        goto e10_64;
+    }
+
+g124_65:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_65;
+    default:
+        stack.push(10);
+        goto e10_65;
+    }
+
+g124_66:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_66;
+    default:
+        stack.push(10);
+        goto e10_66;
+    }
+
+g124_79:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_79;
+    default:
+        stack.push(10);
+        goto e10_79;
+    }
+
+g124_86:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_86;
+    default:
+        stack.push(10);
+        goto e10_86;
+    }
+
+g124_87:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_87;
+    default:
+        stack.push(10);
+        goto e10_87;
+    }
+
+g124_88:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_88;
+    default:
+        stack.push(10);
+        goto e10_88;
+    }
+
+g124_89:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_89;
+    default:
+        stack.push(10);
+        goto e10_89;
+    }
+
+g124_90:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_90;
+    default:
+        stack.push(10);
+        goto e10_90;
+    }
+
+g124_91:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_91;
+    default:
+        stack.push(10);
+        goto e10_91;
+    }
+
+g124_92:
+    switch (stack.top())
+    {
+    case 77: case 127:
+        stack.push(132);
+        goto e132_92;
+    default:
+        stack.push(10);
+        goto e10_92;
+    }
+
+g125_54:
+    switch (stack.top())
+    {
+    default:
+        stack.push(73);
+        goto e73_54;
+    }
+
+g126_54:
+    switch (stack.top())
+    {
+    case 220:
+        stack.push(246);
+        goto e246_54;
+    default:
+        stack.push(178);
+        goto e178_54;
+    }
+
+g127_54:
+    switch (stack.top())
+    {
+    case 25:
+        stack.push(70);
+        goto e70_54;
+    case 49:
+        stack.push(104);
+        errorState = 104;
+        goto error;
+    case 67:
+        stack.push(116);
+        goto e116_54;
+    case 76:
+        stack.push(126);
+        goto e126_54;
+    case 77: case 127:
+        stack.push(136);
+        goto e136_54;
+    case 78: case 189:
+        stack.push(143);
+        errorState = 143;
+        goto error;
+    case 174:
+        stack.push(217);
+        goto e217_54;
+    case 187:
+        stack.push(223);
+        goto e223_54;
+    case 190:
+        stack.push(225);
+        errorState = 225;
+        goto error;
+    case 256:
+        stack.push(277);
+        goto e277_54;
+    case 269:
+        stack.push(286);
+        goto e286_54;
+    default:
+        stack.push(12);
+        goto e12_54;
+    }
+
+g127_55:
+    switch (stack.top())
+    {
+    case 25:
+        stack.push(70);
+        errorState = 70;
+        goto error;
+    case 49:
+        stack.push(104);
+        errorState = 104;
+        goto error;
+    case 67:
+        stack.push(116);
+        errorState = 116;
+        goto error;
+    case 76:
+        stack.push(126);
+        errorState = 126;
+        goto error;
+    case 77: case 127:
+        stack.push(136);
+        errorState = 136;
+        goto error;
+    case 78: case 189:
+        stack.push(143);
+        goto e143_55;
+    case 174:
+        stack.push(217);
+        errorState = 217;
+        goto error;
+    case 187:
+        stack.push(223);
+        errorState = 223;
+        goto error;
+    case 190:
+        stack.push(225);
+        errorState = 225;
+        goto error;
+    case 256:
+        stack.push(277);
+        goto e277_55;
+    case 269:
+        stack.push(286);
+        goto e286_55;
+    default:
+        stack.push(12);
+        errorState = 12;
+        goto error;
+    }
+
+g127_58:
+    switch (stack.top())
+    {
+    case 25:
+        stack.push(70);
+        errorState = 70;
+        goto error;
+    case 49:
+        stack.push(104);
+        errorState = 104;
+        goto error;
+    case 67:
+        stack.push(116);
+        errorState = 116;
+        goto error;
+    case 76:
+        stack.push(126);
+        errorState = 126;
+        goto error;
+    case 77: case 127:
+        stack.push(136);
+        errorState = 136;
+        goto error;
+    case 78: case 189:
+        stack.push(143);
+        errorState = 143;
+        goto error;
+    case 174:
+        stack.push(217);
+        errorState = 217;
+        goto error;
+    case 187:
+        stack.push(223);
+        errorState = 223;
+        goto error;
+    case 190:
+        stack.push(225);
+        goto e225_58;
+    case 256:
+        stack.push(277);
+        errorState = 277;
+        goto error;
+    case 269:
+        stack.push(286);
+        errorState = 286;
+        goto error;
+    default:
+        stack.push(12);
+        errorState = 12;
+        goto error;
+    }
+
+g127_59:
+    switch (stack.top())
+    {
+    case 25:
+        stack.push(70);
+        errorState = 70;
+        goto error;
+    case 49:
+        stack.push(104);
+        goto e104_59;
+    case 67:
+        stack.push(116);
+        errorState = 116;
+        goto error;
+    case 76:
+        stack.push(126);
+        errorState = 126;
+        goto error;
+    case 77: case 127:
+        stack.push(136);
+        errorState = 136;
+        goto error;
+    case 78: case 189:
+        stack.push(143);
+        goto e143_59;
+    case 174:
+        stack.push(217);
+        goto e217_59;
+    case 187:
+        stack.push(223);
+        errorState = 223;
+        goto error;
+    case 190:
+        stack.push(225);
+        errorState = 225;
+        goto error;
+    case 256:
+        stack.push(277);
+        errorState = 277;
+        goto error;
+    case 269:
+        stack.push(286);
+        errorState = 286;
+        goto error;
+    default:
+        stack.push(12);
+        errorState = 12;
+        goto error;
+    }
+
+g127_80:
+    switch (stack.top())
+    {
+    case 25:
+        stack.push(70);
+        errorState = 70;
+        goto error;
+    case 49:
+        stack.push(104);
+        errorState = 104;
+        goto error;
+    case 67:
+        stack.push(116);
+        errorState = 116;
+        goto error;
+    case 76:
+        stack.push(126);
+        goto e126_80;
+    case 77: case 127:
+        stack.push(136);
+        errorState = 136;
+        goto error;
+    case 78: case 189:
+        stack.push(143);
+        errorState = 143;
+        goto error;
+    case 174:
+        stack.push(217);
+        errorState = 217;
+        goto error;
+    case 187:
+        stack.push(223);
+        errorState = 223;
+        goto error;
+    case 190:
+        stack.push(225);
+        errorState = 225;
+        goto error;
+    case 256:
+        stack.push(277);
+        errorState = 277;
+        goto error;
+    case 269:
+        stack.push(286);
+        errorState = 286;
+        goto error;
+    default:
+        stack.push(12);
+        errorState = 12;
+        goto error;
+    }
+
+g128_54:
+    switch (stack.top())
+    {
+    case 65:
+        stack.push(111);
+        errorState = 111;
+        goto error;
+    case 66:
+        stack.push(112);
+        errorState = 112;
+        goto error;
+    case 172:
+        stack.push(213);
+        goto e213_54;
+    case 177:
+        stack.push(219);
+        errorState = 219;
+        goto error;
+    default:
+        stack.push(29);
+        goto e29_54;
+    }
+
+g128_55:
+    switch (stack.top())
+    {
+    case 65:
+        stack.push(111);
+        errorState = 111;
+        goto error;
+    case 66:
+        stack.push(112);
+        errorState = 112;
+        goto error;
+    case 172:
+        stack.push(213);
+        errorState = 213;
+        goto error;
+    case 177:
+        stack.push(219);
+        errorState = 219;
+        goto error;
+    default:
+        stack.push(29);
+        goto e29_55;
+    }
+
+g128_58:
+    switch (stack.top())
+    {
+    case 65:
+        stack.push(111);
+        errorState = 111;
+        goto error;
+    case 66:
+        stack.push(112);
+        errorState = 112;
+        goto error;
+    case 172:
+        stack.push(213);
+        errorState = 213;
+        goto error;
+    case 177:
+        stack.push(219);
+        errorState = 219;
+        goto error;
+    default:
+        stack.push(29);
+        goto e29_58;
+    }
+
+g128_59:
+    switch (stack.top())
+    {
+    case 65:
+        stack.push(111);
+        goto e111_59;
+    case 66:
+        stack.push(112);
+        goto e112_59;
+    case 172:
+        stack.push(213);
+        errorState = 213;
+        goto error;
+    case 177:
+        stack.push(219);
+        goto e219_59;
+    default:
+        stack.push(29);
+        goto e29_59;
+    }
+
+g128_80:
+    switch (stack.top())
+    {
+    case 65:
+        stack.push(111);
+        errorState = 111;
+        goto error;
+    case 66:
+        stack.push(112);
+        errorState = 112;
+        goto error;
+    case 172:
+        stack.push(213);
+        errorState = 213;
+        goto error;
+    case 177:
+        stack.push(219);
+        errorState = 219;
+        goto error;
+    default:
+        stack.push(29);
+        goto e29_80;
+    }
+
+g129_54:
+    switch (stack.top())
+    {
+    case 148:
+        stack.push(193);
+        goto e193_54;
+    case 149:
+        stack.push(194);
+        goto e194_54;
+    default:
+        stack.push(82);
+        goto e82_54;
+    }
+
+g129_55:
+    switch (stack.top())
+    {
+    case 148:
+        stack.push(193);
+        goto e193_55;
+    case 149:
+        stack.push(194);
+        goto e194_55;
+    default:
+        stack.push(82);
+        goto e82_55;
+    }
+
+g129_58:
+    switch (stack.top())
+    {
+    case 148:
+        stack.push(193);
+        goto e193_58;
+    case 149:
+        stack.push(194);
+        goto e194_58;
+    default:
+        stack.push(82);
+        goto e82_58;
+    }
+
+g129_59:
+    switch (stack.top())
+    {
+    case 148:
+        stack.push(193);
+        goto e193_59;
+    case 149:
+        stack.push(194);
+        goto e194_59;
+    default:
+        stack.push(82);
+        goto e82_59;
+    }
+
+g129_80:
+    switch (stack.top())
+    {
+    case 148:
+        stack.push(193);
+        goto e193_80;
+    case 149:
+        stack.push(194);
+        goto e194_80;
+    default:
+        stack.push(82);
+        goto e82_80;
+    }
+
+g130_54:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_54;
+    default:
+        stack.push(40);
+        goto e40_54;
+    }
+
+g130_55:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_55;
+    default:
+        stack.push(40);
+        goto e40_55;
+    }
+
+g130_58:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_58;
+    default:
+        stack.push(40);
+        goto e40_58;
+    }
+
+g130_59:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_59;
+    default:
+        stack.push(40);
+        goto e40_59;
+    }
+
+g130_63:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_63;
+    default:
+        stack.push(40);
+        goto e40_63;
+    }
+
+g130_65:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_65;
+    default:
+        stack.push(40);
+        goto e40_65;
+    }
+
+g130_67:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_67;
+    default:
+        stack.push(40);
+        goto e40_67;
+    }
+
+g130_68:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_68;
+    default:
+        stack.push(40);
+        goto e40_68;
+    }
+
+g130_69:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_69;
+    default:
+        stack.push(40);
+        goto e40_69;
+    }
+
+g130_70:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_70;
+    default:
+        stack.push(40);
+        goto e40_70;
+    }
+
+g130_71:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_71;
+    default:
+        stack.push(40);
+        goto e40_71;
+    }
+
+g130_72:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_72;
+    default:
+        stack.push(40);
+        goto e40_72;
+    }
+
+g130_73:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_73;
+    default:
+        stack.push(40);
+        goto e40_73;
+    }
+
+g130_74:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_74;
+    default:
+        stack.push(40);
+        goto e40_74;
+    }
+
+g130_75:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_75;
+    default:
+        stack.push(40);
+        goto e40_75;
+    }
+
+g130_77:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_77;
+    default:
+        stack.push(40);
+        goto e40_77;
+    }
+
+g130_78:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_78;
+    default:
+        stack.push(40);
+        goto e40_78;
+    }
+
+g130_80:
+    switch (stack.top())
+    {
+    case 239:
+        stack.push(264);
+        goto e264_80;
+    default:
+        stack.push(40);
+        goto e40_80;
+    }
+
+g131_54:
+    switch (stack.top())
+    {
+    case 83:
+        stack.push(148);
+        goto e148_54;
+    case 84:
+        stack.push(149);
+        goto e149_54;
+    default:
+        stack.push(31);
+        goto e31_54;
+    }
+
+g131_55:
+    switch (stack.top())
+    {
+    case 83:
+        stack.push(148);
+        goto e148_55;
+    case 84:
+        stack.push(149);
+        goto e149_55;
+    default:
+        stack.push(31);
+        goto e31_55;
+    }
+
+g131_58:
+    switch (stack.top())
+    {
+    case 83:
+        stack.push(148);
+        goto e148_58;
+    case 84:
+        stack.push(149);
+        goto e149_58;
+    default:
+        stack.push(31);
+        goto e31_58;
+    }
+
+g131_59:
+    switch (stack.top())
+    {
+    case 83:
+        stack.push(148);
+        goto e148_59;
+    case 84:
+        stack.push(149);
+        goto e149_59;
+    default:
+        stack.push(31);
+        goto e31_59;
+    }
+
+g131_77:
+    switch (stack.top())
+    {
+    case 83:
+        stack.push(148);
+        goto e148_77;
+    case 84:
+        stack.push(149);
+        goto e149_77;
+    default:
+        stack.push(31);
+        goto e31_77;
+    }
+
+g131_78:
+    switch (stack.top())
+    {
+    case 83:
+        stack.push(148);
+        goto e148_78;
+    case 84:
+        stack.push(149);
+        goto e149_78;
+    default:
+        stack.push(31);
+        goto e31_78;
+    }
+
+g131_80:
+    switch (stack.top())
+    {
+    case 83:
+        stack.push(148);
+        goto e148_80;
+    case 84:
+        stack.push(149);
+        goto e149_80;
+    default:
+        stack.push(31);
+        goto e31_80;
+    }
+
+g132_54:
+    switch (stack.top())
+    {
+    default:
+        stack.push(85);
+        goto e85_54;
+    }
+
+g132_55:
+    switch (stack.top())
+    {
+    default:
+        stack.push(85);
+        goto e85_55;
+    }
+
+g132_58:
+    switch (stack.top())
+    {
+    default:
+        stack.push(85);
+        goto e85_58;
+    }
+
+g132_59:
+    switch (stack.top())
+    {
+    default:
+        stack.push(85);
+        goto e85_59;
+    }
+
+g132_77:
+    switch (stack.top())
+    {
+    default:
+        stack.push(85);
+        goto e85_77;
+    }
+
+g132_78:
+    switch (stack.top())
+    {
+    default:
+        stack.push(85);
+        goto e85_78;
+    }
+
+g132_80:
+    switch (stack.top())
+    {
+    default:
+        stack.push(85);
+        goto e85_80;
+    }
+
+g133_54:
+    switch (stack.top())
+    {
+    case 86:
+        stack.push(150);
+        goto e150_54;
+    case 87:
+        stack.push(151);
+        goto e151_54;
+    case 88:
+        stack.push(152);
+        goto e152_54;
+    case 89:
+        stack.push(153);
+        goto e153_54;
+    case 90:
+        stack.push(154);
+        goto e154_54;
+    case 91:
+        stack.push(155);
+        goto e155_54;
+    case 145: case 168: case 176: case 257: case 270:
+        stack.push(192);
+        errorState = 192;
+        goto error;
+    default:
+        stack.push(32);
+        goto e32_54;
+    }
+
+g133_55:
+    switch (stack.top())
+    {
+    case 86:
+        stack.push(150);
+        goto e150_55;
+    case 87:
+        stack.push(151);
+        goto e151_55;
+    case 88:
+        stack.push(152);
+        goto e152_55;
+    case 89:
+        stack.push(153);
+        goto e153_55;
+    case 90:
+        stack.push(154);
+        goto e154_55;
+    case 91:
+        stack.push(155);
+        goto e155_55;
+    case 145: case 168: case 176: case 257: case 270:
+        stack.push(192);
+        errorState = 192;
+        goto error;
+    default:
+        stack.push(32);
+        goto e32_55;
+    }
+
+g133_58:
+    switch (stack.top())
+    {
+    case 86:
+        stack.push(150);
+        goto e150_58;
+    case 87:
+        stack.push(151);
+        goto e151_58;
+    case 88:
+        stack.push(152);
+        goto e152_58;
+    case 89:
+        stack.push(153);
+        goto e153_58;
+    case 90:
+        stack.push(154);
+        goto e154_58;
+    case 91:
+        stack.push(155);
+        goto e155_58;
+    case 145: case 168: case 176: case 257: case 270:
+        stack.push(192);
+        goto e192_58;
+    default:
+        stack.push(32);
+        goto e32_58;
+    }
+
+g133_59:
+    switch (stack.top())
+    {
+    case 86:
+        stack.push(150);
+        goto e150_59;
+    case 87:
+        stack.push(151);
+        goto e151_59;
+    case 88:
+        stack.push(152);
+        goto e152_59;
+    case 89:
+        stack.push(153);
+        goto e153_59;
+    case 90:
+        stack.push(154);
+        goto e154_59;
+    case 91:
+        stack.push(155);
+        goto e155_59;
+    case 145: case 168: case 176: case 257: case 270:
+        stack.push(192);
+        errorState = 192;
+        goto error;
+    default:
+        stack.push(32);
+        goto e32_59;
+    }
+
+g133_70:
+    switch (stack.top())
+    {
+    case 86:
+        stack.push(150);
+        errorState = 150;
+        goto error;
+    case 87:
+        stack.push(151);
+        errorState = 151;
+        goto error;
+    case 88:
+        stack.push(152);
+        errorState = 152;
+        goto error;
+    case 89:
+        stack.push(153);
+        errorState = 153;
+        goto error;
+    case 90:
+        stack.push(154);
+        errorState = 154;
+        goto error;
+    case 91:
+        stack.push(155);
+        errorState = 155;
+        goto error;
+    case 145: case 168: case 176: case 257: case 270:
+        stack.push(192);
+        errorState = 192;
+        goto error;
+    default:
+        stack.push(32);
+        goto e32_70;
+    }
+
+g133_71:
+    switch (stack.top())
+    {
+    case 86:
+        stack.push(150);
+        errorState = 150;
+        goto error;
+    case 87:
+        stack.push(151);
+        errorState = 151;
+        goto error;
+    case 88:
+        stack.push(152);
+        errorState = 152;
+        goto error;
+    case 89:
+        stack.push(153);
+        errorState = 153;
+        goto error;
+    case 90:
+        stack.push(154);
+        errorState = 154;
+        goto error;
+    case 91:
+        stack.push(155);
+        errorState = 155;
+        goto error;
+    case 145: case 168: case 176: case 257: case 270:
+        stack.push(192);
+        errorState = 192;
+        goto error;
+    default:
+        stack.push(32);
+        goto e32_71;
+    }
+
+g133_72:
+    switch (stack.top())
+    {
+    case 86:
+        stack.push(150);
+        errorState = 150;
+        goto error;
+    case 87:
+        stack.push(151);
+        errorState = 151;
+        goto error;
+    case 88:
+        stack.push(152);
+        errorState = 152;
+        goto error;
+    case 89:
+        stack.push(153);
+        errorState = 153;
+        goto error;
+    case 90:
+        stack.push(154);
+        errorState = 154;
+        goto error;
+    case 91:
+        stack.push(155);
+        errorState = 155;
+        goto error;
+    case 145: case 168: case 176: case 257: case 270:
+        stack.push(192);
+        errorState = 192;
+        goto error;
+    default:
+        stack.push(32);
+        goto e32_72;
+    }
+
+g133_73:
+    switch (stack.top())
+    {
+    case 86:
+        stack.push(150);
+        errorState = 150;
+        goto error;
+    case 87:
+        stack.push(151);
+        errorState = 151;
+        goto error;
+    case 88:
+        stack.push(152);
+        errorState = 152;
+        goto error;
+    case 89:
+        stack.push(153);
+        errorState = 153;
+        goto error;
+    case 90:
+        stack.push(154);
+        errorState = 154;
+        goto error;
+    case 91:
+        stack.push(155);
+        errorState = 155;
+        goto error;
+    case 145: case 168: case 176: case 257: case 270:
+        stack.push(192);
+        errorState = 192;
+        goto error;
+    default:
+        stack.push(32);
+        goto e32_73;
+    }
+
+g133_74:
+    switch (stack.top())
+    {
+    case 86:
+        stack.push(150);
+        errorState = 150;
+        goto error;
+    case 87:
+        stack.push(151);
+        errorState = 151;
+        goto error;
+    case 88:
+        stack.push(152);
+        errorState = 152;
+        goto error;
+    case 89:
+        stack.push(153);
+        errorState = 153;
+        goto error;
+    case 90:
+        stack.push(154);
+        errorState = 154;
+        goto error;
+    case 91:
+        stack.push(155);
+        errorState = 155;
+        goto error;
+    case 145: case 168: case 176: case 257: case 270:
+        stack.push(192);
+        errorState = 192;
+        goto error;
+    default:
+        stack.push(32);
+        goto e32_74;
+    }
+
+g133_75:
+    switch (stack.top())
+    {
+    case 86:
+        stack.push(150);
+        errorState = 150;
+        goto error;
+    case 87:
+        stack.push(151);
+        errorState = 151;
+        goto error;
+    case 88:
+        stack.push(152);
+        errorState = 152;
+        goto error;
+    case 89:
+        stack.push(153);
+        errorState = 153;
+        goto error;
+    case 90:
+        stack.push(154);
+        errorState = 154;
+        goto error;
+    case 91:
+        stack.push(155);
+        errorState = 155;
+        goto error;
+    case 145: case 168: case 176: case 257: case 270:
+        stack.push(192);
+        errorState = 192;
+        goto error;
+    default:
+        stack.push(32);
+        goto e32_75;
+    }
+
+g133_77:
+    switch (stack.top())
+    {
+    case 86:
+        stack.push(150);
+        goto e150_77;
+    case 87:
+        stack.push(151);
+        goto e151_77;
+    case 88:
+        stack.push(152);
+        goto e152_77;
+    case 89:
+        stack.push(153);
+        goto e153_77;
+    case 90:
+        stack.push(154);
+        goto e154_77;
+    case 91:
+        stack.push(155);
+        goto e155_77;
+    case 145: case 168: case 176: case 257: case 270:
+        stack.push(192);
+        errorState = 192;
+        goto error;
+    default:
+        stack.push(32);
+        goto e32_77;
+    }
+
+g133_78:
+    switch (stack.top())
+    {
+    case 86:
+        stack.push(150);
+        goto e150_78;
+    case 87:
+        stack.push(151);
+        goto e151_78;
+    case 88:
+        stack.push(152);
+        goto e152_78;
+    case 89:
+        stack.push(153);
+        goto e153_78;
+    case 90:
+        stack.push(154);
+        goto e154_78;
+    case 91:
+        stack.push(155);
+        goto e155_78;
+    case 145: case 168: case 176: case 257: case 270:
+        stack.push(192);
+        errorState = 192;
+        goto error;
+    default:
+        stack.push(32);
+        goto e32_78;
+    }
+
+g133_80:
+    switch (stack.top())
+    {
+    case 86:
+        stack.push(150);
+        goto e150_80;
+    case 87:
+        stack.push(151);
+        goto e151_80;
+    case 88:
+        stack.push(152);
+        goto e152_80;
+    case 89:
+        stack.push(153);
+        goto e153_80;
+    case 90:
+        stack.push(154);
+        goto e154_80;
+    case 91:
+        stack.push(155);
+        goto e155_80;
+    case 145: case 168: case 176: case 257: case 270:
+        stack.push(192);
+        errorState = 192;
+        goto error;
+    default:
+        stack.push(32);
+        goto e32_80;
+    }
+
+g134_54:
+    switch (stack.top())
+    {
+    case 156:
+        stack.push(195);
+        goto e195_54;
+    case 157:
+        stack.push(196);
+        goto e196_54;
+    default:
+        stack.push(92);
+        goto e92_54;
+    }
+
+g134_55:
+    switch (stack.top())
+    {
+    case 156:
+        stack.push(195);
+        goto e195_55;
+    case 157:
+        stack.push(196);
+        goto e196_55;
+    default:
+        stack.push(92);
+        goto e92_55;
+    }
+
+g134_58:
+    switch (stack.top())
+    {
+    case 156:
+        stack.push(195);
+        goto e195_58;
+    case 157:
+        stack.push(196);
+        goto e196_58;
+    default:
+        stack.push(92);
+        goto e92_58;
+    }
+
+g134_59:
+    switch (stack.top())
+    {
+    case 156:
+        stack.push(195);
+        goto e195_59;
+    case 157:
+        stack.push(196);
+        goto e196_59;
+    default:
+        stack.push(92);
+        goto e92_59;
+    }
+
+g134_70:
+    switch (stack.top())
+    {
+    case 156:
+        stack.push(195);
+        goto e195_70;
+    case 157:
+        stack.push(196);
+        goto e196_70;
+    default:
+        stack.push(92);
+        goto e92_70;
+    }
+
+g134_71:
+    switch (stack.top())
+    {
+    case 156:
+        stack.push(195);
+        goto e195_71;
+    case 157:
+        stack.push(196);
+        goto e196_71;
+    default:
+        stack.push(92);
+        goto e92_71;
+    }
+
+g134_72:
+    switch (stack.top())
+    {
+    case 156:
+        stack.push(195);
+        goto e195_72;
+    case 157:
+        stack.push(196);
+        goto e196_72;
+    default:
+        stack.push(92);
+        goto e92_72;
+    }
+
+g134_73:
+    switch (stack.top())
+    {
+    case 156:
+        stack.push(195);
+        goto e195_73;
+    case 157:
+        stack.push(196);
+        goto e196_73;
+    default:
+        stack.push(92);
+        goto e92_73;
+    }
+
+g134_74:
+    switch (stack.top())
+    {
+    case 156:
+        stack.push(195);
+        goto e195_74;
+    case 157:
+        stack.push(196);
+        goto e196_74;
+    default:
+        stack.push(92);
+        goto e92_74;
+    }
+
+g134_75:
+    switch (stack.top())
+    {
+    case 156:
+        stack.push(195);
+        goto e195_75;
+    case 157:
+        stack.push(196);
+        goto e196_75;
+    default:
+        stack.push(92);
+        goto e92_75;
+    }
+
+g134_77:
+    switch (stack.top())
+    {
+    case 156:
+        stack.push(195);
+        goto e195_77;
+    case 157:
+        stack.push(196);
+        goto e196_77;
+    default:
+        stack.push(92);
+        goto e92_77;
+    }
+
+g134_78:
+    switch (stack.top())
+    {
+    case 156:
+        stack.push(195);
+        goto e195_78;
+    case 157:
+        stack.push(196);
+        goto e196_78;
+    default:
+        stack.push(92);
+        goto e92_78;
+    }
+
+g134_80:
+    switch (stack.top())
+    {
+    case 156:
+        stack.push(195);
+        goto e195_80;
+    case 157:
+        stack.push(196);
+        goto e196_80;
+    default:
+        stack.push(92);
+        goto e92_80;
+    }
+
+g135_54:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_54;
+    case 94:
+        stack.push(157);
+        goto e157_54;
+    default:
+        stack.push(33);
+        goto e33_54;
+    }
+
+g135_55:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_55;
+    case 94:
+        stack.push(157);
+        goto e157_55;
+    default:
+        stack.push(33);
+        goto e33_55;
+    }
+
+g135_58:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_58;
+    case 94:
+        stack.push(157);
+        goto e157_58;
+    default:
+        stack.push(33);
+        goto e33_58;
+    }
+
+g135_59:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_59;
+    case 94:
+        stack.push(157);
+        goto e157_59;
+    default:
+        stack.push(33);
+        goto e33_59;
+    }
+
+g135_63:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_63;
+    case 94:
+        stack.push(157);
+        goto e157_63;
+    default:
+        stack.push(33);
+        goto e33_63;
+    }
+
+g135_65:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_65;
+    case 94:
+        stack.push(157);
+        goto e157_65;
+    default:
+        stack.push(33);
+        goto e33_65;
+    }
+
+g135_70:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_70;
+    case 94:
+        stack.push(157);
+        goto e157_70;
+    default:
+        stack.push(33);
+        goto e33_70;
+    }
+
+g135_71:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_71;
+    case 94:
+        stack.push(157);
+        goto e157_71;
+    default:
+        stack.push(33);
+        goto e33_71;
+    }
+
+g135_72:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_72;
+    case 94:
+        stack.push(157);
+        goto e157_72;
+    default:
+        stack.push(33);
+        goto e33_72;
+    }
+
+g135_73:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_73;
+    case 94:
+        stack.push(157);
+        goto e157_73;
+    default:
+        stack.push(33);
+        goto e33_73;
+    }
+
+g135_74:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_74;
+    case 94:
+        stack.push(157);
+        goto e157_74;
+    default:
+        stack.push(33);
+        goto e33_74;
+    }
+
+g135_75:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_75;
+    case 94:
+        stack.push(157);
+        goto e157_75;
+    default:
+        stack.push(33);
+        goto e33_75;
+    }
+
+g135_77:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_77;
+    case 94:
+        stack.push(157);
+        goto e157_77;
+    default:
+        stack.push(33);
+        goto e33_77;
+    }
+
+g135_78:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_78;
+    case 94:
+        stack.push(157);
+        goto e157_78;
+    default:
+        stack.push(33);
+        goto e33_78;
+    }
+
+g135_80:
+    switch (stack.top())
+    {
+    case 93:
+        stack.push(156);
+        goto e156_80;
+    case 94:
+        stack.push(157);
+        goto e157_80;
+    default:
+        stack.push(33);
+        goto e33_80;
+    }
+
+g136_54:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_54;
+    case 159:
+        stack.push(198);
+        goto e198_54;
+    case 160:
+        stack.push(199);
+        goto e199_54;
+    default:
+        stack.push(95);
+        goto e95_54;
+    }
+
+g136_55:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_55;
+    case 159:
+        stack.push(198);
+        goto e198_55;
+    case 160:
+        stack.push(199);
+        goto e199_55;
+    default:
+        stack.push(95);
+        goto e95_55;
+    }
+
+g136_58:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_58;
+    case 159:
+        stack.push(198);
+        goto e198_58;
+    case 160:
+        stack.push(199);
+        goto e199_58;
+    default:
+        stack.push(95);
+        goto e95_58;
+    }
+
+g136_59:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_59;
+    case 159:
+        stack.push(198);
+        goto e198_59;
+    case 160:
+        stack.push(199);
+        goto e199_59;
+    default:
+        stack.push(95);
+        goto e95_59;
+    }
+
+g136_63:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_63;
+    case 159:
+        stack.push(198);
+        goto e198_63;
+    case 160:
+        stack.push(199);
+        goto e199_63;
+    default:
+        stack.push(95);
+        goto e95_63;
+    }
+
+g136_65:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_65;
+    case 159:
+        stack.push(198);
+        goto e198_65;
+    case 160:
+        stack.push(199);
+        goto e199_65;
+    default:
+        stack.push(95);
+        goto e95_65;
+    }
+
+g136_70:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_70;
+    case 159:
+        stack.push(198);
+        goto e198_70;
+    case 160:
+        stack.push(199);
+        goto e199_70;
+    default:
+        stack.push(95);
+        goto e95_70;
+    }
+
+g136_71:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_71;
+    case 159:
+        stack.push(198);
+        goto e198_71;
+    case 160:
+        stack.push(199);
+        goto e199_71;
+    default:
+        stack.push(95);
+        goto e95_71;
+    }
+
+g136_72:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_72;
+    case 159:
+        stack.push(198);
+        goto e198_72;
+    case 160:
+        stack.push(199);
+        goto e199_72;
+    default:
+        stack.push(95);
+        goto e95_72;
+    }
+
+g136_73:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_73;
+    case 159:
+        stack.push(198);
+        goto e198_73;
+    case 160:
+        stack.push(199);
+        goto e199_73;
+    default:
+        stack.push(95);
+        goto e95_73;
+    }
+
+g136_74:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_74;
+    case 159:
+        stack.push(198);
+        goto e198_74;
+    case 160:
+        stack.push(199);
+        goto e199_74;
+    default:
+        stack.push(95);
+        goto e95_74;
+    }
+
+g136_75:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_75;
+    case 159:
+        stack.push(198);
+        goto e198_75;
+    case 160:
+        stack.push(199);
+        goto e199_75;
+    default:
+        stack.push(95);
+        goto e95_75;
+    }
+
+g136_77:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_77;
+    case 159:
+        stack.push(198);
+        goto e198_77;
+    case 160:
+        stack.push(199);
+        goto e199_77;
+    default:
+        stack.push(95);
+        goto e95_77;
+    }
+
+g136_78:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_78;
+    case 159:
+        stack.push(198);
+        goto e198_78;
+    case 160:
+        stack.push(199);
+        goto e199_78;
+    default:
+        stack.push(95);
+        goto e95_78;
+    }
+
+g136_80:
+    switch (stack.top())
+    {
+    case 158:
+        stack.push(197);
+        goto e197_80;
+    case 159:
+        stack.push(198);
+        goto e198_80;
+    case 160:
+        stack.push(199);
+        goto e199_80;
+    default:
+        stack.push(95);
+        goto e95_80;
+    }
+
+g137_54:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_54;
+    case 37:
+        stack.push(100);
+        goto e100_54;
+    case 38:
+        stack.push(101);
+        goto e101_54;
+    case 96:
+        stack.push(158);
+        goto e158_54;
+    case 97:
+        stack.push(159);
+        goto e159_54;
+    case 98:
+        stack.push(160);
+        goto e160_54;
+    default:
+        stack.push(34);
+        goto e34_54;
+    }
+
+g137_55:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_55;
+    case 37:
+        stack.push(100);
+        goto e100_55;
+    case 38:
+        stack.push(101);
+        goto e101_55;
+    case 96:
+        stack.push(158);
+        goto e158_55;
+    case 97:
+        stack.push(159);
+        goto e159_55;
+    case 98:
+        stack.push(160);
+        goto e160_55;
+    default:
+        stack.push(34);
+        goto e34_55;
+    }
+
+g137_58:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_58;
+    case 37:
+        stack.push(100);
+        goto e100_58;
+    case 38:
+        stack.push(101);
+        goto e101_58;
+    case 96:
+        stack.push(158);
+        goto e158_58;
+    case 97:
+        stack.push(159);
+        goto e159_58;
+    case 98:
+        stack.push(160);
+        goto e160_58;
+    default:
+        stack.push(34);
+        goto e34_58;
+    }
+
+g137_59:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_59;
+    case 37:
+        stack.push(100);
+        goto e100_59;
+    case 38:
+        stack.push(101);
+        goto e101_59;
+    case 96:
+        stack.push(158);
+        goto e158_59;
+    case 97:
+        stack.push(159);
+        goto e159_59;
+    case 98:
+        stack.push(160);
+        goto e160_59;
+    default:
+        stack.push(34);
+        goto e34_59;
+    }
+
+g137_63:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_63;
+    case 37:
+        stack.push(100);
+        goto e100_63;
+    case 38:
+        stack.push(101);
+        goto e101_63;
+    case 96:
+        stack.push(158);
+        goto e158_63;
+    case 97:
+        stack.push(159);
+        goto e159_63;
+    case 98:
+        stack.push(160);
+        goto e160_63;
+    default:
+        stack.push(34);
+        goto e34_63;
+    }
+
+g137_65:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_65;
+    case 37:
+        stack.push(100);
+        goto e100_65;
+    case 38:
+        stack.push(101);
+        goto e101_65;
+    case 96:
+        stack.push(158);
+        goto e158_65;
+    case 97:
+        stack.push(159);
+        goto e159_65;
+    case 98:
+        stack.push(160);
+        goto e160_65;
+    default:
+        stack.push(34);
+        goto e34_65;
+    }
+
+g137_67:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_67;
+    case 37:
+        stack.push(100);
+        goto e100_67;
+    case 38:
+        stack.push(101);
+        goto e101_67;
+    case 96:
+        stack.push(158);
+        goto e158_67;
+    case 97:
+        stack.push(159);
+        goto e159_67;
+    case 98:
+        stack.push(160);
+        goto e160_67;
+    default:
+        stack.push(34);
+        goto e34_67;
+    }
+
+g137_68:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_68;
+    case 37:
+        stack.push(100);
+        goto e100_68;
+    case 38:
+        stack.push(101);
+        goto e101_68;
+    case 96:
+        stack.push(158);
+        goto e158_68;
+    case 97:
+        stack.push(159);
+        goto e159_68;
+    case 98:
+        stack.push(160);
+        goto e160_68;
+    default:
+        stack.push(34);
+        goto e34_68;
+    }
+
+g137_69:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_69;
+    case 37:
+        stack.push(100);
+        goto e100_69;
+    case 38:
+        stack.push(101);
+        goto e101_69;
+    case 96:
+        stack.push(158);
+        goto e158_69;
+    case 97:
+        stack.push(159);
+        goto e159_69;
+    case 98:
+        stack.push(160);
+        goto e160_69;
+    default:
+        stack.push(34);
+        goto e34_69;
+    }
+
+g137_70:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_70;
+    case 37:
+        stack.push(100);
+        goto e100_70;
+    case 38:
+        stack.push(101);
+        goto e101_70;
+    case 96:
+        stack.push(158);
+        goto e158_70;
+    case 97:
+        stack.push(159);
+        goto e159_70;
+    case 98:
+        stack.push(160);
+        goto e160_70;
+    default:
+        stack.push(34);
+        goto e34_70;
+    }
+
+g137_71:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_71;
+    case 37:
+        stack.push(100);
+        goto e100_71;
+    case 38:
+        stack.push(101);
+        goto e101_71;
+    case 96:
+        stack.push(158);
+        goto e158_71;
+    case 97:
+        stack.push(159);
+        goto e159_71;
+    case 98:
+        stack.push(160);
+        goto e160_71;
+    default:
+        stack.push(34);
+        goto e34_71;
+    }
+
+g137_72:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_72;
+    case 37:
+        stack.push(100);
+        goto e100_72;
+    case 38:
+        stack.push(101);
+        goto e101_72;
+    case 96:
+        stack.push(158);
+        goto e158_72;
+    case 97:
+        stack.push(159);
+        goto e159_72;
+    case 98:
+        stack.push(160);
+        goto e160_72;
+    default:
+        stack.push(34);
+        goto e34_72;
+    }
+
+g137_73:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_73;
+    case 37:
+        stack.push(100);
+        goto e100_73;
+    case 38:
+        stack.push(101);
+        goto e101_73;
+    case 96:
+        stack.push(158);
+        goto e158_73;
+    case 97:
+        stack.push(159);
+        goto e159_73;
+    case 98:
+        stack.push(160);
+        goto e160_73;
+    default:
+        stack.push(34);
+        goto e34_73;
+    }
+
+g137_74:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_74;
+    case 37:
+        stack.push(100);
+        goto e100_74;
+    case 38:
+        stack.push(101);
+        goto e101_74;
+    case 96:
+        stack.push(158);
+        goto e158_74;
+    case 97:
+        stack.push(159);
+        goto e159_74;
+    case 98:
+        stack.push(160);
+        goto e160_74;
+    default:
+        stack.push(34);
+        goto e34_74;
+    }
+
+g137_75:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_75;
+    case 37:
+        stack.push(100);
+        goto e100_75;
+    case 38:
+        stack.push(101);
+        goto e101_75;
+    case 96:
+        stack.push(158);
+        goto e158_75;
+    case 97:
+        stack.push(159);
+        goto e159_75;
+    case 98:
+        stack.push(160);
+        goto e160_75;
+    default:
+        stack.push(34);
+        goto e34_75;
+    }
+
+g137_77:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_77;
+    case 37:
+        stack.push(100);
+        goto e100_77;
+    case 38:
+        stack.push(101);
+        goto e101_77;
+    case 96:
+        stack.push(158);
+        goto e158_77;
+    case 97:
+        stack.push(159);
+        goto e159_77;
+    case 98:
+        stack.push(160);
+        goto e160_77;
+    default:
+        stack.push(34);
+        goto e34_77;
+    }
+
+g137_78:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_78;
+    case 37:
+        stack.push(100);
+        goto e100_78;
+    case 38:
+        stack.push(101);
+        goto e101_78;
+    case 96:
+        stack.push(158);
+        goto e158_78;
+    case 97:
+        stack.push(159);
+        goto e159_78;
+    case 98:
+        stack.push(160);
+        goto e160_78;
+    default:
+        stack.push(34);
+        goto e34_78;
+    }
+
+g137_80:
+    switch (stack.top())
+    {
+    case 36:
+        stack.push(99);
+        goto e99_80;
+    case 37:
+        stack.push(100);
+        goto e100_80;
+    case 38:
+        stack.push(101);
+        goto e101_80;
+    case 96:
+        stack.push(158);
+        goto e158_80;
+    case 97:
+        stack.push(159);
+        goto e159_80;
+    case 98:
+        stack.push(160);
+        goto e160_80;
+    default:
+        stack.push(34);
+        goto e34_80;
+    }
+
+g138_54:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_54;
+    }
+
+g138_55:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_55;
+    }
+
+g138_58:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_58;
+    }
+
+g138_59:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_59;
+    }
+
+g138_63:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_63;
+    }
+
+g138_65:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_65;
+    }
+
+g138_67:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_67;
+    }
+
+g138_68:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_68;
+    }
+
+g138_69:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_69;
+    }
+
+g138_70:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_70;
+    }
+
+g138_71:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_71;
+    }
+
+g138_72:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_72;
+    }
+
+g138_73:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_73;
+    }
+
+g138_74:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_74;
+    }
+
+g138_75:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_75;
+    }
+
+g138_77:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_77;
+    }
+
+g138_78:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_78;
+    }
+
+g138_80:
+    switch (stack.top())
+    {
+    default:
+        stack.push(35);
+        goto e35_80;
+    }
+
+g139_54:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_54;
+    case 51:
+        stack.push(108);
+        goto e108_54;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_54;
+    }
+
+g139_55:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_55;
+    case 51:
+        stack.push(108);
+        goto e108_55;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_55;
+    }
+
+g139_58:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_58;
+    case 51:
+        stack.push(108);
+        goto e108_58;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_58;
+    }
+
+g139_59:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_59;
+    case 51:
+        stack.push(108);
+        goto e108_59;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_59;
+    }
+
+g139_63:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_63;
+    case 51:
+        stack.push(108);
+        goto e108_63;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_63;
+    }
+
+g139_64:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        errorState = 106;
+        goto error;
+    case 51:
+        stack.push(108);
+        errorState = 108;
+        goto error;
+    case 239:
+        stack.push(267);
+        goto e267_64;
+    default:
+        stack.push(39);
+        goto e39_64;
+    }
+
+g139_65:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_65;
+    case 51:
+        stack.push(108);
+        goto e108_65;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_65;
+    }
+
+g139_66:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        errorState = 106;
+        goto error;
+    case 51:
+        stack.push(108);
+        errorState = 108;
+        goto error;
+    case 239:
+        stack.push(267);
+        goto e267_66;
+    default:
+        stack.push(39);
+        goto e39_66;
+    }
+
+g139_67:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_67;
+    case 51:
+        stack.push(108);
+        goto e108_67;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_67;
+    }
+
+g139_68:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_68;
+    case 51:
+        stack.push(108);
+        goto e108_68;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_68;
+    }
+
+g139_69:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_69;
+    case 51:
+        stack.push(108);
+        goto e108_69;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_69;
+    }
+
+g139_70:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_70;
+    case 51:
+        stack.push(108);
+        goto e108_70;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_70;
+    }
+
+g139_71:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_71;
+    case 51:
+        stack.push(108);
+        goto e108_71;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_71;
+    }
+
+g139_72:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_72;
+    case 51:
+        stack.push(108);
+        goto e108_72;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_72;
+    }
+
+g139_73:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_73;
+    case 51:
+        stack.push(108);
+        goto e108_73;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_73;
+    }
+
+g139_74:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_74;
+    case 51:
+        stack.push(108);
+        goto e108_74;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_74;
+    }
+
+g139_75:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_75;
+    case 51:
+        stack.push(108);
+        goto e108_75;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_75;
+    }
+
+g139_77:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_77;
+    case 51:
+        stack.push(108);
+        goto e108_77;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_77;
+    }
+
+g139_78:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_78;
+    case 51:
+        stack.push(108);
+        goto e108_78;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_78;
+    }
+
+g139_80:
+    switch (stack.top())
+    {
+    case 50:
+        stack.push(106);
+        goto e106_80;
+    case 51:
+        stack.push(108);
+        goto e108_80;
+    case 239:
+        stack.push(267);
+        errorState = 267;
+        goto error;
+    default:
+        stack.push(39);
+        goto e39_80;
+    }
+
+g140_54:
+    switch (stack.top())
+    {
+    case 126:
+        stack.push(181);
+        goto e181_54;
+    default:
+        stack.push(75);
+        goto e75_54;
+    }
+
+error:
+    throw SyntacticError(PARSER_ERROR[errorState], currentToken.getPosition());
+}
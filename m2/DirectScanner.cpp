@@ -0,0 +1,1409 @@
+// Gerado por tools/gen_direct_scanner.cpp a partir de Constants.cpp. Não editar:
+// depois de regenerar as tabelas no GALS, gere este arquivo de novo.
+
+#include "DirectScanner.h"
+
+#include <cstdint>
+
+static_assert(STATES_COUNT == 52, "DirectScanner.cpp não corresponde a Constants.cpp");
+
+//Bit i de LOOPS[c]: o byte c mantém o estado 1 3 16 21 35 36 48 49 50, nesta ordem
+static const uint16_t LOOPS[256] =
+{
+         0,      0,      0,      0,      0,      0,      0,      0,
+         0,   0x33,   0x13,      0,      0,   0x33,      0,      0,
+         0,      0,      0,      0,      0,      0,      0,      0,
+         0,      0,      0,      0,      0,      0,      0,      0,
+      0x33,   0x32,   0x30,   0x32,   0x32,   0x32,   0x32,   0x32,
+      0x32,   0x32,   0x22,   0x32,   0x32,   0x32,   0x32,   0x32,
+     0x1fe,  0x1fe,  0x17e,  0x17e,  0x17e,  0x17e,  0x17e,  0x17e,
+     0x17e,  0x17e,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,
+      0x32,  0x13a,  0x13a,  0x13a,  0x13a,  0x13a,  0x13a,   0x3a,
+      0x3a,   0x3a,   0x3a,   0x3a,   0x3a,   0x3a,   0x3a,   0x3a,
+      0x3a,   0x3a,   0x3a,   0x3a,   0x3a,   0x3a,   0x3a,   0x3a,
+      0x3a,   0x3a,   0x3a,   0x32,   0x32,   0x32,   0x32,   0x3a,
+      0x32,  0x13a,  0x13a,  0x13a,  0x13a,  0x13a,  0x13a,   0x3a,
+      0x3a,   0x3a,   0x3a,   0x3a,   0x3a,   0x3a,   0x3a,   0x3a,
+      0x3a,   0x3a,   0x3a,   0x3a,   0x3a,   0x3a,   0x3a,   0x3a,
+      0x3a,   0x3a,   0x3a,   0x32,   0x32,   0x32,   0x32,      0,
+         0,      0,      0,      0,      0,      0,      0,      0,
+         0,      0,      0,      0,      0,      0,      0,      0,
+         0,      0,      0,      0,      0,      0,      0,      0,
+         0,      0,      0,      0,      0,      0,      0,      0,
+         0,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,
+      0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,
+      0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,
+      0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,
+      0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,
+      0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,
+      0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,
+      0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,
+      0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,
+      0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,
+      0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,
+      0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32,   0x32
+};
+
+bool DirectScanner::run(const char *text, std::size_t length, std::size_t start, std::size_t &position,
+                        int &stateRef, int &oldStateRef, int &endStateRef, std::size_t &endLengthRef)
+{
+    //Cópias locais, para ficarem em registradores
+    std::size_t pos = position;
+    int state = stateRef;
+    int oldState = oldStateRef;
+    int endState = endStateRef;
+    std::size_t endLength = endLengthRef;
+
+    //Retoma do estado em que a última chamada parou
+    if (state == 0)
+        goto s0;
+    switch (state)
+    {
+    case 0: goto s0;
+    case 1: goto s1;
+    case 2: goto s2;
+    case 3: goto s3;
+    case 4: goto s4;
+    case 5: goto s5;
+    case 6: goto s6;
+    case 7: goto s7;
+    case 8: goto s8;
+    case 9: goto s9;
+    case 10: goto s10;
+    case 11: goto s11;
+    case 12: goto s12;
+    case 13: goto s13;
+    case 14: goto s14;
+    case 15: goto s15;
+    case 16: goto s16;
+    case 17: goto s17;
+    case 18: goto s18;
+    case 19: goto s19;
+    case 20: goto s20;
+    case 21: goto s21;
+    case 22: goto s22;
+    case 23: goto s23;
+    case 24: goto s24;
+    case 25: goto s25;
+    case 26: goto s26;
+    case 27: goto s27;
+    case 28: goto s28;
+    case 29: goto s29;
+    case 30: goto s30;
+    case 31: goto s31;
+    case 32: goto s32;
+    case 33: goto s33;
+    case 34: goto s34;
+    case 35: goto s35;
+    case 36: goto s36;
+    case 37: goto s37;
+    case 38: goto s38;
+    case 39: goto s39;
+    case 40: goto s40;
+    case 41: goto s41;
+    case 42: goto s42;
+    case 43: goto s43;
+    case 44: goto s44;
+    case 45: goto s45;
+    case 46: goto s46;
+    case 47: goto s47;
+    case 48: goto s48;
+    case 49: goto s49;
+    case 50: goto s50;
+    case 51: goto s51;
+    default: goto dead;
+    }
+
+s0:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 9: case 10: case 13: case ' ':
+        oldState = 0;
+        pos++;
+        goto a1;
+    case '!':
+        oldState = 0;
+        pos++;
+        goto a2;
+    case '"':
+        oldState = 0;
+        pos++;
+        goto s3;
+    case '%':
+        oldState = 0;
+        pos++;
+        goto a4;
+    case '&':
+        oldState = 0;
+        pos++;
+        goto a5;
+    case '\'':
+        oldState = 0;
+        pos++;
+        goto s6;
+    case '(':
+        oldState = 0;
+        pos++;
+        goto a7;
+    case ')':
+        oldState = 0;
+        pos++;
+        goto a8;
+    case '*':
+        oldState = 0;
+        pos++;
+        goto a9;
+    case '+':
+        oldState = 0;
+        pos++;
+        goto a10;
+    case ',':
+        oldState = 0;
+        pos++;
+        goto a11;
+    case '-':
+        oldState = 0;
+        pos++;
+        goto a12;
+    case '.':
+        oldState = 0;
+        pos++;
+        goto a13;
+    case '/':
+        oldState = 0;
+        pos++;
+        goto a14;
+    case '0':
+        oldState = 0;
+        pos++;
+        goto a15;
+    case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8':
+    case '9':
+        oldState = 0;
+        pos++;
+        goto a16;
+    case ';':
+        oldState = 0;
+        pos++;
+        goto a17;
+    case '<':
+        oldState = 0;
+        pos++;
+        goto a18;
+    case '=':
+        oldState = 0;
+        pos++;
+        goto a19;
+    case '>':
+        oldState = 0;
+        pos++;
+        goto a20;
+    case 'A': case 'B': case 'C': case 'D': case 'E': case 'F': case 'G': case 'H':
+    case 'I': case 'J': case 'K': case 'L': case 'M': case 'N': case 'O': case 'P':
+    case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V': case 'W': case 'X':
+    case 'Y': case 'Z': case 'a': case 'b': case 'c': case 'd': case 'e': case 'f':
+    case 'g': case 'h': case 'i': case 'j': case 'k': case 'l': case 'm': case 'n':
+    case 'o': case 'p': case 'q': case 'r': case 's': case 't': case 'u': case 'v':
+    case 'w': case 'x': case 'y': case 'z':
+        oldState = 0;
+        pos++;
+        goto a21;
+    case '[':
+        oldState = 0;
+        pos++;
+        goto a22;
+    case ']':
+        oldState = 0;
+        pos++;
+        goto a23;
+    case '^':
+        oldState = 0;
+        pos++;
+        goto a24;
+    case '{':
+        oldState = 0;
+        pos++;
+        goto a25;
+    case '|':
+        oldState = 0;
+        pos++;
+        goto a26;
+    case '}':
+        oldState = 0;
+        pos++;
+        goto a27;
+    case '~':
+        oldState = 0;
+        pos++;
+        goto a28;
+    case 0:
+        if (pos == length)
+        {
+            state = 0;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 0;
+        pos++;
+        goto dead;
+    }
+
+a1:
+    endState = 1;
+    endLength = pos - start;
+s1:
+    if (LOOPS[static_cast<unsigned char>(text[pos])] & 0x1)
+    {
+        do
+            pos++;
+        while (LOOPS[static_cast<unsigned char>(text[pos])] & 0x1);
+        oldState = 1;
+        endState = 1;
+        endLength = pos - start;
+    }
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 1;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 1;
+        pos++;
+        goto dead;
+    }
+
+a2:
+    endState = 2;
+    endLength = pos - start;
+s2:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '=':
+        oldState = 2;
+        pos++;
+        goto a29;
+    case 0:
+        if (pos == length)
+        {
+            state = 2;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 2;
+        pos++;
+        goto dead;
+    }
+
+s3:
+    if (LOOPS[static_cast<unsigned char>(text[pos])] & 0x2)
+    {
+        do
+            pos++;
+        while (LOOPS[static_cast<unsigned char>(text[pos])] & 0x2);
+        oldState = 3;
+    }
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '"':
+        oldState = 3;
+        pos++;
+        goto a30;
+    case 0:
+        if (pos == length)
+        {
+            state = 3;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 3;
+        pos++;
+        goto dead;
+    }
+
+a4:
+    endState = 4;
+    endLength = pos - start;
+s4:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 4;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 4;
+        pos++;
+        goto dead;
+    }
+
+a5:
+    endState = 5;
+    endLength = pos - start;
+s5:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '&':
+        oldState = 5;
+        pos++;
+        goto a31;
+    case 0:
+        if (pos == length)
+        {
+            state = 5;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 5;
+        pos++;
+        goto dead;
+    }
+
+s6:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 11: case 12: case 14: case 15: case 16: case 17: case 18: case 19:
+    case 20: case 21: case 22: case 23: case 24: case 25: case 26: case 27:
+    case 28: case 29: case 30: case 31: case '\'': case 127: case 128: case 129:
+    case 130: case 131: case 132: case 133: case 134: case 135: case 136: case 137:
+    case 138: case 139: case 140: case 141: case 142: case 143: case 144: case 145:
+    case 146: case 147: case 148: case 149: case 150: case 151: case 152: case 153:
+    case 154: case 155: case 156: case 157: case 158: case 159: case 160:
+        oldState = 6;
+        pos++;
+        goto dead;
+    case 0:
+        if (pos == length)
+        {
+            state = 6;
+            goto end;
+        }
+        oldState = 6;
+        pos++;
+        goto dead;
+    default:
+        oldState = 6;
+        pos++;
+        goto s32;
+    }
+
+a7:
+    endState = 7;
+    endLength = pos - start;
+s7:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 7;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 7;
+        pos++;
+        goto dead;
+    }
+
+a8:
+    endState = 8;
+    endLength = pos - start;
+s8:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 8;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 8;
+        pos++;
+        goto dead;
+    }
+
+a9:
+    endState = 9;
+    endLength = pos - start;
+s9:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 9;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 9;
+        pos++;
+        goto dead;
+    }
+
+a10:
+    endState = 10;
+    endLength = pos - start;
+s10:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '+':
+        oldState = 10;
+        pos++;
+        goto a33;
+    case 0:
+        if (pos == length)
+        {
+            state = 10;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 10;
+        pos++;
+        goto dead;
+    }
+
+a11:
+    endState = 11;
+    endLength = pos - start;
+s11:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 11;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 11;
+        pos++;
+        goto dead;
+    }
+
+a12:
+    endState = 12;
+    endLength = pos - start;
+s12:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '-':
+        oldState = 12;
+        pos++;
+        goto a34;
+    case 0:
+        if (pos == length)
+        {
+            state = 12;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 12;
+        pos++;
+        goto dead;
+    }
+
+a13:
+    endState = 13;
+    endLength = pos - start;
+s13:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 13;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 13;
+        pos++;
+        goto dead;
+    }
+
+a14:
+    endState = 14;
+    endLength = pos - start;
+s14:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '*':
+        oldState = 14;
+        pos++;
+        goto s35;
+    case '/':
+        oldState = 14;
+        pos++;
+        goto a36;
+    case 0:
+        if (pos == length)
+        {
+            state = 14;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 14;
+        pos++;
+        goto dead;
+    }
+
+a15:
+    endState = 15;
+    endLength = pos - start;
+s15:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9':
+        oldState = 15;
+        pos++;
+        goto a16;
+    case '.':
+        oldState = 15;
+        pos++;
+        goto s37;
+    case 'B': case 'b':
+        oldState = 15;
+        pos++;
+        goto s38;
+    case 'X': case 'x':
+        oldState = 15;
+        pos++;
+        goto s39;
+    case 0:
+        if (pos == length)
+        {
+            state = 15;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 15;
+        pos++;
+        goto dead;
+    }
+
+a16:
+    endState = 16;
+    endLength = pos - start;
+s16:
+    if (LOOPS[static_cast<unsigned char>(text[pos])] & 0x4)
+    {
+        do
+            pos++;
+        while (LOOPS[static_cast<unsigned char>(text[pos])] & 0x4);
+        oldState = 16;
+        endState = 16;
+        endLength = pos - start;
+    }
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '.':
+        oldState = 16;
+        pos++;
+        goto s37;
+    case 0:
+        if (pos == length)
+        {
+            state = 16;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 16;
+        pos++;
+        goto dead;
+    }
+
+a17:
+    endState = 17;
+    endLength = pos - start;
+s17:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 17;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 17;
+        pos++;
+        goto dead;
+    }
+
+a18:
+    endState = 18;
+    endLength = pos - start;
+s18:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '<':
+        oldState = 18;
+        pos++;
+        goto a40;
+    case '=':
+        oldState = 18;
+        pos++;
+        goto a41;
+    case 0:
+        if (pos == length)
+        {
+            state = 18;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 18;
+        pos++;
+        goto dead;
+    }
+
+a19:
+    endState = 19;
+    endLength = pos - start;
+s19:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '=':
+        oldState = 19;
+        pos++;
+        goto a42;
+    case 0:
+        if (pos == length)
+        {
+            state = 19;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 19;
+        pos++;
+        goto dead;
+    }
+
+a20:
+    endState = 20;
+    endLength = pos - start;
+s20:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '=':
+        oldState = 20;
+        pos++;
+        goto a43;
+    case '>':
+        oldState = 20;
+        pos++;
+        goto a44;
+    case 0:
+        if (pos == length)
+        {
+            state = 20;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 20;
+        pos++;
+        goto dead;
+    }
+
+a21:
+    endState = 21;
+    endLength = pos - start;
+s21:
+    if (LOOPS[static_cast<unsigned char>(text[pos])] & 0x8)
+    {
+        do
+            pos++;
+        while (LOOPS[static_cast<unsigned char>(text[pos])] & 0x8);
+        oldState = 21;
+        endState = 21;
+        endLength = pos - start;
+    }
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 21;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 21;
+        pos++;
+        goto dead;
+    }
+
+a22:
+    endState = 22;
+    endLength = pos - start;
+s22:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 22;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 22;
+        pos++;
+        goto dead;
+    }
+
+a23:
+    endState = 23;
+    endLength = pos - start;
+s23:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 23;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 23;
+        pos++;
+        goto dead;
+    }
+
+a24:
+    endState = 24;
+    endLength = pos - start;
+s24:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 24;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 24;
+        pos++;
+        goto dead;
+    }
+
+a25:
+    endState = 25;
+    endLength = pos - start;
+s25:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 25;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 25;
+        pos++;
+        goto dead;
+    }
+
+a26:
+    endState = 26;
+    endLength = pos - start;
+s26:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '|':
+        oldState = 26;
+        pos++;
+        goto a45;
+    case 0:
+        if (pos == length)
+        {
+            state = 26;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 26;
+        pos++;
+        goto dead;
+    }
+
+a27:
+    endState = 27;
+    endLength = pos - start;
+s27:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 27;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 27;
+        pos++;
+        goto dead;
+    }
+
+a28:
+    endState = 28;
+    endLength = pos - start;
+s28:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 28;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 28;
+        pos++;
+        goto dead;
+    }
+
+a29:
+    endState = 29;
+    endLength = pos - start;
+s29:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 29;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 29;
+        pos++;
+        goto dead;
+    }
+
+a30:
+    endState = 30;
+    endLength = pos - start;
+s30:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 30;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 30;
+        pos++;
+        goto dead;
+    }
+
+a31:
+    endState = 31;
+    endLength = pos - start;
+s31:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 31;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 31;
+        pos++;
+        goto dead;
+    }
+
+s32:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '\'':
+        oldState = 32;
+        pos++;
+        goto a46;
+    case 0:
+        if (pos == length)
+        {
+            state = 32;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 32;
+        pos++;
+        goto dead;
+    }
+
+a33:
+    endState = 33;
+    endLength = pos - start;
+s33:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 33;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 33;
+        pos++;
+        goto dead;
+    }
+
+a34:
+    endState = 34;
+    endLength = pos - start;
+s34:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 34;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 34;
+        pos++;
+        goto dead;
+    }
+
+s35:
+    if (LOOPS[static_cast<unsigned char>(text[pos])] & 0x10)
+    {
+        do
+            pos++;
+        while (LOOPS[static_cast<unsigned char>(text[pos])] & 0x10);
+        oldState = 35;
+    }
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '*':
+        oldState = 35;
+        pos++;
+        goto s47;
+    case 0:
+        if (pos == length)
+        {
+            state = 35;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 35;
+        pos++;
+        goto dead;
+    }
+
+a36:
+    endState = 36;
+    endLength = pos - start;
+s36:
+    if (LOOPS[static_cast<unsigned char>(text[pos])] & 0x20)
+    {
+        do
+            pos++;
+        while (LOOPS[static_cast<unsigned char>(text[pos])] & 0x20);
+        oldState = 36;
+        endState = 36;
+        endLength = pos - start;
+    }
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 36;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 36;
+        pos++;
+        goto dead;
+    }
+
+s37:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9':
+        oldState = 37;
+        pos++;
+        goto a48;
+    case 0:
+        if (pos == length)
+        {
+            state = 37;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 37;
+        pos++;
+        goto dead;
+    }
+
+s38:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '0': case '1':
+        oldState = 38;
+        pos++;
+        goto a49;
+    case 0:
+        if (pos == length)
+        {
+            state = 38;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 38;
+        pos++;
+        goto dead;
+    }
+
+s39:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'a': case 'b': case 'c': case 'd': case 'e': case 'f':
+        oldState = 39;
+        pos++;
+        goto a50;
+    case 0:
+        if (pos == length)
+        {
+            state = 39;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 39;
+        pos++;
+        goto dead;
+    }
+
+a40:
+    endState = 40;
+    endLength = pos - start;
+s40:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 40;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 40;
+        pos++;
+        goto dead;
+    }
+
+a41:
+    endState = 41;
+    endLength = pos - start;
+s41:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 41;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 41;
+        pos++;
+        goto dead;
+    }
+
+a42:
+    endState = 42;
+    endLength = pos - start;
+s42:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 42;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 42;
+        pos++;
+        goto dead;
+    }
+
+a43:
+    endState = 43;
+    endLength = pos - start;
+s43:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 43;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 43;
+        pos++;
+        goto dead;
+    }
+
+a44:
+    endState = 44;
+    endLength = pos - start;
+s44:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 44;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 44;
+        pos++;
+        goto dead;
+    }
+
+a45:
+    endState = 45;
+    endLength = pos - start;
+s45:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 45;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 45;
+        pos++;
+        goto dead;
+    }
+
+a46:
+    endState = 46;
+    endLength = pos - start;
+s46:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 46;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 46;
+        pos++;
+        goto dead;
+    }
+
+s47:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 11: case 12: case 14: case 15: case 16: case 17: case 18: case 19:
+    case 20: case 21: case 22: case 23: case 24: case 25: case 26: case 27:
+    case 28: case 29: case 30: case 31: case 127: case 128: case 129: case 130:
+    case 131: case 132: case 133: case 134: case 135: case 136: case 137: case 138:
+    case 139: case 140: case 141: case 142: case 143: case 144: case 145: case 146:
+    case 147: case 148: case 149: case 150: case 151: case 152: case 153: case 154:
+    case 155: case 156: case 157: case 158: case 159: case 160:
+        oldState = 47;
+        pos++;
+        goto dead;
+    case '/':
+        oldState = 47;
+        pos++;
+        goto a51;
+    case 0:
+        if (pos == length)
+        {
+            state = 47;
+            goto end;
+        }
+        oldState = 47;
+        pos++;
+        goto dead;
+    default:
+        oldState = 47;
+        pos++;
+        goto s35;
+    }
+
+a48:
+    endState = 48;
+    endLength = pos - start;
+s48:
+    if (LOOPS[static_cast<unsigned char>(text[pos])] & 0x40)
+    {
+        do
+            pos++;
+        while (LOOPS[static_cast<unsigned char>(text[pos])] & 0x40);
+        oldState = 48;
+        endState = 48;
+        endLength = pos - start;
+    }
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 48;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 48;
+        pos++;
+        goto dead;
+    }
+
+a49:
+    endState = 49;
+    endLength = pos - start;
+s49:
+    if (LOOPS[static_cast<unsigned char>(text[pos])] & 0x80)
+    {
+        do
+            pos++;
+        while (LOOPS[static_cast<unsigned char>(text[pos])] & 0x80);
+        oldState = 49;
+        endState = 49;
+        endLength = pos - start;
+    }
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 49;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 49;
+        pos++;
+        goto dead;
+    }
+
+a50:
+    endState = 50;
+    endLength = pos - start;
+s50:
+    if (LOOPS[static_cast<unsigned char>(text[pos])] & 0x100)
+    {
+        do
+            pos++;
+        while (LOOPS[static_cast<unsigned char>(text[pos])] & 0x100);
+        oldState = 50;
+        endState = 50;
+        endLength = pos - start;
+    }
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 50;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 50;
+        pos++;
+        goto dead;
+    }
+
+a51:
+    endState = 51;
+    endLength = pos - start;
+s51:
+    switch (static_cast<unsigned char>(text[pos]))
+    {
+    case 0:
+        if (pos == length)
+        {
+            state = 51;
+            goto end;
+        }
+        //fall through
+    default:
+        oldState = 51;
+        pos++;
+        goto dead;
+    }
+
+dead:
+    state = -1;
+end:
+    position = pos;
+    stateRef = state;
+    oldStateRef = oldState;
+    endStateRef = endState;
+    endLengthRef = endLength;
+    return state < 0;
+}
@@ -0,0 +1,25 @@
+#ifndef DIRECT_SCANNER_H
+#define DIRECT_SCANNER_H
+
+#include "Constants.h"
+
+#include <cstddef>
+
+// O DFA de SCANNER_TABLE em código direto: um rótulo e um switch por estado,
+// gerados por tools/gen_direct_scanner.cpp em DirectScanner.cpp. O Lexico o
+// usa no lugar do laço de tabela quando compilado com SCANNER_DIRECT (o
+// padrão continua sendo a tabela, mais rápida em código misto), e só com as
+// tabelas embutidas (Tables::isBuiltin): as carregadas de arquivo podem ser
+// de outra gramática.
+namespace DirectScanner
+{
+    // Avança a partir de (state, position) como o laço de tabela do Lexico.
+    // Devolve true numa transição de erro (position fica depois do byte que
+    // falhou e state em -1) e false ao encontrar a sentinela em
+    // position == length; neste caso state é o estado atual, e a chamada
+    // pode ser retomada dali depois que a janela for recarregada.
+    bool run(const char *text, std::size_t length, std::size_t start, std::size_t &position,
+             int &state, int &oldState, int &endState, std::size_t &endLength);
+}
+
+#endif
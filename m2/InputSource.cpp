@@ -0,0 +1,165 @@
+#include "InputSource.h"
+
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+InputSource::InputSource(InputSource &&other) noexcept
+  : text(""), length(0), terminated(true), mapping(0), mappingSize(0)
+{
+    *this = std::move(other);
+}
+
+InputSource &InputSource::operator=(InputSource &&other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    release();
+
+    bool ownsText = other.text == other.owned.data();
+    owned = std::move(other.owned);
+    text = ownsText ? owned.data() : other.text;
+    length = other.length;
+    terminated = other.terminated;
+    mapping = other.mapping;
+    mappingSize = other.mappingSize;
+
+    other.text = "";
+    other.length = 0;
+    other.terminated = true;
+    other.mapping = 0;
+    other.mappingSize = 0;
+    other.owned.clear();
+
+    return *this;
+}
+
+InputSource InputSource::borrow(const char *data, std::size_t size, bool terminated)
+{
+    InputSource source;
+    source.text = data;
+    source.length = size;
+    source.terminated = terminated;
+    return source;
+}
+
+InputSource InputSource::own(std::string text)
+{
+    InputSource source;
+    source.owned = std::move(text);
+    source.text = source.owned.data();
+    source.length = source.owned.size();
+    return source;
+}
+
+bool InputSource::mapFile(const std::string &path)
+{
+    release();
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, 0,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (! GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    if (size.QuadPart > 0)
+    {
+        HANDLE view = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+        if (view != 0)
+        {
+            mapping = MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(view);
+        }
+        if (mapping == 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+    }
+    CloseHandle(file);
+    mappingSize = static_cast<std::size_t>(size.QuadPart);
+    length = mappingSize;
+
+    //O resto da última página da visão vem zerado
+    SYSTEM_INFO system;
+    GetSystemInfo(&system);
+    terminated = mappingSize == 0 || mappingSize % system.dwPageSize != 0;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    if (info.st_size > 0)
+    {
+        //Reserva ao menos uma página além do arquivo: o que sobra depois dele
+        //é zerado e serve de '\0' final
+        std::size_t size = static_cast<std::size_t>(info.st_size);
+        std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        std::size_t span = (size / page + 1) * page;
+
+        void *area = mmap(0, span, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (area == MAP_FAILED)
+        {
+            close(fd);
+            return false;
+        }
+
+        void *view = mmap(area, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0);
+        if (view == MAP_FAILED)
+        {
+            munmap(area, span);
+            close(fd);
+            return false;
+        }
+        mapping = view;
+        mappingSize = span;
+    }
+    close(fd);
+    length = static_cast<std::size_t>(info.st_size);
+    terminated = true;
+#endif
+
+    text = mapping != 0 ? static_cast<const char *>(mapping) : "";
+    return true;
+}
+
+void InputSource::release()
+{
+    if (mapping != 0)
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile(mapping);
+#else
+        munmap(mapping, mappingSize);
+#endif
+    }
+
+    text = "";
+    length = 0;
+    terminated = true;
+    mapping = 0;
+    mappingSize = 0;
+    owned.clear();
+}
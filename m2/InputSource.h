@@ -0,0 +1,46 @@
+#ifndef INPUT_SOURCE_H
+#define INPUT_SOURCE_H
+
+#include <cstddef>
+#include <string>
+
+// Texto de entrada do Lexico. Pode emprestar um buffer que já existe (o
+// chamador o mantém vivo durante a análise), mapear um arquivo somente
+// leitura com mmap, ou ser dono de uma std::string. Nos dois primeiros casos
+// o texto não é copiado. isTerminated() diz se há um '\0' legível logo após o
+// texto, que o Lexico usa como sentinela.
+class InputSource
+{
+public:
+    InputSource() : text(""), length(0), terminated(true), mapping(0), mappingSize(0) { }
+    ~InputSource() { release(); }
+
+    InputSource(InputSource &&other) noexcept;
+    InputSource &operator=(InputSource &&other) noexcept;
+
+    InputSource(const InputSource &) = delete;
+    InputSource &operator=(const InputSource &) = delete;
+
+    // terminated: data[size] existe e vale '\0' (QByteArray, std::string)
+    static InputSource borrow(const char *data, std::size_t size, bool terminated = false);
+    static InputSource own(std::string text);
+
+    // Falso se o arquivo não puder ser aberto ou mapeado
+    bool mapFile(const std::string &path);
+
+    const char *data() const { return text; }
+    std::size_t size() const { return length; }
+    bool isTerminated() const { return terminated; }
+
+private:
+    const char *text;
+    std::size_t length;
+    bool terminated;
+    std::string owned;
+    void *mapping;
+    std::size_t mappingSize;
+
+    void release();
+};
+
+#endif
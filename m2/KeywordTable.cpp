@@ -0,0 +1,109 @@
+#include "KeywordTable.h"
+#include "Tables.h"
+
+#include <algorithm>
+#include <cstring>
+
+KeywordTable::KeywordTable(const Tables &tables)
+  : built(true), fullHash(false), seed(0), shift(31), minLength(1), maxLength(0)
+{
+    slots.assign(2, Entry());
+
+    withCases.assign(tables.getTokenCount(), 0);
+    for (int base = 0; base < tables.getTokenCount(); base++)
+        withCases[base] = tables.specialCasesBegin(base) != tables.specialCasesEnd(base);
+
+    const int specialCases = tables.getSpecialCasesCount();
+    if (specialCases == 0)
+        return;
+
+    minLength = std::strlen(tables.specialCaseKey(0));
+    for (int i = 0; i < specialCases; i++)
+    {
+        std::size_t length = std::strlen(tables.specialCaseKey(i));
+        if (length < minLength)
+            minLength = length;
+        if (length > maxLength)
+            maxLength = length;
+    }
+
+    //Semente gravada na imagem; se não servir (imagem de outra versão), procura outra
+    int hint = tables.getKeywordBits();
+    if (hint != 0 && tryBuild(tables, hint < 0, tables.getKeywordSeed(), hint < 0 ? -hint : hint))
+        return;
+
+    //Começa com ao menos 4 posições por chave e aumenta a tabela se nenhuma semente servir
+    int bits = 1;
+    while ((1 << bits) < 4 * specialCases)
+        bits++;
+
+    if (samplesDiffer(tables))
+        for (int extra = 0; extra <= 2 && bits + extra <= MAX_BITS; extra++)
+            for (uint32_t s = 0; s < 65536; s++)
+                if (tryBuild(tables, false, s, bits + extra))
+                    return;
+
+    //Há chaves que só diferem fora dos caracteres amostrados
+    for (; bits <= MAX_BITS; bits++)
+        for (uint32_t s = 1; s <= 4096; s++)
+            if (tryBuild(tables, true, s, bits))
+                return;
+
+    //Nenhuma semente serviu: a tabela fica vazia e lookup devolve sempre a base
+    built = false;
+    fullHash = false;
+    shift = 31;
+    minLength = 1;
+    maxLength = 0;
+    slots.assign(2, Entry());
+}
+
+//Falso se duas chaves tiverem a mesma amostra (tamanho e três caracteres)
+bool KeywordTable::samplesDiffer(const Tables &tables) const
+{
+    std::vector<uint32_t> samples;
+    for (int i = 0; i < tables.getSpecialCasesCount(); i++)
+    {
+        const char *key = tables.specialCaseKey(i);
+        samples.push_back(sample(key, std::strlen(key)));
+    }
+    std::sort(samples.begin(), samples.end());
+    return std::adjacent_find(samples.begin(), samples.end()) == samples.end();
+}
+
+//Monta a tabela com a semente dada; falso se duas chaves caírem na mesma
+//posição. As posições ocupadas são limpas antes de desistir, para que a
+//próxima tentativa do mesmo tamanho não precise limpar a tabela inteira
+bool KeywordTable::tryBuild(const Tables &tables, bool fullHash, uint32_t seed, int bits)
+{
+    this->fullHash = fullHash;
+    this->seed = seed;
+    shift = 32 - bits;
+    if (slots.size() != std::size_t(1) << bits)
+        slots.assign(std::size_t(1) << bits, Entry());
+
+    std::vector<uint32_t> used;
+    for (int base = 0; base < tables.getTokenCount(); base++)
+    {
+        for (int i = tables.specialCasesBegin(base); i < tables.specialCasesEnd(base); i++)
+        {
+            const char *key = tables.specialCaseKey(i);
+            std::size_t length = std::strlen(key);
+            uint32_t slot = hash(key, length) >> shift;
+            Entry &entry = slots[slot];
+            if (entry.length != 0)
+            {
+                for (uint32_t u : used)
+                    slots[u] = Entry();
+                return false;
+            }
+
+            entry.text = key;
+            entry.length = static_cast<uint32_t>(length);
+            entry.base = static_cast<int16_t>(base);
+            entry.value = static_cast<int16_t>(tables.specialCaseValue(i));
+            used.push_back(slot);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,100 @@
+#ifndef KEYWORD_TABLE_H
+#define KEYWORD_TABLE_H
+
+#include "Constants.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Tables;
+
+// Casos especiais do GALS (palavras reservadas como "int" e "while", que o
+// scanner reconhece como ID) em uma tabela hash perfeita. A semente do hash
+// é procurada uma única vez por Tables (Tables::getKeywords), até que nenhuma
+// chave colida; a busca é então um hash de tempo constante e uma comparação.
+// A procura vai até tabelas de 2^MAX_BITS posições; se nenhuma servir,
+// isBuilt é falso, a tabela fica vazia e Tables::loadImage recusa a imagem.
+class KeywordTable
+{
+public:
+    static const int MAX_BITS = 24;
+
+    explicit KeywordTable(const Tables &tables);
+
+    bool isBuilt() const { return built; }
+
+    bool hasCases(TokenId base) const { return withCases[base] != 0; }
+
+    TokenId lookup(TokenId base, const char *text, std::size_t length) const
+    {
+        if (length < minLength || length > maxLength)
+            return base;
+
+        const Entry &entry = slots[hash(text, length) >> shift];
+        if (entry.length != length || entry.base != base)
+            return base;
+
+        //As chaves são curtas: comparar aqui sai mais barato que chamar memcmp
+        for (std::size_t i = 0; i < length; i++)
+            if (entry.text[i] != text[i])
+                return base;
+
+        return static_cast<TokenId>(entry.value);
+    }
+
+    std::size_t sizeInBytes() const { return slots.size() * sizeof(Entry); }
+
+    // Parâmetros do hash encontrado, gravados por Tables::builtinImage
+    uint32_t getSeed() const { return seed; }
+    int getBits() const { return fullHash ? shift - 32 : 32 - shift; }
+
+private:
+    struct Entry
+    {
+        const char *text;
+        uint32_t length;
+        int16_t base;
+        int16_t value;
+    };
+
+    //Normalmente só o tamanho e três caracteres do lexema entram no hash;
+    //o lexema inteiro só é usado se isso não separar todas as chaves
+    uint32_t hash(const char *text, std::size_t length) const
+    {
+        uint32_t h;
+        if (fullHash)
+        {
+            h = seed;
+            for (std::size_t i = 0; i < length; i++)
+                h = (h ^ static_cast<unsigned char>(text[i])) * 0x01000193u;
+        }
+        else
+            h = (sample(text, length) ^ seed) * 0x9E3779B1u;
+        return h;
+    }
+
+    //Como o resto do hash é uma bijeção, duas chaves com a mesma amostra
+    //colidem com qualquer semente
+    static uint32_t sample(const char *text, std::size_t length)
+    {
+        return static_cast<uint32_t>(length)
+             ^ static_cast<uint32_t>(static_cast<unsigned char>(text[0])) << 8
+             ^ static_cast<uint32_t>(static_cast<unsigned char>(text[length / 2])) << 16
+             ^ static_cast<uint32_t>(static_cast<unsigned char>(text[length - 1])) << 24;
+    }
+
+    bool samplesDiffer(const Tables &tables) const;
+    bool tryBuild(const Tables &tables, bool fullHash, uint32_t seed, int bits);
+
+    bool built;
+    bool fullHash;
+    uint32_t seed;
+    int shift;
+    std::size_t minLength;
+    std::size_t maxLength;
+    std::vector<Entry> slots;
+    std::vector<uint8_t> withCases;
+};
+
+#endif
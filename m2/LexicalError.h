@@ -9,7 +9,7 @@ class LexicalError : public AnalysisError
 {
 public:
 
-    LexicalError(const std::string &msg, int position = -1)
+    LexicalError(const std::string &msg, long long position = -1)
       : AnalysisError(msg, position) { }
 };
 
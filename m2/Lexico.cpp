@@ -1,69 +1,577 @@
 #include "Lexico.h"
+#include "DirectScanner.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+Lexico::Lexico(const char *input, const Tables &tables)
+  : tables(&tables), table(&tables.getScanner()), keywords(&tables.getKeywords()),
+    tokenStates(tables.getTokenStates()), statesCount(tables.getStatesCount()), direct(tables.isBuiltin())
+{
+    setInput(input);
+}
 
 void Lexico::setInput(const char *input)
 {
-    this->input = input;
+    setInput(InputSource::own(input));
+}
+
+void Lexico::setInput(InputSource input)
+{
+    //O laço de scan precisa de um '\0' depois do texto
+    if (! input.isTerminated())
+        input = InputSource::own(std::string(input.data(), input.size()));
+
+    this->input = std::move(input);
+    text = this->input.data();
+    length = this->input.size();
+    offset = 0;
+    fd = -1;
+    streamEnd = true;
+    reach = 0;
+    lastLexeme = 0;
+    window.clear();
+    resetFailed();
+    resetLines();
     setPosition(0);
 }
 
-Token *Lexico::nextToken()
+void Lexico::setStream(int fd, std::size_t windowSize)
 {
-    if ( ! hasInput() )
-        return 0;
+    input = InputSource();
+    window.assign((windowSize > 0 ? windowSize : 1) + 1, '\0');
+    text = window.data();
+    length = 0;
+    offset = 0;
+    this->fd = fd;
+    streamEnd = false;
+    reach = 0;
+    lastLexeme = 0;
+    resetFailed();
+    resetLines();
+    setPosition(0);
+}
 
-    unsigned start = position;
+bool Lexico::nextToken(Token &token)
+{
+    std::size_t start;
+    TokenId id = scan(start);
 
-    int state = 0;
-    int oldState = 0;
-    int endState = -1;
-    int end = -1;
+    if (id == DOLLAR)
+        return false;
 
-    while (hasInput())
+    std::string_view lexeme(text + start, position - start);
+    if (fd >= 0)
     {
-        oldState = state;
-        state = nextState(nextChar(), state);
+        //A janela pode ser reaproveitada: guarda uma cópia do lexema
+        lastLexeme ^= 1;
+        lexemes[lastLexeme].assign(lexeme.data(), lexeme.size());
+        lexeme = lexemes[lastLexeme];
+    }
 
-        if (state < 0)
+    token = Token(id, lexeme, offset + start);
+    return true;
+}
+
+void Lexico::tokenizeAll(TokenBuffer &tokens)
+{
+    tokens.clear(text);
+    //Código típico tem um token a cada 3 ou 4 bytes: reservar evita copiar
+    //os vetores (agora com posições de 64 bits) a cada vez que dobram
+    tokens.reserve((length - position) / 4);
+
+    std::size_t start;
+    TokenId id;
+    while ((id = scan(start)) != DOLLAR)
+        tokens.push(id, start, position - start);
+}
+
+//Executa job(k) para cada k em [0, count): k = 0 no thread atual, os outros
+//em threads próprios (ou também no atual, se não der para criar o thread)
+template <typename Job>
+static void runEach(std::size_t count, Job job)
+{
+    std::vector<std::thread> workers;
+    for (std::size_t k = 1; k < count; k++)
+    {
+        try
+        {
+            workers.emplace_back(job, k);
+        }
+        catch (const std::system_error &)
+        {
+            job(k);
+        }
+    }
+
+    job(0);
+
+    for (std::size_t k = 0; k < workers.size(); k++)
+        workers[k].join();
+}
+
+void Lexico::tokenizeParallel(TokenBuffer &tokens, unsigned threads)
+{
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+
+    std::size_t count = (length - position) / PARALLEL_CHUNK;
+    if (count > threads)
+        count = threads;
+
+    if (fd >= 0 || count < 2)
+    {
+        tokenizeAll(tokens);
+        return;
+    }
+
+    //Fronteiras logo depois de uma quebra de linha, onde o palpite de que
+    //começa um token costuma acertar
+    std::vector<Chunk> chunks(count);
+    std::size_t begin = position;
+    for (std::size_t k = 0; k < count; k++)
+    {
+        std::size_t limit = length;
+        if (k + 1 < count)
+        {
+            limit = position + (length - position) / count * (k + 1);
+            const char *newline = static_cast<const char *>(std::memchr(text + limit, '\n', length - limit));
+            limit = newline != 0 ? newline - text + 1 : length;
+            if (limit < begin)
+                limit = begin;
+        }
+
+        chunks[k].begin = begin;
+        chunks[k].limit = limit;
+        chunks[k].next = limit;
+        chunks[k].tokens.clear(text);
+        chunks[k].tokens.reserve((limit - begin) / 4);
+        begin = limit;
+    }
+
+    const Tables &grammar = *tables;
+    const char *input = text;
+    std::size_t size = length;
+    runEach(count, [&chunks, &grammar, input, size](std::size_t k) { scanChunk(grammar, input, size, chunks[k]); });
+
+    //Costura: a partir do fim do pedaço anterior a leitura segue sequencial
+    //até achar um token que o pedaço também leu. Dali em diante os dois
+    //coincidem, porque a leitura a partir do início de um token só depende
+    //da posição
+    std::vector<TokenBuffer> leads(count);
+    std::vector<std::size_t> from(count, 0);
+    std::exception_ptr error;
+    std::size_t used = count;
+
+    position = chunks[0].begin;
+    for (std::size_t k = 0; k < count && used == count; k++)
+    {
+        Chunk &chunk = chunks[k];
+        std::size_t n = chunk.tokens.size();
+        std::size_t &j = from[k];
+        leads[k].clear(text);
+
+        try
+        {
+            for (;;)
+            {
+                std::size_t start = position;
+                if (position == chunk.begin)
+                    break;
+
+                TokenId id = scan(start);
+                if (id == DOLLAR)
+                {
+                    j = n;
+                    used = k + 1;
+                    break;
+                }
+
+                while (j < n && static_cast<std::size_t>(chunk.tokens.getPosition(j)) < start)
+                    j++;
+
+                if (j < n && static_cast<std::size_t>(chunk.tokens.getPosition(j)) == start)
+                {
+                    position = start;
+                    break;
+                }
+
+                leads[k].push(id, start, position - start);
+
+                if (position >= chunk.limit)
+                {
+                    j = n;
+                    break;
+                }
+            }
+        }
+        catch (...)
+        {
+            //Erro na leitura sequencial: é o mesmo que tokenizeAll daria
+            error = std::current_exception();
+            j = n;
+            used = k + 1;
             break;
+        }
+
+        if (j < n || position == chunk.begin)
+        {
+            //O pedaço vale daqui até onde parou, inclusive o erro, se houve
+            position = chunk.next;
+            if (chunk.error)
+            {
+                error = chunk.error;
+                used = k + 1;
+            }
+        }
+    }
+
+    //Cada pedaço copia a sua parte para o lugar final, também em paralelo
+    std::vector<std::size_t> at(used + 1, 0);
+    for (std::size_t k = 0; k < used; k++)
+        at[k + 1] = at[k] + leads[k].size() + chunks[k].tokens.size() - from[k];
+
+    tokens.clear(text);
+    tokens.resize(at[used]);
+    runEach(used, [&](std::size_t k)
+    {
+        tokens.copy(at[k], leads[k], 0);
+        tokens.copy(at[k] + leads[k].size(), chunks[k].tokens, from[k]);
+    });
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void Lexico::scanChunk(const Tables &tables, const char *text, std::size_t length, Chunk &chunk)
+{
+    try
+    {
+        Lexico lexer("", tables);
+        lexer.setInput(InputSource::borrow(text, length, true));
+        lexer.setPosition(chunk.begin);
+        chunk.next = lexer.scanUntil(chunk.tokens, chunk.limit);
+    }
+    catch (...)
+    {
+        chunk.error = std::current_exception();
+    }
+}
+
+//Lê os tokens que começam antes de limit; devolve a posição de onde o
+//próximo deve ser lido
+std::size_t Lexico::scanUntil(TokenBuffer &tokens, std::size_t limit)
+{
+    std::size_t start;
+    for (;;)
+    {
+        std::size_t before = position;
+        TokenId id = scan(start);
+
+        if (id == DOLLAR)
+            return position;
+        if (start >= limit)
+            return before;
 
+        tokens.push(id, start, position - start);
+    }
+}
+
+//Reconhece o próximo token não ignorado; devolve DOLLAR no fim da entrada
+TokenId Lexico::scan(std::size_t &start)
+{
+    start = position;
+    while (moreInput(start))
+    {
+        start = position;
+
+        int state = 0;
+        int oldState = 0;
+        int endState = -1;
+        std::size_t endLength = 0;
+
+        //Dentro de um trecho já marcado anda um byte por vez, consultando as marcas
+        if (offset + static_cast<long long>(start) < failedLimit)
+            scanMarked(start, state, oldState, endState, endLength);
+
+#if defined(SCANNER_DIRECT)
+        else if (direct)
+        {
+            //O mesmo laço, em código gerado (DirectScanner.cpp). Ganha bem em
+            //texto homogêneo; em código misto os dois laços ficam próximos
+            //(tools/bench_ciclos.cpp)
+            std::size_t pos = position;
+            while (! DirectScanner::run(text, length, start, pos, state, oldState, endState, endLength))
+            {
+                position = pos;
+                if (fd < 0 || ! refill(start))
+                    break;
+                pos = position;
+            }
+            position = pos;
+        }
+#endif
         else
         {
-            if (tokenForState(state) >= 0)
+            //O texto termina sempre em '\0', cuja entrada na tabela é
+            //SENTINEL: o fim só é testado quando ela aparece. Posição e texto
+            //ficam em variáveis locais para não voltarem à memória a cada byte
+            const ScannerTable &scanner = *table;
+            const char *buffer = text;
+            std::size_t pos = position;
+
+            for (;;)
             {
-                endState = state;
-                end = position;
+                int entry = scanner.step(buffer[pos], state);
+
+                if (entry < 0)
+                {
+                    if (entry == ScannerTable::SENTINEL)
+                    {
+                        if (pos == length)
+                        {
+                            position = pos;
+                            if (fd >= 0 && refill(start))
+                            {
+                                pos = position;
+                                buffer = text;
+                                continue;
+                            }
+                            break;
+                        }
+                        entry = scanner.nulStep(state);
+                    }
+
+                    if (entry < 0)
+                    {
+                        oldState = state;
+                        state = -1;
+                        position = pos + 1;
+                        break;
+                    }
+                }
+
+                oldState = state;
+                state = entry & ScannerTable::STATE_MASK;
+                pos++;
+
+                if (entry & ScannerTable::LOOP)
+                {
+                    std::size_t skipped = scanner.skipLoop(state, buffer, pos, length);
+                    if (skipped != pos)
+                        oldState = state;
+                    pos = skipped;
+                }
+
+                if (entry & ScannerTable::ACCEPT)
+                {
+                    endState = state;
+                    endLength = pos - start;
+                }
             }
         }
+
+        if (endState < 0 || (endState != state && tokenForState(oldState) == -2))
+            throw LexicalError(tables->scannerError(oldState), offset + start);
+
+        //Avançou mais de um byte além do último estado final sem achar outro
+        if (position > start + endLength + 1)
+            markFailed(endState, start + endLength, position);
+
+        if (offset + static_cast<long long>(position) > reach)
+            reach = offset + static_cast<long long>(position);
+
+        position = start + endLength;
+
+        //endState >= 0 aqui: lê a tabela direto, sem o teste de tokenForState
+        TokenId id = static_cast<TokenId>(tokenStates[endState]);
+
+        if (id != 0)
+        {
+            if (keywords->hasCases(id))
+                id = keywords->lookup(id, text + start, endLength);
+            return id;
+        }
+    }
+    return DOLLAR;
+}
+
+//O laço de scan sem saltos, parando no primeiro par já marcado depois de um estado final
+void Lexico::scanMarked(std::size_t &start, int &state, int &oldState, int &endState, std::size_t &endLength)
+{
+    while (moreInput(start))
+    {
+        oldState = state;
+        state = nextState(nextChar(), state);
+
+        if (state < 0 || (endState >= 0 && hasFailed(state, position)))
+            break;
+
+        if (tokenForState(state) >= 0)
+        {
+            endState = state;
+            endLength = position - start;
+        }
+    }
+}
+
+//Refaz o caminho que não chegou a outro estado final a partir de (state, from)
+//e marca cada par (estado, posição) dele: quem passar por um desses pares
+//também não chega, e pode parar ali
+void Lexico::markFailed(int state, std::size_t from, std::size_t to)
+{
+    long long first = offset + static_cast<long long>(from);
+    long long last = offset + static_cast<long long>(to);
+
+    if (first >= failedLimit)
+    {
+        failed.clear();
+        failedExtra.clear();
+        failedBase = first;
+    }
+    if (last >= failedLimit)
+    {
+        failedLimit = last + 1;
+        failed.resize(static_cast<std::size_t>(failedLimit - failedBase) * FAILED_SLOTS, 0);
     }
-    if (endState < 0 || (endState != state && tokenForState(oldState) == -2))
-        throw LexicalError(SCANNER_ERROR[oldState], start);
 
-    position = end;
+    for (std::size_t pos = from; pos < to; )
+    {
+        state = nextState(text[pos++], state);
+        if (state < 0)
+            break;
 
-    TokenId token = tokenForState(endState);
+        std::size_t at = static_cast<std::size_t>(offset + static_cast<long long>(pos) - failedBase);
+        uint8_t *slot = &failed[at * FAILED_SLOTS];
+        uint8_t *end = slot + FAILED_SLOTS;
+        while (slot != end && *slot != 0 && *slot != state + 1)
+            slot++;
+        if (slot != end && state < 255)
+            *slot = static_cast<uint8_t>(state + 1);
+        else
+            failedExtra.insert(static_cast<uint64_t>(at) << 16 | static_cast<uint64_t>(state));
+    }
+}
 
-    if (token == 0)
-        return nextToken();
-    else
+bool Lexico::hasFailed(int state, std::size_t pos) const
+{
+    long long at = offset + static_cast<long long>(pos);
+    if (at < failedBase || at >= failedLimit)
+        return false;
+
+    std::size_t i = static_cast<std::size_t>(at - failedBase);
+    for (int k = 0; k < FAILED_SLOTS; k++)
+        if (failed[i * FAILED_SLOTS + k] == state + 1)
+            return true;
+    return ! failedExtra.empty() && failedExtra.count(static_cast<uint64_t>(i) << 16 | static_cast<uint64_t>(state)) != 0;
+}
+
+LineColumn Lexico::lineColumn(long long pos)
+{
+    //O texto antes da janela já foi indexado em refill
+    long long end = offset + static_cast<long long>(length);
+    long long upTo = (pos < end ? pos : end) - offset;
+    if (upTo > 0)
+        indexLines(static_cast<std::size_t>(upTo));
+
+    std::vector<long long>::const_iterator line = std::upper_bound(lineStarts.begin(), lineStarts.end(), pos) - 1;
+
+    LineColumn result;
+    result.line = (line - lineStarts.begin()) + 1;
+    result.column = pos - *line + 1;
+    return result;
+}
+
+//Acrescenta ao índice as linhas que começam no texto da janela até upTo
+void Lexico::indexLines(std::size_t upTo)
+{
+    if (offset + static_cast<long long>(upTo) <= indexedUpTo)
+        return;
+
+    const char *from = text + (indexedUpTo - offset);
+    const char *end = text + upTo;
+    while (from < end)
+    {
+        const char *newline = static_cast<const char *>(std::memchr(from, '\n', end - from));
+        if (newline == 0)
+            break;
+
+        from = newline + 1;
+        lineStarts.push_back(offset + (from - text));
+    }
+    indexedUpTo = offset + static_cast<long long>(upTo);
+}
+
+//Descarta o texto anterior a start e lê mais do descritor; start passa a ser 0
+bool Lexico::refill(std::size_t &start)
+{
+    if (streamEnd)
+        return false;
+
+    if (start > 0)
+    {
+        indexLines(start);
+        std::memmove(window.data(), window.data() + start, length - start);
+        offset += start;
+        length -= start;
+        position -= start;
+        start = 0;
+        window[length] = '\0';
+    }
+
+    //Um único token ocupa a janela toda (o último byte é a sentinela)
+    std::size_t capacity = window.size() - 1;
+    if (length == capacity)
+    {
+        capacity *= 2;
+        window.resize(capacity + 1);
+    }
+    text = window.data();
+
+    for (;;)
     {
-            std::string lexeme = input.substr(start, end-start);
-            return new Token(token, lexeme, start);
+#if defined(_WIN32)
+        long count = _read(fd, window.data() + length, static_cast<unsigned>(capacity - length));
+#else
+        long count = read(fd, window.data() + length, capacity - length);
+#endif
+        if (count > 0)
+        {
+            length += count;
+            window[length] = '\0';
+            return true;
+        }
+        if (count == 0)
+        {
+            streamEnd = true;
+            return false;
+        }
+        if (errno != EINTR)
+            throw LexicalError(std::string("Erro lendo a entrada: ") + std::strerror(errno), offset + length);
     }
 }
 
 int Lexico::nextState(unsigned char c, int state) const
 {
-    int next = SCANNER_TABLE[state][c];
-    return next;
+    return table->nextState(c, state);
 }
 
 TokenId Lexico::tokenForState(int state) const
 {
     int token = -1;
 
-    if (state >= 0 && state < STATES_COUNT)
-        token = TOKEN_STATE[state];
+    if (state >= 0 && state < statesCount)
+        token = tokenStates[state];
 
     return static_cast<TokenId>(token);
 }
-
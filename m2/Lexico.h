@@ -2,28 +2,142 @@
 #define LEXICO_H
 
 #include "Token.h"
+#include "TokenBuffer.h"
+#include "InputSource.h"
 #include "LexicalError.h"
+#include "Tables.h"
+#include "ScannerTable.h"
+#include "KeywordTable.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <string>
+#include <unordered_set>
+#include <vector>
+
+// Linha e coluna (em bytes) de uma posição, ambas começando em 1
+struct LineColumn
+{
+    long long line;
+    long long column;
+};
 
 class Lexico
 {
 public:
-    Lexico(const char *input = "") { setInput(input); }
+    static const std::size_t DEFAULT_WINDOW = 1 << 20;
+
+    Lexico(const char *input = "", const Tables &tables = Tables::defaults());
 
     void setInput(const char *input);
-    void setPosition(unsigned pos) { position = pos; }
-    Token *nextToken();
+    void setInput(InputSource input);
+
+    // Lê o texto do descritor aos pedaços, numa janela de tamanho fixo (que
+    // só cresce se um único token não couber nela). O descritor não é
+    // fechado pelo Lexico. O lexema de cada token é copiado e continua válido
+    // até que mais dois tokens sejam lidos.
+    void setStream(int fd, std::size_t windowSize = DEFAULT_WINDOW);
+    bool isStream() const { return fd >= 0; }
+
+    // Só para entrada em memória
+    void setPosition(std::size_t pos) { position = pos; }
+    std::size_t getInputSize() const { return length; }
+
+    // Fim (exclusive) do texto já examinado pelo DFA. Os tokens lidos até
+    // aqui dependem só dos bytes antes dele, inclusive os que ele leu além
+    // do fim de cada token para decidir onde o token termina.
+    long long getReach() const { return reach; }
+
+    bool nextToken(Token &token);
+
+    // Lê toda a entrada de uma vez para o buffer (só para entrada em memória)
+    void tokenizeAll(TokenBuffer &tokens);
+
+    // Como tokenizeAll, mas em pedaços lidos ao mesmo tempo, um por thread
+    // (0: um por núcleo). Cada pedaço começa depois de uma quebra de linha e é
+    // lido supondo que ali começa um token; a costura refaz sequencialmente o
+    // começo dos pedaços em que a suposição falhou (dentro de string ou de
+    // comentário), até os dois caminhos coincidirem num mesmo token. O
+    // resultado é igual ao de tokenizeAll. Entradas com menos de
+    // PARALLEL_CHUNK bytes por thread são lidas sem threads.
+    static const std::size_t PARALLEL_CHUNK = 1 << 20;
+    void tokenizeParallel(TokenBuffer &tokens, unsigned threads = 0);
+
+    // Busca binária no índice de inícios de linha, que cresce conforme o
+    // texto é lido. No modo stream só vale para posições até o fim da janela.
+    LineColumn lineColumn(long long pos);
 
 private:
-    unsigned position;
-    std::string input;
+    std::size_t position;
+    InputSource input;
+    const Tables *tables;
+    const ScannerTable *table;
+    const KeywordTable *keywords;
+    const int16_t *tokenStates;     //Copiados de Tables: consultados a cada token
+    int statesCount;
+    bool direct;
+
+    //Janela de leitura do modo stream
+    const char *text;
+    std::size_t length;
+    long long offset;
+    int fd;
+    bool streamEnd;
+    long long reach;
+    std::vector<char> window;
+    std::string lexemes[2];
+    int lastLexeme;
+
+    //Pares (estado, posição) a partir dos quais o DFA já falhou sem chegar a
+    //um estado final. Sem eles, cada "/*" sem fechamento seria percorrido até
+    //o fim da entrada de novo a cada token, e a análise ficaria quadrática.
+    //Os caminhos que falham costumam convergir, e quase toda posição tem no
+    //máximo dois estados marcados: failed guarda FAILED_SLOTS estados (mais
+    //1; 0 é nenhum) por posição, um byte cada. Os pares a mais numa mesma
+    //posição, e os estados acima de 254, vão para failedExtra, com a chave
+    //(posição << 16) | estado
+    static const int FAILED_SLOTS = 2;
+    std::vector<uint8_t> failed;
+    std::unordered_set<uint64_t> failedExtra;
+    long long failedBase;
+    long long failedLimit;
+
+    //Início de cada linha; o texto antes de indexedUpTo já foi indexado
+    std::vector<long long> lineStarts;
+    long long indexedUpTo;
+
+    //Pedaço de tokenizeParallel: tokens que começam em [begin, limit), lidos
+    //por conta própria a partir de begin, e onde a leitura parou (next)
+    struct Chunk
+    {
+        std::size_t begin;
+        std::size_t limit;
+        std::size_t next;
+        TokenBuffer tokens;
+        std::exception_ptr error;
+    };
 
+    static void scanChunk(const Tables &tables, const char *text, std::size_t length, Chunk &chunk);
+    std::size_t scanUntil(TokenBuffer &tokens, std::size_t limit);
+
+    TokenId scan(std::size_t &start);
     int nextState(unsigned char c, int state) const;
     TokenId tokenForState(int state) const;
 
-    bool hasInput() const { return position < input.size(); }
-    char nextChar() { return hasInput() ? input[position++] : (char) -1; }
+    bool refill(std::size_t &start);
+
+    void scanMarked(std::size_t &start, int &state, int &oldState, int &endState, std::size_t &endLength);
+    void markFailed(int state, std::size_t from, std::size_t to);
+    bool hasFailed(int state, std::size_t pos) const;
+    void resetFailed() { failed.clear(); failedExtra.clear(); failedBase = 0; failedLimit = 0; }
+
+    void indexLines(std::size_t upTo);
+    void resetLines() { lineStarts.assign(1, 0); indexedUpTo = 0; }
+
+    bool hasInput() const { return position < length; }
+    bool moreInput(std::size_t &start) { return hasInput() || (fd >= 0 && refill(start)); }
+    char nextChar() { return hasInput() ? text[position++] : (char) -1; }
 };
 
 #endif
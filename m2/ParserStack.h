@@ -0,0 +1,88 @@
+#ifndef PARSER_STACK_H
+#define PARSER_STACK_H
+
+#include <cstddef>
+#include <vector>
+
+// Pilha de estados do Sintatico em memória contígua. clear() mantém a
+// capacidade, de modo que um mesmo Sintatico não aloca de novo entre uma
+// análise e outra, e pop(n) descarta de uma vez os n símbolos de uma
+// redução. Opcionalmente guarda, paralela aos estados, uma pilha de valores
+// semânticos: cada símbolo na pilha leva um Value, e uma redução lê os
+// valores do seu lado direito com topValues.
+template <typename Value>
+class ParserStack
+{
+public:
+    ParserStack() : count(0), withValues(false) { }
+
+    //Liga ou desliga os valores dos símbolos que entrarem daqui em diante
+    void setValues(bool enabled)
+    {
+        withValues = enabled;
+        values.resize(enabled ? states.size() : 0);
+    }
+
+    bool hasValues() const { return withValues; }
+
+    //Esvazia sem liberar a memória
+    void clear() { count = 0; }
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+    int top() const { return states[count - 1]; }
+    int at(std::size_t i) const { return states[i]; }   //i = 0 é o fundo
+
+    void push(int state, const Value &value = Value())
+    {
+        if (count == states.size())
+            grow();
+
+        states[count] = state;
+        if (withValues)
+            values[count] = value;
+        count++;
+    }
+
+    void pop(std::size_t symbols) { count -= symbols; }
+
+    //Cópia dos símbolos da pilha, para voltar a ela com restore
+    struct Snapshot
+    {
+        std::vector<int> states;
+        std::vector<Value> values;
+    };
+
+    void save(Snapshot &snapshot) const
+    {
+        snapshot.states.assign(states.begin(), states.begin() + count);
+        snapshot.values.assign(values.begin(), values.begin() + (withValues ? count : 0));
+    }
+
+    void restore(const Snapshot &snapshot)
+    {
+        clear();
+        for (std::size_t i = 0; i < snapshot.states.size(); i++)
+            push(snapshot.states[i], i < snapshot.values.size() ? snapshot.values[i] : Value());
+    }
+
+    //Valores dos symbols símbolos do topo, do mais antigo para o mais recente
+    const Value *topValues(std::size_t symbols) const { return values.data() + count - symbols; }
+
+private:
+    //Os vetores têm sempre o tamanho da capacidade; count marca o topo
+    std::vector<int> states;
+    std::vector<Value> values;
+    std::size_t count;
+    bool withValues;
+
+    void grow()
+    {
+        std::size_t capacity = states.empty() ? 256 : states.size() * 2;
+        states.resize(capacity);
+        if (withValues)
+            values.resize(capacity);
+    }
+};
+
+#endif
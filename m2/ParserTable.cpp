@@ -0,0 +1,137 @@
+#include "ParserTable.h"
+#include "Tables.h"
+
+#include <algorithm>
+#include <map>
+
+ParserTable::ParserTable(const Tables &tables)
+  : terminals(tables.getTokenCount() - 1), validWords((terminals + 63) / 64)
+{
+    const int states = tables.getParserStates();
+    const int columns = tables.getParserSymbols() - terminals;
+
+    //ACTION: uma linha por estado, sem as entradas iguais à padrão
+    valid.assign(static_cast<std::size_t>(states) * validWords, 0);
+    actionDefaults.resize(states);
+    std::vector<Row> rows(states);
+    for (int s = 0; s < states; s++)
+    {
+        for (int t = 0; t < terminals; t++)
+        {
+            const int16_t *entry = tables.parserEntry(s, t);
+            if (entry[0] == ERROR)
+                continue;
+
+            valid[s * validWords + t / 64] |= uint64_t(1) << (t % 64);
+            rows[s].push_back(std::make_pair(t, pack(entry)));
+        }
+
+        uint16_t common = mostFrequent(rows[s], ERROR << VALUE_BITS);
+        actionDefaults[s] = common;
+        rows[s].erase(std::remove_if(rows[s].begin(), rows[s].end(),
+                                     [common](const std::pair<int, uint16_t> &e) { return e.second == common; }),
+                      rows[s].end());
+    }
+    place(actionSlots, actionBase, rows, terminals);
+
+    //GOTO: uma linha por símbolo, indexada pelo estado
+    gotoDefaults.resize(columns);
+    rows.assign(columns, Row());
+    for (int x = 0; x < columns; x++)
+    {
+        for (int s = 0; s < states; s++)
+        {
+            const int16_t *entry = tables.parserEntry(s, terminals + x);
+            if (entry[0] != ERROR)
+                rows[x].push_back(std::make_pair(s, static_cast<uint16_t>(entry[1])));
+        }
+
+        uint16_t common = mostFrequent(rows[x], 0);
+        gotoDefaults[x] = common;
+        rows[x].erase(std::remove_if(rows[x].begin(), rows[x].end(),
+                                     [common](const std::pair<int, uint16_t> &e) { return e.second == common; }),
+                      rows[x].end());
+    }
+    place(gotoSlots, gotoBase, rows, states);
+
+    productions.resize(tables.getProductionCount());
+    for (int p = 0; p < tables.getProductionCount(); p++)
+    {
+        productions[p].symbol = static_cast<int16_t>(tables.production(p)[0] - 1);
+        productions[p].length = tables.production(p)[1];
+    }
+}
+
+uint16_t ParserTable::pack(const int16_t *entry)
+{
+    return static_cast<uint16_t>(entry[0] << VALUE_BITS | (entry[1] & VALUE_MASK));
+}
+
+//A entrada mais frequente da linha (a menor, no empate)
+uint16_t ParserTable::mostFrequent(const Row &row, uint16_t empty)
+{
+    std::map<uint16_t, int> counts;
+    for (std::size_t i = 0; i < row.size(); i++)
+        counts[row[i].second]++;
+
+    uint16_t common = empty;
+    int best = 0;
+    for (std::map<uint16_t, int>::const_iterator it = counts.begin(); it != counts.end(); ++it)
+    {
+        if (it->second > best)
+        {
+            common = it->first;
+            best = it->second;
+        }
+    }
+    return common;
+}
+
+//Encaixa as linhas, das mais cheias para as mais vazias, na primeira base
+//em que todas as suas entradas caem em posições livres
+void ParserTable::place(std::vector<Slot> &slots, std::vector<int32_t> &base, std::vector<Row> &rows, int width)
+{
+    std::vector<int> order(rows.size());
+    for (std::size_t i = 0; i < order.size(); i++)
+        order[i] = static_cast<int>(i);
+    std::stable_sort(order.begin(), order.end(),
+                     [&rows](int a, int b) { return rows[a].size() > rows[b].size(); });
+
+    Slot empty = { EMPTY, 0 };
+    slots.assign(width, empty);
+    base.assign(rows.size(), 0);
+
+    for (std::size_t k = 0; k < order.size() && ! rows[order[k]].empty(); k++)
+    {
+        const Row &row = rows[order[k]];
+
+        std::size_t at = 0;
+        for (;; at++)
+        {
+            std::size_t i = 0;
+            while (i < row.size() && (at + row[i].first >= slots.size() || slots[at + row[i].first].check == EMPTY))
+                i++;
+            if (i == row.size())
+                break;
+        }
+
+        if (slots.size() < at + width)
+            slots.resize(at + width, empty);
+
+        for (std::size_t i = 0; i < row.size(); i++)
+        {
+            slots[at + row[i].first].check = static_cast<uint16_t>(order[k]);
+            slots[at + row[i].first].entry = row[i].second;
+        }
+        base[order[k]] = static_cast<int32_t>(at);
+    }
+}
+
+std::size_t ParserTable::sizeInBytes() const
+{
+    return valid.size() * sizeof(uint64_t)
+         + (actionDefaults.size() + gotoDefaults.size()) * sizeof(uint16_t)
+         + (actionBase.size() + gotoBase.size()) * sizeof(int32_t)
+         + (actionSlots.size() + gotoSlots.size()) * sizeof(Slot)
+         + productions.size() * sizeof(Production);
+}
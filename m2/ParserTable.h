@@ -0,0 +1,123 @@
+#ifndef PARSER_TABLE_H
+#define PARSER_TABLE_H
+
+#include "Constants.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+class Tables;
+
+// Forma compacta da tabela do parser, montada uma única vez por Tables
+// (Tables::getParser). A tabela original tem um par (comando, valor) para
+// cada estado e símbolo, quase todos ERROR; aqui as ações dos terminais
+// (ACTION) e os desvios dos não-terminais e ações semânticas (GOTO) ficam
+// separados, e cada entrada cabe em 16 bits: o comando nos 3 bits de cima e
+// o valor nos VALUE_BITS de baixo.
+//
+// As duas partes são vetores compartilhados (comb vectors): a linha de cada
+// estado (ou coluna, no GOTO) é encaixada onde suas entradas caem em posições
+// livres, e check diz a quem cada posição pertence. No ACTION só entram as
+// entradas diferentes da padrão do estado (a mais frequente, em geral uma
+// redução); um conjunto de bits com os terminais válidos separa o "padrão"
+// do erro, que assim continua sendo detectado no mesmo estado de antes. No
+// GOTO a padrão é o destino mais frequente de cada símbolo: o parser nunca
+// consulta um desvio indefinido.
+class ParserTable
+{
+public:
+    static const int VALUE_BITS = 13;
+    static const int VALUE_MASK = (1 << VALUE_BITS) - 1;
+
+    explicit ParserTable(const Tables &tables);
+
+    static int command(int entry) { return entry >> VALUE_BITS; }
+    static int value(int entry) { return entry & VALUE_MASK; }
+
+    //Entrada do terminal de índice symbol (o id do token menos 1)
+    int action(int state, int symbol) const
+    {
+        if (((valid[state * validWords + (symbol >> 6)] >> (symbol & 63)) & 1) == 0)
+            return ERROR << VALUE_BITS;
+
+        const Slot &slot = actionSlots[actionBase[state] + symbol];
+        return slot.check == state ? slot.entry : actionDefaults[state];
+    }
+
+    //Estado de destino para um não-terminal ou ação semântica (índice de coluna)
+    int goTo(int state, int symbol) const
+    {
+        int column = symbol - terminals;
+        const Slot &slot = gotoSlots[gotoBase[column] + state];
+        return slot.check == column ? slot.entry : gotoDefaults[column];
+    }
+
+    // Reduções em cadeia. Depois de um desvio para state (com below logo
+    // abaixo na pilha), o terminal symbol costuma provocar uma sequência de
+    // reduções que só mexem nos estados acima de below: as de um símbolo
+    // (<expr_unaria> para <expr_term>...) e, na gramática fatorada do GALS,
+    // os pares de uma redução vazia (o resto de <expr_arit>, por exemplo)
+    // seguida de uma de dois símbolos. reduceChain as faz numa pilha local,
+    // sem passar pelo parser, e para na primeira entrada que não seja uma
+    // redução assim (uma ação semântica, um shift, um erro, ou uma redução
+    // que desceria abaixo de below). Os estados que ficaram acima de below
+    // vão para states, e entry recebe a entrada em que a cadeia parou, a do
+    // novo topo: o parser segue dali como se tivesse feito cada redução.
+    int reduceChain(int below, int state, int symbol, int *states, int capacity, int &entry) const
+    {
+        int depth = 1;
+        states[0] = state;
+        for (;;)
+        {
+            entry = action(states[depth - 1], symbol);
+            if (command(entry) != REDUCE)
+                return depth;
+
+            const Production &production = productions[value(entry)];
+            if (production.length > depth || (production.length == 0 && depth == capacity))
+                return depth;
+
+            depth -= production.length;
+            int from = depth > 0 ? states[depth - 1] : below;
+            states[depth++] = goTo(from, production.symbol);
+        }
+    }
+
+    std::size_t sizeInBytes() const;
+
+private:
+    static const uint16_t EMPTY = 0xFFFF;
+
+    struct Slot
+    {
+        uint16_t check;
+        uint16_t entry;
+    };
+
+    struct Production
+    {
+        int16_t symbol;     //Coluna do lado esquerdo
+        int16_t length;
+    };
+
+    typedef std::vector<std::pair<int, uint16_t> > Row;
+
+    static uint16_t pack(const int16_t *entry);
+    static uint16_t mostFrequent(const Row &row, uint16_t empty);
+    static void place(std::vector<Slot> &slots, std::vector<int32_t> &base, std::vector<Row> &rows, int width);
+
+    int terminals;
+    int validWords;
+    std::vector<uint64_t> valid;
+    std::vector<uint16_t> actionDefaults;
+    std::vector<int32_t> actionBase;
+    std::vector<Slot> actionSlots;
+    std::vector<uint16_t> gotoDefaults;
+    std::vector<int32_t> gotoBase;
+    std::vector<Slot> gotoSlots;
+    std::vector<Production> productions;
+};
+
+#endif
@@ -0,0 +1,195 @@
+#include "ScannerTable.h"
+#include "Tables.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SCANNER_SSE2
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SCANNER_AVX2
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+ScannerTable::ScannerTable(const Tables &tables) : tables(tables), classCount(0), classShift(0)
+{
+    const int statesCount = tables.getStatesCount();
+
+    //Agrupa as colunas iguais: cada classe guarda o byte que a representa.
+    //O '\0' fica sozinho na classe 0, a da sentinela
+    int representative[256];
+    representative[classCount++] = 0;
+    byteClass[0] = 0;
+
+    for (int c = 1; c < 256; c++)
+    {
+        int cls = 1;
+        for (; cls < classCount; cls++)
+        {
+            int r = representative[cls];
+            int s = 0;
+            while (s < statesCount && tables.nextState(s, c) == tables.nextState(s, r))
+                s++;
+            if (s == statesCount)
+                break;
+        }
+
+        if (cls == classCount)
+            representative[classCount++] = c;
+
+        byteClass[c] = static_cast<uint8_t>(cls);
+    }
+
+    while ((1 << classShift) < classCount)
+        classShift++;
+
+    loops.resize(statesCount);
+    for (int s = 0; s < statesCount; s++)
+        buildLoop(s);
+
+    stateEntries.resize(statesCount);
+    for (int s = 0; s < statesCount; s++)
+        stateEntries[s] = entry(s);
+
+    transitions.assign(statesCount << classShift, -1);
+    nulTransitions.resize(statesCount);
+    for (int s = 0; s < statesCount; s++)
+    {
+        transitions[s << classShift] = SENTINEL;
+        for (int cls = 1; cls < classCount; cls++)
+            transitions[(s << classShift) + cls] = entry(tables.nextState(s, representative[cls]));
+
+        nulTransitions[s] = entry(tables.nextState(s, 0));
+    }
+}
+
+int16_t ScannerTable::entry(int state) const
+{
+    if (state < 0)
+        return -1;
+
+    int flags = 0;
+    if (tables.tokenForState(state) >= 0)
+        flags |= ACCEPT;
+    if (loops[state].count != 0)
+        flags |= LOOP;
+
+    return static_cast<int16_t>(state | flags);
+}
+
+//Conta as faixas de bytes que mantêm o estado (ou que saem dele, se stop)
+int ScannerTable::countRanges(int state, bool stop) const
+{
+    int count = 0;
+    bool inside = false;
+    for (int c = 0; c < 256; c++)
+    {
+        bool selected = (tables.nextState(state, c) == state) != stop;
+        if (selected && ! inside)
+            count++;
+        inside = selected;
+    }
+    return count;
+}
+
+//Descreve o laço do estado com o menor conjunto de faixas possível
+void ScannerTable::buildLoop(int state)
+{
+    Loop &loop = loops[state];
+    loop.count = 0;
+
+    int loopRanges = countRanges(state, false);
+    if (loopRanges == 0)
+        return;
+
+    loop.stop = countRanges(state, true) < loopRanges;
+    if (countRanges(state, loop.stop) > MAX_RANGES)
+        return;
+
+    int c = 0;
+    while (c < 256)
+    {
+        if ((tables.nextState(state, c) == state) == loop.stop)
+        {
+            c++;
+            continue;
+        }
+
+        int low = c;
+        while (c < 256 && (tables.nextState(state, c) == state) != loop.stop)
+            c++;
+
+        loop.low[loop.count] = static_cast<unsigned char>(low);
+        loop.high[loop.count] = static_cast<unsigned char>(c - 1);
+        loop.count++;
+    }
+}
+
+static inline int firstBit(unsigned mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+std::size_t ScannerTable::skipLongLoop(int state, const char *text, std::size_t pos, std::size_t size) const
+{
+    const Loop &loop = loops[state];
+
+#if defined(SCANNER_AVX2)
+    while (pos + 32 <= size)
+    {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(text + pos));
+        __m256i hit = _mm256_setzero_si256();
+        for (int i = 0; i < loop.count; i++)
+        {
+            __m256i low = _mm256_set1_epi8(static_cast<char>(loop.low[i]));
+            __m256i span = _mm256_set1_epi8(static_cast<char>(loop.high[i] - loop.low[i]));
+            __m256i d = _mm256_sub_epi8(bytes, low);
+            hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(_mm256_min_epu8(d, span), d));
+        }
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(hit));
+        if (! loop.stop)
+            mask = ~mask;
+        if (mask != 0)
+            return pos + firstBit(mask);
+        pos += 32;
+    }
+#endif
+#if defined(SCANNER_SSE2)
+    while (pos + 16 <= size)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + pos));
+        __m128i hit = _mm_setzero_si128();
+        for (int i = 0; i < loop.count; i++)
+        {
+            __m128i low = _mm_set1_epi8(static_cast<char>(loop.low[i]));
+            __m128i span = _mm_set1_epi8(static_cast<char>(loop.high[i] - loop.low[i]));
+            __m128i d = _mm_sub_epi8(bytes, low);
+            hit = _mm_or_si128(hit, _mm_cmpeq_epi8(_mm_min_epu8(d, span), d));
+        }
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+        if (! loop.stop)
+            mask = ~mask & 0xFFFF;
+        if (mask != 0)
+            return pos + firstBit(mask);
+        pos += 16;
+    }
+#endif
+    while (pos < size && nextState(static_cast<unsigned char>(text[pos]), state) == state)
+        pos++;
+
+    return pos;
+}
+
+std::size_t ScannerTable::sizeInBytes() const
+{
+    return sizeof(byteClass) + (transitions.size() + nulTransitions.size() + stateEntries.size()) * sizeof(int16_t)
+         + loops.size() * sizeof(Loop);
+}
@@ -0,0 +1,99 @@
+#ifndef SCANNER_TABLE_H
+#define SCANNER_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Tables;
+
+// Forma compacta da tabela do scanner, montada uma única vez por Tables
+// (Tables::getScanner). Colunas idênticas da tabela original (bytes que levam
+// sempre aos mesmos estados) formam uma classe de equivalência; a tabela de
+// transições fica com uma linha de 16 bits por estado, cada uma com largura
+// arredondada para potência de 2 (o índice é calculado com shift).
+//
+// Cada entrada traz, além do próximo estado, os bits ACCEPT (o estado tem
+// token) e LOOP (o estado tem laço que skipLoop sabe saltar), para que o
+// laço do Lexico decida tudo com uma leitura só. O byte '\0' tem classe
+// própria, com SENTINEL em todos os estados: assim o fim do texto (sempre
+// seguido de um '\0') não precisa ser testado a cada byte. Um '\0' no meio
+// do texto segue a transição de nulStep.
+class ScannerTable
+{
+public:
+    static const int STATE_MASK = 0x1FFF;
+    static const int ACCEPT = 0x2000;
+    static const int LOOP = 0x4000;
+    static const int SENTINEL = -2;
+
+    explicit ScannerTable(const Tables &tables);
+
+    //Entrada da tabela: -1 (erro), SENTINEL, ou estado | ACCEPT | LOOP
+    int step(unsigned char c, int state) const
+    {
+        return transitions[(state << classShift) + byteClass[c]];
+    }
+
+    int nulStep(int state) const { return nulTransitions[state]; }
+
+    //Transição exata da tabela original, sem os bits e sem sentinela
+    int nextState(unsigned char c, int state) const
+    {
+        int entry = c != 0 ? step(c, state) : nulStep(state);
+        return entry < 0 ? -1 : entry & STATE_MASK;
+    }
+
+    // Estados com laço em si mesmos (espaços, corpo de comentário ou de
+    // string, resto de identificador). skipLoop avança sobre todos os bytes
+    // que mantêm o estado: os primeiros um a um, o resto do trecho 16 ou 32
+    // por vez quando há SSE2/AVX2.
+    bool hasLoop(int state) const { return loops[state].count != 0; }
+
+    std::size_t skipLoop(int state, const char *text, std::size_t pos, std::size_t size) const
+    {
+        std::size_t limit = pos + SHORT_RUN < size ? pos + SHORT_RUN : size;
+        int self = stateEntries[state];
+        while (pos < limit)
+        {
+            if (step(static_cast<unsigned char>(text[pos]), state) != self)
+                return pos;
+            pos++;
+        }
+        return pos < size ? skipLongLoop(state, text, pos, size) : pos;
+    }
+
+    int getClassCount() const { return classCount; }
+    std::size_t sizeInBytes() const;
+
+private:
+    // Até MAX_RANGES faixas de bytes [low, high]. Se stop for verdadeiro as
+    // faixas são os bytes que saem do laço; senão, os que permanecem nele.
+    static const int MAX_RANGES = 6;
+    static const std::size_t SHORT_RUN = 8;
+
+    struct Loop
+    {
+        uint8_t count;
+        bool stop;
+        unsigned char low[MAX_RANGES];
+        unsigned char high[MAX_RANGES];
+    };
+
+    void buildLoop(int state);
+    int countRanges(int state, bool stop) const;
+    std::size_t skipLongLoop(int state, const char *text, std::size_t pos, std::size_t size) const;
+
+    const Tables &tables;
+    uint8_t byteClass[256];
+    int classCount;
+    int classShift;
+    std::vector<int16_t> transitions;
+    std::vector<int16_t> nulTransitions;
+    std::vector<int16_t> stateEntries;
+    std::vector<Loop> loops;
+
+    int16_t entry(int state) const;
+};
+
+#endif
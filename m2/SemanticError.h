@@ -9,7 +9,7 @@ class SemanticError : public AnalysisError
 {
 public:
 
-    SemanticError(const std::string &msg, int position = -1)
+    SemanticError(const std::string &msg, long long position = -1)
       : AnalysisError(msg, position) { }
 };
 
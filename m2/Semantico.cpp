@@ -6,14 +6,6 @@
 #include <algorithm>
 #include <string>
 
-// Guarda o último identificador visto (serve para vetor [ ] e para LHS de =)
-static std::string g_ultimoIdVisto;         // ex.: ao ler t_ID "v", guarda "v"
-static std::string g_ultimoIdAntesDaAtrib;  // candidato a LHS de '='
-
-static bool g_inParamList = false;
-static bool g_nextBraceIsFuncBody = false;
-static std::vector<Simbolo> g_paramBuffer;
-
 std::ostream& operator<<(std::ostream& os, const Simbolo& s) {
     os << "Tipo: " << s.tipo << " - Nome: " << s.nome
        << " - Usado: " << (s.usado ? "Sim" : "Não")
@@ -23,19 +15,26 @@ std::ostream& operator<<(std::ostream& os, const Simbolo& s) {
 
 // ----------------- helpers -----------------
 
+// Os símbolos são alterados por edit, que copia o bloco se uma cópia do
+// Semantico (ponto de retomada) ainda o divide; por isso só se altera o que
+// muda de fato
+
 static void marcarUsadoPorNome(
     const std::string& nome,
-    std::vector<std::vector<Simbolo>>& pilhaEscopos,
-    std::vector<Simbolo>& tabelaSimbolo
+    std::vector<SharedVector<Simbolo>>& pilhaEscopos,
+    SharedVector<Simbolo>& tabelaSimbolo
     ) {
     if (nome.empty()) return;
     for (auto& escopo : pilhaEscopos) {
-        for (auto& simbolo : escopo) {
-            if (simbolo.nome == nome) {
-                simbolo.usado = true;
-                for (auto& s : tabelaSimbolo)
-                    if (s.nome == nome && s.tipo == simbolo.tipo)
-                        s.usado = true;
+        for (size_t i = 0; i < escopo.size(); ++i) {
+            if (escopo[i].nome == nome) {
+                if (!escopo[i].usado) escopo.edit(i).usado = true;
+                const Simbolo& simbolo = escopo[i];
+                for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                    const Simbolo& s = tabelaSimbolo[j];
+                    if (!s.usado && s.nome == nome && s.tipo == simbolo.tipo)
+                        tabelaSimbolo.edit(j).usado = true;
+                }
                 return;
             }
         }
@@ -44,17 +43,20 @@ static void marcarUsadoPorNome(
 
 static void marcarInicializadoPorNome(
     const std::string& nome,
-    std::vector<std::vector<Simbolo>>& pilhaEscopos,
-    std::vector<Simbolo>& tabelaSimbolo
+    std::vector<SharedVector<Simbolo>>& pilhaEscopos,
+    SharedVector<Simbolo>& tabelaSimbolo
     ) {
     if (nome.empty()) return;
     for (auto it = pilhaEscopos.rbegin(); it != pilhaEscopos.rend(); ++it) {
-        for (auto& simbolo : *it) {
-            if (simbolo.nome == nome) {
-                simbolo.inicializado = true;
-                for (auto& s : tabelaSimbolo)
-                    if (s.nome == nome && s.tipo == simbolo.tipo)
-                        s.inicializado = true;
+        for (size_t i = 0; i < it->size(); ++i) {
+            if ((*it)[i].nome == nome) {
+                if (!(*it)[i].inicializado) it->edit(i).inicializado = true;
+                const Simbolo& simbolo = (*it)[i];
+                for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                    const Simbolo& s = tabelaSimbolo[j];
+                    if (!s.inicializado && s.nome == nome && s.tipo == simbolo.tipo)
+                        tabelaSimbolo.edit(j).inicializado = true;
+                }
                 return;
             }
         }
@@ -64,7 +66,7 @@ static void marcarInicializadoPorNome(
 // ----------------- Semantico -----------------
 
 void Semantico::declarar(const Token* tok) {
-    const std::string nome = tok->getLexeme();
+    const std::string nome(tok->getLexeme());
     if (nome.empty()) return;
 
     if (pilhaEscopos.empty())
@@ -88,28 +90,31 @@ void Semantico::declarar(const Token* tok) {
     tabelaSimbolo.push_back(Simbolo{ tipoAtual, nome, false, false });
 
     // Pode ser "int x = 5;" — guardamos o nome
-    g_ultimoIdVisto        = nome;
-    g_ultimoIdAntesDaAtrib = nome;
+    ultimoIdVisto        = nome;
+    ultimoIdAntesDaAtrib = nome;
 }
 
 void Semantico::usar(const Token* tok) {
-    const std::string nome = tok->getLexeme();
+    const std::string_view nome = tok->getLexeme();
     if (nome.empty()) return;
 
     bool encontrado = false;
     for (auto& escopo : pilhaEscopos) {
-        for (auto& simbolo : escopo) {
-            if (simbolo.nome == nome) {
+        for (size_t i = 0; i < escopo.size(); ++i) {
+            if (escopo[i].nome == nome) {
+                if (!escopo[i].usado) escopo.edit(i).usado = true;
+                const Simbolo& simbolo = escopo[i];
                 if (!simbolo.inicializado) {
                     std::cerr << "Aviso: Símbolo '" << nome
                               << "' (tipo: " << simbolo.tipo
                               << ") usado sem inicialização na posição "
                               << tok->getPosition() << std::endl;
                 }
-                simbolo.usado = true;
-                for (auto& s : tabelaSimbolo)
-                    if (s.nome == nome && s.tipo == simbolo.tipo)
-                        s.usado = true;
+                for (size_t j = 0; j < tabelaSimbolo.size(); ++j) {
+                    const Simbolo& s = tabelaSimbolo[j];
+                    if (!s.usado && s.nome == nome && s.tipo == simbolo.tipo)
+                        tabelaSimbolo.edit(j).usado = true;
+                }
                 encontrado = true;
                 break;
             }
@@ -118,7 +123,7 @@ void Semantico::usar(const Token* tok) {
     }
 
     if (!encontrado) {
-        throw SemanticError(std::string("Símbolo '") + nome + "' não declarado neste escopo",
+        throw SemanticError(std::string("Símbolo '") + std::string(nome) + "' não declarado neste escopo",
                             tok->getPosition());
     }
 }
@@ -171,17 +176,17 @@ void Semantico::executeAction(int /*action*/, const Token* token) {
     // "(" e ")" (lista de parâmetros)
     case t_DELIM_PARENTESESE:
         if (modoDeclaracao) {
-            g_inParamList = true;
-            g_nextBraceIsFuncBody = false;
-            g_paramBuffer.clear();
+            inParamList = true;
+            nextBraceIsFuncBody = false;
+            paramBuffer.clear();
             lastDeclaredPos = -1;
         }
         break;
 
     case t_DELIM_PARENTESESD:
-        if (g_inParamList) {
-            g_inParamList = false;
-            g_nextBraceIsFuncBody = true;
+        if (inParamList) {
+            inParamList = false;
+            nextBraceIsFuncBody = true;
             endDeclaracao();
         } else {
             endDeclaracao();
@@ -190,20 +195,20 @@ void Semantico::executeAction(int /*action*/, const Token* token) {
 
     // IDENTIFICADOR
     case t_ID:
-        if (g_inParamList) {
+        if (inParamList) {
             if (tipoAtual.empty())
                 throw SemanticError("Parâmetro sem tipo declarado", token->getPosition());
 
             if (lastDeclaredPos != token->getPosition()) {
-                const std::string nomeParam = token->getLexeme();
+                const std::string nomeParam(token->getLexeme());
 
-                bool dup = std::any_of(g_paramBuffer.begin(), g_paramBuffer.end(),
+                bool dup = std::any_of(paramBuffer.begin(), paramBuffer.end(),
                                        [&](const Simbolo& s){ return s.nome == nomeParam; });
                 if (dup)
                     throw SemanticError(std::string("Parâmetro '") + nomeParam + "' duplicado",
                                         token->getPosition());
 
-                g_paramBuffer.push_back(Simbolo{ tipoAtual, nomeParam, false, false });
+                paramBuffer.push_back(Simbolo{ tipoAtual, nomeParam, false, false });
                 tabelaSimbolo.push_back(Simbolo{ tipoAtual, nomeParam, false, false });
                 lastDeclaredPos = token->getPosition();
             }
@@ -215,55 +220,55 @@ void Semantico::executeAction(int /*action*/, const Token* token) {
             }
         } else {
             usar(token);                               // uso do ID
-            g_ultimoIdVisto        = token->getLexeme(); // para '[' e '='
-            g_ultimoIdAntesDaAtrib = g_ultimoIdVisto;    // candidato a LHS
+            ultimoIdVisto        = token->getLexeme(); // para '[' e '='
+            ultimoIdAntesDaAtrib = ultimoIdVisto;    // candidato a LHS
         }
         break;
 
     // VÍRGULA: permite novo ID em declarações/params
     case t_DELIM_VIRGULA:
-        if (modoDeclaracao || g_inParamList)
+        if (modoDeclaracao || inParamList)
             lastDeclaredPos = -1;
         break;
 
     // FIM DE DECLARAÇÃO
     case t_DELIM_PONTOVIRGULA:
         endDeclaracao();
-        g_ultimoIdVisto.clear();
-        g_ultimoIdAntesDaAtrib.clear();
+        ultimoIdVisto.clear();
+        ultimoIdAntesDaAtrib.clear();
         break;
 
     // ABRE ESCOPO
     case t_DELIM_CHAVEE:
         abrirEscopo();
-        if (g_nextBraceIsFuncBody) {
+        if (nextBraceIsFuncBody) {
             auto& escopoAtual = pilhaEscopos.back();
-            for (const auto& p : g_paramBuffer) {
+            for (const auto& p : paramBuffer) {
                 bool dup = std::any_of(escopoAtual.begin(), escopoAtual.end(),
                                        [&](const Simbolo& s){ return s.nome == p.nome; });
                 if (!dup)
                     escopoAtual.push_back(Simbolo{ p.tipo, p.nome, false, false });
             }
-            g_paramBuffer.clear();
-            g_nextBraceIsFuncBody = false;
+            paramBuffer.clear();
+            nextBraceIsFuncBody = false;
         }
         break;
 
     // FECHA ESCOPO
     case t_DELIM_CHAVED:
         fecharEscopo();
-        g_ultimoIdVisto.clear();
-        g_ultimoIdAntesDaAtrib.clear();
+        ultimoIdVisto.clear();
+        ultimoIdAntesDaAtrib.clear();
         break;
 
     // '='  -> marca LHS como inicializado
     case t_OPR_ATRIB:
-        marcarInicializadoPorNome(g_ultimoIdAntesDaAtrib, pilhaEscopos, tabelaSimbolo);
+        marcarInicializadoPorNome(ultimoIdAntesDaAtrib, pilhaEscopos, tabelaSimbolo);
         break;
 
     // '['  -> uso de vetor: marca o último ID visto como "usado"
     case t_DELIM_COLCHETESE:   // definido no seu Constants.h
-        marcarUsadoPorNome(g_ultimoIdVisto, pilhaEscopos, tabelaSimbolo);
+        marcarUsadoPorNome(ultimoIdVisto, pilhaEscopos, tabelaSimbolo);
         break;
 
     default:
@@ -3,9 +3,11 @@
 
 #include "Token.h"
 #include "SemanticError.h"
+#include "SharedVector.h"
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <algorithm>
 
@@ -23,10 +25,22 @@ class Semantico {
 private:
     bool        modoDeclaracao = false;
     std::string tipoAtual;
-    int         lastDeclaredPos = -1;
+    long long   lastDeclaredPos = -1;
     bool        esperandoAtribuicao = false; // Novo: indica que estamos após '=' em uma declaração
 
-    std::vector<std::vector<Simbolo>> pilhaEscopos;
+    // Guarda o último identificador visto (serve para vetor [ ] e para LHS
+    // de =). No objeto, para que a cópia de um ponto de retomada do
+    // Sintatico leve todo o estado
+    std::string ultimoIdVisto;          // ex.: ao ler t_ID "v", guarda "v"
+    std::string ultimoIdAntesDaAtrib;   // candidato a LHS de '='
+
+    bool inParamList = false;
+    bool nextBraceIsFuncBody = false;
+    std::vector<Simbolo> paramBuffer;
+
+    // Escopos e tabela em blocos compartilhados entre as cópias do Semantico
+    // (ver SharedVector)
+    std::vector<SharedVector<Simbolo>> pilhaEscopos;
 
     bool existe(const std::string& nome) const {
         for (auto it = pilhaEscopos.rbegin(); it != pilhaEscopos.rend(); ++it) {
@@ -41,7 +55,7 @@ private:
 
     void declarar(const Token* tok);
     void usar(const Token* tok);
-    void beginDeclaracao(const std::string& tipo) {
+    void beginDeclaracao(std::string_view tipo) {
         modoDeclaracao = true;
         tipoAtual = tipo;
         lastDeclaredPos = -1;
@@ -54,7 +68,7 @@ private:
     }
 
 public:
-    std::vector<Simbolo> tabelaSimbolo;
+    SharedVector<Simbolo> tabelaSimbolo;
 
     void executeAction(int action, const Token* token);
     void abrirEscopo() { pilhaEscopos.push_back({}); }
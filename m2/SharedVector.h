@@ -0,0 +1,113 @@
+#ifndef SHARED_VECTOR_H
+#define SHARED_VECTOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// Vetor em blocos de BLOCK elementos compartilhados entre as cópias: copiar
+// um SharedVector copia só os ponteiros dos blocos, e um bloco só é
+// duplicado quando uma das cópias que o dividem o altera (copy-on-write).
+// Um ponto de retomada do Sintatico guarda uma cópia do Semantico; com a
+// tabela de símbolos, os escopos e as mensagens guardados assim, o custo da
+// cópia deixa de crescer com o texto já lido, e a parte que não muda depois
+// dela (quase tudo) fica em memória uma vez só.
+//
+// A leitura é só const. Um elemento é alterado por edit(i), que antes passa
+// o bloco dele para esta cópia, se ele for compartilhado.
+template <typename T, std::size_t BLOCK = 64>
+class SharedVector
+{
+public:
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        const_iterator() : vector(0), index(0) { }
+        const_iterator(const SharedVector *vector, std::size_t index) : vector(vector), index(index) { }
+
+        reference operator*() const { return (*vector)[index]; }
+        pointer operator->() const { return &(*vector)[index]; }
+        const_iterator &operator++() { index++; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; index++; return old; }
+        bool operator==(const const_iterator &other) const { return index == other.index; }
+        bool operator!=(const const_iterator &other) const { return index != other.index; }
+
+    private:
+        const SharedVector *vector;
+        std::size_t index;
+    };
+
+    SharedVector() : count(0) { }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    const T &operator[](std::size_t i) const { return (*blocks[i / BLOCK])[i % BLOCK]; }
+    const T &at(std::size_t i) const
+    {
+        if (i >= count)
+            throw std::out_of_range("SharedVector::at");
+        return (*this)[i];
+    }
+    const T &back() const { return (*this)[count - 1]; }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, count); }
+
+    T &edit(std::size_t i) { return own(i / BLOCK)[i % BLOCK]; }
+
+    void push_back(const T &value)
+    {
+        if (count % BLOCK == 0)
+        {
+            blocks.push_back(std::make_shared<Block>());
+            blocks.back()->reserve(BLOCK);
+        }
+        own(count / BLOCK).push_back(value);
+        count++;
+    }
+
+    void pop_back()
+    {
+        count--;
+        if (count % BLOCK == 0)
+            blocks.pop_back();
+        else
+            own(count / BLOCK).pop_back();
+    }
+
+    void clear()
+    {
+        blocks.clear();
+        count = 0;
+    }
+
+private:
+    typedef std::vector<T> Block;
+
+    std::vector<std::shared_ptr<Block> > blocks;
+    std::size_t count;
+
+    //O bloco b desta cópia, duplicado antes se outra cópia também o usa
+    Block &own(std::size_t b)
+    {
+        if (blocks[b].use_count() > 1)
+        {
+            std::shared_ptr<Block> copy = std::make_shared<Block>();
+            copy->reserve(BLOCK);
+            copy->assign(blocks[b]->begin(), blocks[b]->end());
+            blocks[b] = copy;
+        }
+        return *blocks[b];
+    }
+};
+
+#endif
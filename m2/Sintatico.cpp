@@ -1,79 +1,639 @@
 #include "Sintatico.h"
+#include "TaskPool.h"
+
+#include <memory>
 
 void Sintatico::parse(Lexico *scanner, Semantico *semanticAnalyser)
 {
     this->scanner = scanner;
+    this->buffer = 0;
+    this->pipe = 0;
     this->semanticAnalyser = semanticAnalyser;
 
-    //Limpa a pilha
-    while (! stack.empty())
-        stack.pop();
+    run();
+}
+
+void Sintatico::parse(const TokenBuffer &tokens, Semantico *semanticAnalyser)
+{
+    this->scanner = 0;
+    this->buffer = &tokens;
+    this->bufferPos = 0;
+    this->bufferEnd = tokens.size();
+    this->pipe = 0;
+    this->semanticAnalyser = semanticAnalyser;
+
+    run();
+}
+
+void Sintatico::parseParallel(const TokenBuffer &tokens, Semantico *semanticAnalyser, unsigned threads)
+{
+    threads = TaskPool::threadsFor(threads);
+
+    std::vector<std::size_t> starts;
+    if (threads > 1 && ! reduceHandler && maxErrors == 1)
+        findRegions(tokens, starts);
+
+    if (starts.size() < 2)
+    {
+        parse(tokens, semanticAnalyser);
+        return;
+    }
+
+    std::size_t count = starts.size();
+    starts.push_back(tokens.size());
+
+    //Um Sintatico por thread, criado na primeira região que ela pegar
+    std::vector<std::unique_ptr<Sintatico> > workers(threads);
+    std::vector<std::vector<DeferredAction> > actions(count);
+    std::vector<char> accepted(count, 0);
+
+    TaskPool::run(count, threads, [&](std::size_t k, unsigned w)
+    {
+        if (! workers[w])
+            workers[w].reset(new Sintatico(*tables));
+        accepted[k] = workers[w]->parseRegion(tokens, starts[k], starts[k + 1], actions[k]);
+    });
+
+    for (std::size_t k = 0; k < count; k++)
+    {
+        if (! accepted[k])
+        {
+            parse(tokens, semanticAnalyser);
+            return;
+        }
+    }
+
+    //As ações na ordem do texto, como o parse as executaria
+    Token last;
+    for (std::size_t k = 0; k < count; k++)
+    {
+        const std::vector<DeferredAction> &region = actions[k];
+        for (std::size_t i = 0; i < region.size(); i++)
+        {
+            if (region[i].token == NO_TOKEN)
+            {
+                semanticAnalyser->executeAction(region[i].action, 0);
+                continue;
+            }
+            last = tokens.token(region[i].token);
+            semanticAnalyser->executeAction(region[i].action, &last);
+        }
+    }
+}
+
+//Inícios das regiões de parseParallel: o primeiro token e os que vêm logo
+//depois do fim de um <top>, ao menos REGION_TOKENS tokens depois do início
+//anterior. As fronteiras são só prováveis; parseRegion confirma cada uma
+void Sintatico::findRegions(const TokenBuffer &tokens, std::vector<std::size_t> &starts) const
+{
+    starts.assign(1, 0);
+
+    std::size_t size = tokens.size();
+    long long braces = 0;
+    long long parens = 0;
+    bool body = false;          //O bloco aberto fora de chaves é corpo de função ou comando
+    bool pendingDo = false;     //Um do fora de chaves ainda sem o while do fim
+    TokenId previous = EPSILON;
+
+    for (std::size_t i = 0; i < size; i++)
+    {
+        TokenId id = tokens.getId(i);
+        bool end = false;
+
+        switch (id)
+        {
+            case t_DELIM_PARENTESESE:
+                parens++;
+                break;
+            case t_DELIM_PARENTESESD:
+                parens--;
+                break;
+            case t_DELIM_CHAVEE:
+                //Um inicializador ({1, 2}) ou o corpo de um struct termina no ';'
+                if (braces == 0)
+                    body = previous == t_DELIM_PARENTESESD || previous == t_KEY_ELSE ||
+                           previous == t_KEY_SENAO || previous == t_KEY_ENTAO || previous == t_KEY_DO;
+                braces++;
+                break;
+            case t_DELIM_CHAVED:
+                braces--;
+                end = braces == 0 && parens == 0 && body && ! pendingDo;
+                break;
+            case t_DELIM_PONTOVIRGULA:
+                end = braces == 0 && parens == 0;
+                if (end)
+                    pendingDo = false;
+                break;
+            case t_KEY_DO:
+                if (braces == 0 && parens == 0)
+                    pendingDo = true;
+                break;
+            default:
+                break;
+        }
+
+        //Chaves ou parênteses sem par: a entrada tem erro, e parse o acusa
+        if (braces < 0 || parens < 0)
+        {
+            starts.assign(1, 0);
+            return;
+        }
+
+        //Um else (ou outro token que não começa um <top>) continua o mesmo
+        if (end && i + 1 < size && i + 1 - starts.back() >= REGION_TOKENS &&
+            ParserTable::command(parser->action(programState, tokens.getId(i + 1) - 1)) != ERROR)
+            starts.push_back(i + 1);
+
+        previous = id;
+    }
+}
+
+//Analisa os tokens [begin, end) como uma sequência de <top> que vem depois
+//de um programa completo (ou no início da entrada), guardando as ações
+//semânticas em actions. Diz se a região foi aceita
+bool Sintatico::parseRegion(const TokenBuffer &tokens, std::size_t begin, std::size_t end, std::vector<DeferredAction> &actions)
+{
+    scanner = 0;
+    buffer = &tokens;
+    bufferPos = begin;
+    bufferEnd = end;
+    pipe = 0;
+    semanticAnalyser = 0;
+    deferred = &actions;
+    recording = false;
+    recovering = false;
+    errors.clear();
+
+    reset();
+    if (begin > 0)
+    {
+        stack.push(programState);
+        previousToken = tokens.token(begin - 1);
+    }
+
+    readToken();
+    try
+    {
+        while ( ! step() )
+            ;
+    }
+    catch (const SyntacticError &)
+    {
+        return false;
+    }
+    return true;
+}
+
+void Sintatico::parsePipelined(Lexico *scanner, Semantico *semanticAnalyser, std::size_t capacity)
+{
+    if (scanner->isStream())
+    {
+        parse(scanner, semanticAnalyser);
+        return;
+    }
+
+    //O destrutor de pipeline para a leitura e espera a thread, também quando a
+    //análise termina com exceção
+    TokenPipe pipeline(*scanner, capacity);
+
+    this->scanner = scanner;
+    this->buffer = 0;
+    this->pipe = &pipeline;
+    this->semanticAnalyser = semanticAnalyser;
+
+    run();
+}
+
+void Sintatico::setCheckpoints(bool enabled)
+{
+    checkpointing = enabled;
+    if (! enabled)
+        checkpoints.clear();
+}
+
+void Sintatico::reparse(Lexico *scanner, Semantico *semanticAnalyser, std::size_t changedFrom)
+{
+    std::size_t k = checkpoints.size();
+    while (k > 0 && checkpoints[k - 1].reach > static_cast<long long>(changedFrom))
+        k--;
+
+    if (k == 0 || ! checkpointing || scanner->isStream())
+    {
+        parse(scanner, semanticAnalyser);
+        return;
+    }
+
+    //Os pontos depois dele são refeitos conforme a análise passar por eles
+    checkpoints.erase(checkpoints.begin() + k, checkpoints.end());
+    const Checkpoint &from = checkpoints.back();
+
+    this->scanner = scanner;
+    this->buffer = 0;
+    this->pipe = 0;
+    this->semanticAnalyser = semanticAnalyser;
+    recording = true;
+    setSpacing();
+
+    stack.restore(from.stack);
+    shiftedTokens = from.shiftedTokens;
+    *semanticAnalyser = from.semantic;
+
+    //O lexema do último token fica numa cópia: o texto antigo pode não existir mais
+    resumedLexeme = from.lastLexeme;
+    previousToken = from.lastId != EPSILON ? Token(from.lastId, resumedLexeme, from.lastPosition) : Token();
+
+    //Os pontos só são guardados antes do primeiro erro
+    recovering = maxErrors != 1;
+    errors.clear();
+    reportFrom = 0;
+    recoveredAt = -1;
+
+    scanner->setPosition(static_cast<std::size_t>(from.resume));
+    readToken();
+
+    while ( ! step() )
+        ;
+
+    if (! errors.empty())
+        throwFirstError();
+}
+
+//No máximo MAX_CHECKPOINTS pontos por entrada, cada um uma cópia do Semantico
+void Sintatico::setSpacing()
+{
+    long long spacing = static_cast<long long>(scanner->getInputSize()) / MAX_CHECKPOINTS;
+    checkpointSpacing = spacing > CHECKPOINT_SPACING ? spacing : CHECKPOINT_SPACING;
+}
+
+//Guarda o estado atual como ponto de retomada, se o último ficou para trás
+//ao menos checkpointSpacing bytes
+void Sintatico::checkpoint()
+{
+    long long resume = 0;
+    if (previousToken.getId() != EPSILON)
+        resume = previousToken.getPosition() + previousToken.getLexeme().size();
+
+    if (! checkpoints.empty() && resume < checkpoints.back().resume + checkpointSpacing)
+        return;
+
+    checkpoints.emplace_back();
+    Checkpoint &point = checkpoints.back();
+    point.resume = resume;
+    point.reach = scanner->getReach();
+    stack.save(point.stack);
+    point.shiftedTokens = shiftedTokens;
+    point.lastId = previousToken.getId();
+    point.lastPosition = previousToken.getPosition();
+    point.lastLexeme = previousToken.getLexeme();
+    point.semantic = *semanticAnalyser;
+}
+
+void Sintatico::setReduceHandler(ReduceHandler handler)
+{
+    reduceHandler = handler;
+    stack.setValues(static_cast<bool>(reduceHandler));
+}
 
+void Sintatico::start(Semantico *semanticAnalyser)
+{
+    this->scanner = 0;
+    this->buffer = 0;
+    this->pipe = 0;
+    this->semanticAnalyser = semanticAnalyser;
+    recording = false;
+    recovering = false;
+    errors.clear();
+
+    reset();
+}
+
+void Sintatico::feed(const Token &token)
+{
+    //Reduções e ações semânticas até o token ser empilhado (um DOLLAR
+    //termina no ACCEPT, como em finish); um erro sai como exceção
+    currentToken = token;
+    uint32_t shifted = shiftedTokens;
+    while (shiftedTokens == shifted)
+        if (step())
+            return;
+}
+
+void Sintatico::finish()
+{
+    currentToken = endOfInput();
+    while ( ! step() )
+        ;
+}
+
+void Sintatico::reset()
+{
+    //Limpa a pilha
+    stack.clear();
     stack.push(0);
+    shiftedTokens = 0;
+
+    previousToken = Token();
+}
+
+void Sintatico::run()
+{
+    reset();
 
-    if (previousToken != 0 && previousToken != currentToken)
-        delete previousToken;
-    previousToken = 0;
+    recovering = maxErrors != 1;
+    errors.clear();
+    reportFrom = 0;
+    recoveredAt = -1;
 
-    if (currentToken != 0)
-        delete currentToken;
-    currentToken = scanner->nextToken();
+    //Pontos de retomada só com o Lexico lido aqui mesmo, na ordem
+    recording = checkpointing && scanner != 0 && buffer == 0 && pipe == 0 && ! scanner->isStream();
+    if (recording)
+    {
+        setSpacing();
+        checkpoints.clear();
+        checkpoint();
+    }
+
+    readToken();
+
+#if defined(PARSER_DIRECT)
+    //O mesmo autômato em código gerado (DirectParser.cpp) a partir das
+    //tabelas compiladas. Os valores do tratador e os pontos de retomada só
+    //existem no laço de tabela
+    if (direct && ! reduceHandler && ! recording && ! recovering)
+    {
+        runDirect();
+        return;
+    }
+#endif
 
     while ( ! step() )
         ;
+
+    if (! errors.empty())
+        throwFirstError();
 }
 
-bool Sintatico::step()
+void Sintatico::readToken()
 {
-    if (currentToken == 0) //Fim de Sentença
+    if (buffer != 0)
+    {
+        if (bufferPos < bufferEnd)
+        {
+            currentToken = buffer->token(bufferPos++);
+            return;
+        }
+    }
+    else if (recovering)
     {
-        int pos = 0;
-        if (previousToken != 0)
-            pos = previousToken->getPosition() + previousToken->getLexeme().size();
+        if (readRecovering())
+            return;
+    }
+    else if (pipe != 0)
+    {
+        if (pipe->next(currentToken))
+            return;
+    }
+    else if (scanner == 0)
+    {
+        //Modo push: o próximo token vem em feed ou finish
+        return;
+    }
+    else if (scanner->nextToken(currentToken))
+        return;
+
+    currentToken = endOfInput();
+}
 
-        currentToken = new Token(DOLLAR, "$", pos);
+//Lê o próximo token guardando os erros léxicos. O Lexico lança o erro já
+//depois do trecho que não reconheceu, e a leitura segue dali; com a thread
+//de leitura, que para no erro, não há como continuar
+bool Sintatico::readRecovering()
+{
+    for (;;)
+    {
+        try
+        {
+            return pipe != 0 ? pipe->next(currentToken) : scanner->nextToken(currentToken);
+        }
+        catch (const LexicalError &e)
+        {
+            addError(true, e.getMessage(), e.getPosition());
+            if (pipe != 0)
+                throwFirstError();
+        }
     }
+}
 
-    int token = currentToken->getId();
-    int state = stack.top();
+void Sintatico::addError(bool lexical, const std::string &message, long long position)
+{
+    Error error = { lexical, AnalysisError(message, position) };
+    errors.push_back(error);
+
+    //Depois do primeiro erro o estado da análise não serve como ponto de retomada
+    recording = false;
 
-    const int* cmd = PARSER_TABLE[state][token-1];
+    if (maxErrors != 0 && errors.size() >= maxErrors)
+        throwFirstError();
+}
 
-    switch (cmd[0])
+void Sintatico::throwFirstError() const
+{
+    const AnalysisError &first = errors.front().error;
+    if (errors.front().lexical)
+        throw LexicalError(first.getMessage(), first.getPosition());
+    throw SyntacticError(first.getMessage(), first.getPosition());
+}
+
+//Modo pânico: descarta tokens até um de sincronização (';', '}' ou o fim) e
+//desempilha até um estado em que ele não seja erro
+void Sintatico::recover(int state)
+{
+    if (shiftedTokens >= reportFrom)
+        addError(false, tables->parserError(state), currentToken.getPosition());
+
+    //O erro caiu no mesmo token em que a última recuperação parou: ele não
+    //serviu, e é descartado
+    if (currentToken.getPosition() == recoveredAt)
+    {
+        if (currentToken.getId() == DOLLAR)
+            throwFirstError();
+        previousToken = currentToken;
+        readToken();
+    }
+
+    for (;;)
     {
-        case SHIFT:
+        int token = currentToken.getId();
+        while (token != DOLLAR && token != t_DELIM_PONTOVIRGULA && token != t_DELIM_CHAVED)
         {
-            stack.push(cmd[1]);
-            if (previousToken != 0)
-                delete previousToken;
             previousToken = currentToken;
-            currentToken = scanner->nextToken();
-            return false;
+            readToken();
+            token = currentToken.getId();
         }
-        case REDUCE:
-        {
-            const int* prod = PRODUCTIONS[cmd[1]];
 
-            for (int i=0; i<prod[1]; i++)
-                stack.pop();
+        std::size_t depth = stack.size();
+        while (depth > 0 && ParserTable::command(parser->action(stack.at(depth - 1), token-1)) == ERROR)
+            depth--;
 
-            int oldState = stack.top();
-            stack.push(PARSER_TABLE[oldState][prod[0]-1][1]);
-            return false;
+        if (depth > 0)
+        {
+            stack.pop(stack.size() - depth);
+            break;
         }
-        case ACTION:
+
+        //Nenhum estado da pilha aceita este token
+        if (token == DOLLAR)
+            throwFirstError();
+        previousToken = currentToken;
+        readToken();
+    }
+
+    recoveredAt = currentToken.getPosition();
+    reportFrom = shiftedTokens + RECOVERY_TOKENS;
+}
+
+//Fim de Sentença, logo depois do último token
+Token Sintatico::endOfInput() const
+{
+    long long pos = 0;
+    if (previousToken.getId() != EPSILON)
+        pos = previousToken.getPosition() + previousToken.getLexeme().size();
+
+    return Token(DOLLAR, "$", pos);
+}
+
+bool Sintatico::step()
+{
+    int token = currentToken.getId();
+    int state = stack.top();
+    int entry = parser->action(state, token-1);
+
+    //Reduções e ações semânticas não consomem o token: o passo só termina
+    //num shift (ou no fim), e a entrada seguinte já vem de pushChain
+    for (;;)
+    {
+        int value = ParserTable::value(entry);
+
+        switch (ParserTable::command(entry))
         {
-            int action = FIRST_SEMANTIC_ACTION + cmd[1] - 1;
-            stack.push(PARSER_TABLE[state][action][1]);
-            semanticAnalyser->executeAction(cmd[1], previousToken);
-            return false;
+            case SHIFT:
+            {
+                stack.push(value, shiftedTokens++);
+                previousToken = currentToken;
+                readToken();
+                return false;
+            }
+            case REDUCE:
+            {
+                const int16_t* prod = tables->production(value);
+
+                //Tabelas carregadas de arquivo podem não ser coerentes com a
+                //pilha: reduzir mais símbolos do que há nela é erro de sintaxe
+                if (! tables->isBuiltin() && stack.size() <= static_cast<std::size_t>(prod[1]))
+                    throw SyntacticError(tables->parserError(state), currentToken.getPosition());
+
+                uint32_t reduced = 0;
+                if (reduceHandler)
+                    reduced = reduceHandler(value, stack.topValues(prod[1]), prod[1]);
+
+                stack.pop(prod[1]);
+
+                int oldState = stack.top();
+                int next = parser->goTo(oldState, prod[0]-1);
+
+                if (reduceHandler)
+                {
+                    stack.push(next, reduced);
+                    if (recording && stack.size() == 2 && stack.top() == programState)
+                        checkpoint();
+                    return false;
+                }
+
+                //A cadeia pode ter reduzido next também: vale o estado no topo
+                entry = pushChain(oldState, next, token-1);
+                if (recording && stack.size() == 2 && stack.top() == programState)
+                    checkpoint();
+                break;
+            }
+            case ACTION:
+            {
+                int action = tables->getFirstSemanticAction() + value - 1;
+                int next = parser->goTo(state, action);
+                const Token *last = previousToken.getId() != EPSILON ? &previousToken : 0;
+
+                if (reduceHandler)
+                {
+                    stack.push(next);
+                    if (errors.empty())
+                        semanticAnalyser->executeAction(value, last);
+                    return false;
+                }
+
+                //Se a cadeia fechou um <top>, o ponto já inclui a ação
+                entry = pushChain(state, next, token-1);
+                if (deferred != 0)
+                    defer(value);
+                else if (errors.empty())
+                    semanticAnalyser->executeAction(value, last);
+                if (recording && stack.size() == 2 && stack.top() == programState)
+                    checkpoint();
+                break;
+            }
+            case ACCEPT:
+                return true;
+
+            case ERROR:
+                if (! recovering)
+                    throw SyntacticError(tables->parserError(state), currentToken.getPosition());
+                recover(state);
+                return false;
         }
-        case ACCEPT:
-            return true;
 
-        case ERROR:
-            throw SyntacticError(PARSER_ERROR[state], currentToken->getPosition());
+        state = stack.top();
+    }
+}
+
+//Guarda a ação de uma região de parseParallel. O último token lido é o
+//anterior ao atual no TokenBuffer, e o atual é o de bufferPos - 1 (ou
+//bufferPos, já no fim da região)
+void Sintatico::defer(int action)
+{
+    DeferredAction deferredAction = { action, NO_TOKEN };
+    if (previousToken.getId() != EPSILON)
+    {
+        std::size_t current = currentToken.getId() == DOLLAR ? bufferPos : bufferPos - 1;
+        deferredAction.token = static_cast<int32_t>(current - 1);
     }
-    return false;
+    deferred->push_back(deferredAction);
 }
 
+//Empilha o desvio já com as reduções em cadeia que o seguem (ParserTable::reduceChain)
+//e devolve a entrada do novo topo. Com um tratador elas passam uma a uma por
+//step, para que ele receba todas
+int Sintatico::pushChain(int below, int state, int symbol)
+{
+    //A cadeia só depende dos dois estados e do terminal: as de cada operando
+    //de uma expressão se repetem, e são resolvidas uma vez só
+    uint64_t key = static_cast<uint64_t>(below) << 32 | static_cast<uint64_t>(state) << 16 | static_cast<uint64_t>(symbol);
+    Chain &cached = chains[(key * 0x9E3779B97F4A7C15ull) >> (64 - CHAIN_CACHE_BITS)];
+    if (cached.key == key)
+    {
+        stack.push(cached.state);
+        return cached.entry;
+    }
+
+    int states[CHAIN_DEPTH];
+    int entry;
+    int depth = parser->reduceChain(below, state, symbol, states, CHAIN_DEPTH, entry);
+
+    for (int i = 0; i < depth; i++)
+        stack.push(states[i]);
+
+    if (depth == 1)
+    {
+        cached.key = key;
+        cached.state = static_cast<uint16_t>(states[0]);
+        cached.entry = static_cast<uint16_t>(entry);
+    }
+    return entry;
+}
@@ -2,34 +2,208 @@
 #define Sintatico_H
 
 #include "Constants.h"
+#include "Tables.h"
+#include "ParserTable.h"
+#include "ParserStack.h"
 #include "Token.h"
 #include "Lexico.h"
+#include "TokenBuffer.h"
+#include "TokenPipe.h"
 #include "Semantico.h"
 #include "SyntacticError.h"
 
-#include <stack>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
 
 class Sintatico
 {
 public:
-    Sintatico() : previousToken(0), currentToken(0) { }
-
-    ~Sintatico()
+    Sintatico(const Tables &tables = Tables::defaults())
+      : tables(&tables), parser(&tables.getParser()), scanner(0), buffer(0), bufferPos(0), bufferEnd(0), pipe(0), semanticAnalyser(0), shiftedTokens(0),
+        direct(tables.isBuiltin()), checkpointing(false), recording(false),
+        programState(tables.getParser().goTo(0, tables.production(0)[0] - 1)), checkpointSpacing(CHECKPOINT_SPACING),
+        maxErrors(1), recovering(false), reportFrom(0), recoveredAt(-1), deferred(0)
     {
-        if (previousToken != 0 && previousToken != currentToken) delete previousToken;
-        if (currentToken != 0)  delete currentToken;
+        for (int i = 0; i < (1 << CHAIN_CACHE_BITS); i++)
+            chains[i].key = NO_CHAIN;
     }
 
     void parse(Lexico *scanner, Semantico *semanticAnalyser);
 
+    // Analisa tokens já lidos por Lexico::tokenizeAll
+    void parse(const TokenBuffer &tokens, Semantico *semanticAnalyser);
+
+    // Como parse(tokens, ...), com as regiões da entrada analisadas ao mesmo
+    // tempo, em até threads threads (0: uma por núcleo; TaskPool). Um <top>
+    // só depende do estado em que a pilha tem só o desvio do símbolo
+    // inicial: cada região, uma sequência de <top> com ao menos
+    // REGION_TOKENS tokens, é analisada a partir dele. As fronteiras saem da
+    // profundidade de chaves e parênteses: um ';' fora deles, ou o '}' que
+    // fecha o corpo de uma função, de um if, de um laço, seguido de um token
+    // que pode começar um <top>. As ações semânticas de cada região são
+    // guardadas e executadas depois, região por região, na ordem do texto:
+    // o Semantico vê a mesma sequência de um parse comum, e a tabela de
+    // símbolos sai igual. Se alguma região não for aceita (uma fronteira
+    // errada, um erro de sintaxe), a entrada é analisada de novo por parse,
+    // que dá o resultado e o erro de sempre. Com um tratador de reduções ou
+    // recuperação de erros, e com uma região só, é o próprio parse.
+    static const std::size_t REGION_TOKENS = 1 << 14;
+    void parseParallel(const TokenBuffer &tokens, Semantico *semanticAnalyser, unsigned threads = 0);
+
+    // Como parse(scanner, ...), mas com o Lexico lendo numa outra thread
+    // (TokenPipe), até capacity tokens à frente do parser. Uma entrada em
+    // modo stream é lida no thread atual, como em parse.
+    void parsePipelined(Lexico *scanner, Semantico *semanticAnalyser,
+                        std::size_t capacity = TokenPipe::DEFAULT_CAPACITY);
+
+    // Modo push: os tokens chegam um a um, conforme a entrada é lida (por
+    // um pipe, um socket, um editor), e o estado do parser fica guardado
+    // entre as chamadas. start recomeça a análise; feed faz as reduções e
+    // ações semânticas que o token provoca e o empilha; finish trata o fim
+    // da entrada e termina a análise. Os erros saem de feed e finish como em
+    // parse, e depois de um deles só start recomeça. O lexema de cada token
+    // precisa continuar válido até o fim da chamada seguinte.
+    void start(Semantico *semanticAnalyser);
+    void feed(const Token &token);
+    void finish();
+
+    // Pontos de retomada para a reanálise depois de uma edição. Ligados,
+    // parse(scanner, ...) guarda o estado do início e o de fronteiras entre
+    // dois <top>: a pilha, onde a leitura recomeça, até onde o Lexico já
+    // examinou o texto e uma cópia do Semantico (escopos e tabela de
+    // símbolos). Uma fronteira é o momento em que a pilha volta a ter só o
+    // desvio do símbolo inicial: o que foi lido até ali já forma um programa
+    // completo. A cópia do Semantico deve ser barata (os do m2, T4 e Taryck
+    // dividem entre as cópias os blocos de SharedVector que não mudam); ainda
+    // assim ela copia um ponteiro por bloco, e por isso os pontos ficam a pelo
+    // menos CHECKPOINT_SPACING bytes um do outro e são no máximo
+    // MAX_CHECKPOINTS por entrada.
+    static const long long CHECKPOINT_SPACING = 4096;
+    static const long long MAX_CHECKPOINTS = 64;
+    void setCheckpoints(bool enabled);
+
+    // Analisa o texto novo de scanner (em memória), igual ao da última
+    // análise antes do byte changedFrom, a partir do último ponto cujo texto
+    // examinado termina antes da mudança. O resultado, inclusive o estado do
+    // Semantico e os erros, é o mesmo de um parse completo. Sem ponto válido,
+    // faz o parse completo.
+    void reparse(Lexico *scanner, Semantico *semanticAnalyser, std::size_t changedFrom);
+
+    // Recuperação de erros. Com max > 1 (0: sem limite), parse não para no
+    // primeiro erro: um erro léxico descarta o trecho que o DFA não
+    // reconheceu; um sintático descarta tokens até um ';', um '}' ou o fim e
+    // desempilha até um estado em que esse token não seja erro. Erros logo
+    // depois de uma recuperação, antes de RECOVERY_TOKENS tokens empilhados,
+    // costumam ser consequência dela e não são guardados. A partir do
+    // primeiro erro as ações semânticas deixam de ser executadas. Ao fim da
+    // entrada, ou ao chegar a max erros, parse lança o primeiro deles, e
+    // getErrors tem todos, na ordem do texto. O modo push e a leitura
+    // pipelined (em que o Lexico para no primeiro erro léxico) continuam
+    // parando no primeiro erro.
+    static const uint32_t RECOVERY_TOKENS = 3;
+    void setMaxErrors(std::size_t max) { maxErrors = max; }
+
+    struct Error
+    {
+        bool lexical;           //LexicalError ou SyntacticError
+        AnalysisError error;
+    };
+    const std::vector<Error> &getErrors() const { return errors; }
+
+    // Com um tratador definido, cada símbolo na pilha leva um valor: um
+    // token lido vale sua ordem na entrada (0, 1, ...), uma ação semântica
+    // vale 0 e um não-terminal vale o que o tratador devolver ao receber a
+    // produção reduzida e os valores do seu lado direito.
+    typedef std::function<uint32_t(int production, const uint32_t *values, int count)> ReduceHandler;
+    void setReduceHandler(ReduceHandler handler);
+
 private:
-    std::stack<int> stack;
-    Token *previousToken;
-    Token *currentToken;
+    const Tables *tables;
+    const ParserTable *parser;
+    ParserStack<uint32_t> stack;
+    ReduceHandler reduceHandler;
+    Token previousToken;
+    Token currentToken;
     Lexico *scanner;
+    const TokenBuffer *buffer;
+    std::size_t bufferPos;
+    std::size_t bufferEnd;
+    TokenPipe *pipe;
     Semantico *semanticAnalyser;
+    uint32_t shiftedTokens;
+    bool direct;
+    bool checkpointing;
+    bool recording;
+    int programState;
+    long long checkpointSpacing;
 
+    struct Checkpoint
+    {
+        long long resume;       //Fim do último token lido: a leitura recomeça aqui
+        long long reach;        //Texto examinado até aqui, inclusive o token seguinte
+        ParserStack<uint32_t>::Snapshot stack;
+        uint32_t shiftedTokens;
+        TokenId lastId;
+        long long lastPosition;
+        std::string lastLexeme;
+        Semantico semantic;
+    };
+    std::vector<Checkpoint> checkpoints;
+    std::string resumedLexeme;
+
+    std::size_t maxErrors;
+    bool recovering;
+    std::vector<Error> errors;
+    uint32_t reportFrom;        //Erros antes deste token empilhado são cascata
+    long long recoveredAt;      //Posição do token em que a última recuperação parou
+
+    //Ação semântica de uma região de parseParallel, com o índice do último
+    //token lido no TokenBuffer (NO_TOKEN antes do primeiro)
+    struct DeferredAction
+    {
+        int32_t action;
+        int32_t token;
+    };
+    static const int32_t NO_TOKEN = -1;
+    std::vector<DeferredAction> *deferred;
+
+    static const int CHAIN_DEPTH = 8;
+    static const int CHAIN_CACHE_BITS = 10;
+    static const uint64_t NO_CHAIN = ~uint64_t(0);
+
+    //Cadeias já resolvidas que terminam num só estado acima de below,
+    //indexadas por (below, state, symbol)
+    struct Chain
+    {
+        uint64_t key;
+        uint16_t state;
+        uint16_t entry;
+    };
+    Chain chains[1 << CHAIN_CACHE_BITS];
+
+    void reset();
+    void run();
+    void checkpoint();
+    void setSpacing();
     bool step();
+
+    //A mesma análise em código gerado por tools/gen_direct_parser.cpp
+    //(DirectParser.cpp), usada com PARSER_DIRECT e as tabelas embutidas
+    void runDirect();
+    int pushChain(int below, int state, int symbol);
+
+    void findRegions(const TokenBuffer &tokens, std::vector<std::size_t> &starts) const;
+    bool parseRegion(const TokenBuffer &tokens, std::size_t begin, std::size_t end, std::vector<DeferredAction> &actions);
+    void defer(int action);
+
+    void readToken();
+    bool readRecovering();
+    void recover(int state);
+    void addError(bool lexical, const std::string &message, long long position);
+    void throwFirstError() const;
+    Token endOfInput() const;
 };
 
 #endif
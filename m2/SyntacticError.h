@@ -9,7 +9,7 @@ class SyntacticError : public AnalysisError
 {
 public:
 
-    SyntacticError(const std::string &msg, int position = -1)
+    SyntacticError(const std::string &msg, long long position = -1)
       : AnalysisError(msg, position) { }
 };
 
@@ -0,0 +1,454 @@
+#include "Tables.h"
+#include "ScannerTable.h"
+#include "KeywordTable.h"
+#include "ParserTable.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    enum Section
+    {
+        S_SCANNER,          //statesCount * 256 int16: próximo estado ou -1
+        S_TOKEN_STATE,      //statesCount int16
+        S_SPECIAL_INDEXES,  //tokenCount + 1 int16
+        S_SPECIAL_VALUES,   //specialCases int16
+        S_SPECIAL_KEYS,     //specialCases uint32: posição no bloco de strings
+        S_SCANNER_ERRORS,   //statesCount uint32
+        S_PRODUCTIONS,      //productionCount * 2 int16
+        S_PARSER,           //parserStates * parserSymbols * 2 int16
+        S_PARSER_ERRORS,    //parserStates uint32
+        S_STRINGS,          //até o fim da imagem
+        SECTION_COUNT
+    };
+
+    const char MAGIC[8] = { 'G', 'A', 'L', 'S', 'T', 'B', 'L', 0 };
+    const uint32_t ORDER_MARK = 0x01020304;
+
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteOrder;
+        uint32_t size;
+        uint32_t checksum;      //FNV-1a de tudo o que vem depois do cabeçalho
+        int32_t statesCount;
+        int32_t tokenCount;
+        int32_t specialCases;
+        int32_t parserStates;
+        int32_t parserSymbols;
+        int32_t productionCount;
+        int32_t firstSemanticAction;
+        uint32_t keywordSeed;   //Semente do hash das palavras reservadas já testada
+        int32_t keywordBits;    //(negativo: hash do lexema inteiro; 0: sem semente)
+        uint32_t offsets[SECTION_COUNT];
+    };
+
+    uint32_t checksum(const char *data, std::size_t size)
+    {
+        uint32_t h = 0x811C9DC5u;
+        for (std::size_t i = 0; i < size; i++)
+            h = (h ^ static_cast<unsigned char>(data[i])) * 0x01000193u;
+        return h;
+    }
+
+    //Tamanho em bytes de cada seção, menos a de strings
+    uint64_t sectionSize(const Header &header, int section)
+    {
+        uint64_t states = static_cast<uint64_t>(header.statesCount);
+        switch (section)
+        {
+            case S_SCANNER:         return states * 256 * 2;
+            case S_TOKEN_STATE:     return states * 2;
+            case S_SPECIAL_INDEXES: return (static_cast<uint64_t>(header.tokenCount) + 1) * 2;
+            case S_SPECIAL_VALUES:  return static_cast<uint64_t>(header.specialCases) * 2;
+            case S_SPECIAL_KEYS:    return static_cast<uint64_t>(header.specialCases) * 4;
+            case S_SCANNER_ERRORS:  return states * 4;
+            case S_PRODUCTIONS:     return static_cast<uint64_t>(header.productionCount) * 2 * 2;
+            case S_PARSER:          return static_cast<uint64_t>(header.parserStates) * header.parserSymbols * 2 * 2;
+            case S_PARSER_ERRORS:   return static_cast<uint64_t>(header.parserStates) * 4;
+        }
+        return 0;
+    }
+
+    std::atomic<const Tables *> defaultTables(0);
+}
+
+Tables::Tables()
+{
+    reset();
+}
+
+Tables::~Tables()
+{
+}
+
+void Tables::reset()
+{
+    image = InputSource();
+    builtinTables = false;
+    statesCount = tokenCount = specialCases = 0;
+    parserStates = parserSymbols = productionCount = firstSemanticAction = 0;
+    keywordSeed = 0;
+    keywordBits = 0;
+    scanner = tokenState = specialIndexes = specialValues = productions = parser = 0;
+    specialKeys = scannerErrors = parserErrors = 0;
+    strings = 0;
+    scannerTable.reset();
+    keywordTable.reset();
+    parserTable.reset();
+}
+
+bool Tables::load(const std::string &path)
+{
+    InputSource file;
+    if (! file.mapFile(path))
+        return false;
+
+    return loadImage(std::move(file));
+}
+
+bool Tables::loadImage(InputSource image)
+{
+    reset();
+
+    //As seções são lidas no lugar: a imagem precisa estar alinhada
+    if (reinterpret_cast<std::uintptr_t>(image.data()) % alignof(uint32_t) != 0)
+        image = InputSource::own(std::string(image.data(), image.size()));
+
+    this->image = std::move(image);
+    if (! validate())
+    {
+        reset();
+        return false;
+    }
+
+    scannerTable.reset(new ScannerTable(*this));
+    keywordTable.reset(new KeywordTable(*this));
+    if (! keywordTable->isBuilt())
+    {
+        reset();
+        return false;
+    }
+    parserTable.reset(new ParserTable(*this));
+    return true;
+}
+
+//Confere cabeçalho, limites das seções e cada valor que o Lexico ou o
+//Sintatico usam como índice, e aponta os membros para as seções
+bool Tables::validate()
+{
+    const char *data = image.data();
+    std::size_t size = image.size();
+
+    if (size < sizeof(Header))
+        return false;
+
+    Header header;
+    std::memcpy(&header, data, sizeof header);
+
+    if (std::memcmp(header.magic, MAGIC, sizeof MAGIC) != 0 || header.version != VERSION
+        || header.byteOrder != ORDER_MARK || header.size != size)
+        return false;
+
+    if (checksum(data + sizeof header, size - sizeof header) != header.checksum)
+        return false;
+
+    if (header.statesCount < 1 || header.statesCount > ScannerTable::STATE_MASK + 1
+        || header.tokenCount < 2 || header.tokenCount > 32767
+        || header.specialCases < 0 || header.specialCases > 32767
+        || header.parserStates < 1 || header.parserStates > ParserTable::VALUE_MASK + 1
+        || header.parserSymbols < header.tokenCount - 1 || header.parserSymbols > ParserTable::VALUE_MASK + 1
+        || header.productionCount < 0 || header.productionCount > ParserTable::VALUE_MASK + 1
+        || header.firstSemanticAction < 1 || header.firstSemanticAction > header.parserSymbols + 1
+        || header.keywordBits < -24 || header.keywordBits > 24)
+        return false;
+
+    for (int s = 0; s < SECTION_COUNT; s++)
+    {
+        uint64_t end = static_cast<uint64_t>(header.offsets[s]) + sectionSize(header, s);
+        if (header.offsets[s] % 4 != 0 || header.offsets[s] < sizeof header || end > size)
+            return false;
+    }
+
+    std::size_t stringsSize = size - header.offsets[S_STRINGS];
+    if (stringsSize == 0 || data[size - 1] != '\0')
+        return false;
+
+    statesCount = header.statesCount;
+    tokenCount = header.tokenCount;
+    specialCases = header.specialCases;
+    parserStates = header.parserStates;
+    parserSymbols = header.parserSymbols;
+    productionCount = header.productionCount;
+    firstSemanticAction = header.firstSemanticAction;
+    keywordSeed = header.keywordSeed;
+    keywordBits = header.keywordBits;
+
+    scanner = reinterpret_cast<const int16_t *>(data + header.offsets[S_SCANNER]);
+    tokenState = reinterpret_cast<const int16_t *>(data + header.offsets[S_TOKEN_STATE]);
+    specialIndexes = reinterpret_cast<const int16_t *>(data + header.offsets[S_SPECIAL_INDEXES]);
+    specialValues = reinterpret_cast<const int16_t *>(data + header.offsets[S_SPECIAL_VALUES]);
+    specialKeys = reinterpret_cast<const uint32_t *>(data + header.offsets[S_SPECIAL_KEYS]);
+    scannerErrors = reinterpret_cast<const uint32_t *>(data + header.offsets[S_SCANNER_ERRORS]);
+    productions = reinterpret_cast<const int16_t *>(data + header.offsets[S_PRODUCTIONS]);
+    parser = reinterpret_cast<const int16_t *>(data + header.offsets[S_PARSER]);
+    parserErrors = reinterpret_cast<const uint32_t *>(data + header.offsets[S_PARSER_ERRORS]);
+    strings = data + header.offsets[S_STRINGS];
+
+    for (int i = 0; i < statesCount * 256; i++)
+        if (scanner[i] < -1 || scanner[i] >= statesCount)
+            return false;
+
+    for (int s = 0; s < statesCount; s++)
+        if (tokenState[s] < -2 || tokenState[s] >= tokenCount || scannerErrors[s] >= stringsSize)
+            return false;
+
+    if (specialIndexes[0] != 0 || specialIndexes[tokenCount] != specialCases)
+        return false;
+    for (int t = 0; t < tokenCount; t++)
+        if (specialIndexes[t] > specialIndexes[t + 1])
+            return false;
+
+    for (int i = 0; i < specialCases; i++)
+        if (specialValues[i] < 0 || specialValues[i] >= tokenCount || specialKeys[i] >= stringsSize
+            || strings[specialKeys[i]] == '\0')
+            return false;
+
+    //O hash de KeywordTable só vê o lexema: duas chaves iguais, mesmo em
+    //bases diferentes, cairiam sempre na mesma posição
+    std::vector<std::string_view> keys;
+    keys.reserve(specialCases);
+    for (int i = 0; i < specialCases; i++)
+        keys.push_back(strings + specialKeys[i]);
+    std::sort(keys.begin(), keys.end());
+    if (std::adjacent_find(keys.begin(), keys.end()) != keys.end())
+        return false;
+
+    for (int p = 0; p < productionCount; p++)
+        if (productions[p * 2] < 1 || productions[p * 2] > parserSymbols
+            || productions[p * 2 + 1] < 0 || productions[p * 2 + 1] > MAX_PRODUCTION_LENGTH)
+            return false;
+
+    for (int i = 0; i < parserStates * parserSymbols; i++)
+    {
+        int command = parser[i * 2];
+        int value = parser[i * 2 + 1];
+        switch (command)
+        {
+            case SHIFT:
+            case GO_TO:
+                if (value < 0 || value >= parserStates)
+                    return false;
+                break;
+            case REDUCE:
+                if (value < 0 || value >= productionCount)
+                    return false;
+                break;
+            case ACTION:
+                if (value < 1 || firstSemanticAction + value - 1 >= parserSymbols)
+                    return false;
+                break;
+            case ACCEPT:
+            case ERROR:
+                break;
+            default:
+                return false;
+        }
+    }
+
+    for (int s = 0; s < parserStates; s++)
+        if (parserErrors[s] >= stringsSize)
+            return false;
+
+    return true;
+}
+
+const Tables &Tables::defaults()
+{
+    const Tables *tables = defaultTables.load();
+    if (tables != 0)
+        return *tables;
+
+#if ! defined(TABLES_NO_BUILTIN)
+    return builtin();
+#else
+    throw std::logic_error("Tables::setDefaults não foi chamado");
+#endif
+}
+
+void Tables::setDefaults(const Tables &tables)
+{
+    defaultTables.store(&tables);
+}
+
+#if ! defined(TABLES_NO_BUILTIN)
+
+namespace
+{
+    //Monta a imagem seção por seção, com as strings repetidas guardadas uma vez só
+    class ImageWriter
+    {
+    public:
+        ImageWriter() : data(sizeof(Header), '\0') { }
+
+        uint32_t begin()
+        {
+            data.resize((data.size() + 3) & ~std::size_t(3), '\0');
+            return static_cast<uint32_t>(data.size());
+        }
+
+        void put16(int value)
+        {
+            int16_t v = static_cast<int16_t>(value);
+            data.append(reinterpret_cast<const char *>(&v), sizeof v);
+        }
+
+        void put32(uint32_t value)
+        {
+            data.append(reinterpret_cast<const char *>(&value), sizeof value);
+        }
+
+        void putString(const char *text)
+        {
+            std::map<std::string, uint32_t>::const_iterator found = stringOffsets.find(text);
+            if (found != stringOffsets.end())
+            {
+                put32(found->second);
+                return;
+            }
+
+            uint32_t offset = static_cast<uint32_t>(strings.size());
+            strings.append(text);
+            strings.push_back('\0');
+            stringOffsets[text] = offset;
+            put32(offset);
+        }
+
+        std::string finish(Header &header)
+        {
+            header.offsets[S_STRINGS] = begin();
+            data += strings;
+            header.size = static_cast<uint32_t>(data.size());
+            header.checksum = checksum(data.data() + sizeof header, data.size() - sizeof header);
+            std::memcpy(&data[0], &header, sizeof header);
+            return data;
+        }
+
+    private:
+        std::string data;
+        std::string strings;
+        std::map<std::string, uint32_t> stringOffsets;
+    };
+}
+
+std::string Tables::builtinImage()
+{
+    static_assert(STATES_COUNT <= ScannerTable::STATE_MASK + 1, "estados demais para a tabela compacta");
+    static_assert(sizeof PARSER_TABLE / sizeof PARSER_TABLE[0] <= ParserTable::VALUE_MASK + 1
+                  && sizeof PARSER_TABLE[0] / sizeof PARSER_TABLE[0][0] <= ParserTable::VALUE_MASK + 1,
+                  "estados ou símbolos demais para a tabela compacta do parser");
+
+    const int tokens = static_cast<int>(sizeof SPECIAL_CASES_INDEXES / sizeof SPECIAL_CASES_INDEXES[0]) - 1;
+    const int states = static_cast<int>(sizeof PARSER_TABLE / sizeof PARSER_TABLE[0]);
+    const int symbols = static_cast<int>(sizeof PARSER_TABLE[0] / sizeof PARSER_TABLE[0][0]);
+    const int productionCount = static_cast<int>(sizeof PRODUCTIONS / sizeof PRODUCTIONS[0]);
+
+    Header header;
+    std::memset(&header, 0, sizeof header);
+    std::memcpy(header.magic, MAGIC, sizeof MAGIC);
+    header.version = VERSION;
+    header.byteOrder = ORDER_MARK;
+    header.statesCount = STATES_COUNT;
+    header.tokenCount = tokens;
+    header.specialCases = SPECIAL_CASES;
+    header.parserStates = states;
+    header.parserSymbols = symbols;
+    header.productionCount = productionCount;
+    header.firstSemanticAction = FIRST_SEMANTIC_ACTION;
+
+    ImageWriter writer;
+
+    header.offsets[S_SCANNER] = writer.begin();
+    for (int s = 0; s < STATES_COUNT; s++)
+        for (int c = 0; c < 256; c++)
+            writer.put16(SCANNER_TABLE[s][c]);
+
+    header.offsets[S_TOKEN_STATE] = writer.begin();
+    for (int s = 0; s < STATES_COUNT; s++)
+        writer.put16(TOKEN_STATE[s]);
+
+    header.offsets[S_SPECIAL_INDEXES] = writer.begin();
+    for (int t = 0; t <= tokens; t++)
+        writer.put16(SPECIAL_CASES_INDEXES[t]);
+
+    header.offsets[S_SPECIAL_VALUES] = writer.begin();
+    for (int i = 0; i < SPECIAL_CASES; i++)
+        writer.put16(SPECIAL_CASES_VALUES[i]);
+
+    header.offsets[S_SPECIAL_KEYS] = writer.begin();
+    for (int i = 0; i < SPECIAL_CASES; i++)
+        writer.putString(SPECIAL_CASES_KEYS[i]);
+
+    header.offsets[S_SCANNER_ERRORS] = writer.begin();
+    for (int s = 0; s < STATES_COUNT; s++)
+        writer.putString(SCANNER_ERROR[s]);
+
+    header.offsets[S_PRODUCTIONS] = writer.begin();
+    for (int p = 0; p < productionCount; p++)
+    {
+        writer.put16(PRODUCTIONS[p][0]);
+        writer.put16(PRODUCTIONS[p][1]);
+    }
+
+    header.offsets[S_PARSER] = writer.begin();
+    for (int s = 0; s < states; s++)
+        for (int x = 0; x < symbols; x++)
+        {
+            writer.put16(PARSER_TABLE[s][x][0]);
+            writer.put16(PARSER_TABLE[s][x][1]);
+        }
+
+    header.offsets[S_PARSER_ERRORS] = writer.begin();
+    for (int s = 0; s < states; s++)
+        writer.putString(PARSER_ERROR[s]);
+
+    std::string image = writer.finish(header);
+
+    //Guarda a semente das palavras reservadas para a carga não precisar procurá-la
+    Tables tables;
+    if (tables.loadImage(InputSource::borrow(image.data(), image.size())))
+    {
+        header.keywordSeed = tables.getKeywords().getSeed();
+        header.keywordBits = tables.getKeywords().getBits();
+        std::memcpy(&image[0], &header, sizeof header);
+    }
+    return image;
+}
+
+const Tables &Tables::builtin()
+{
+    struct Builtin
+    {
+        Tables tables;
+
+        Builtin()
+        {
+            tables.loadImage(InputSource::own(builtinImage()));
+            tables.builtinTables = true;
+        }
+    };
+
+    //Nunca destruídas: Lexicos estáticos podem usá-las até o fim do programa
+    static Builtin *builtin = new Builtin;
+    return builtin->tables;
+}
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef TABLES_H
+#define TABLES_H
+
+#include "Constants.h"
+#include "InputSource.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class ScannerTable;
+class KeywordTable;
+class ParserTable;
+
+// Tabelas de uma gramática (scanner, casos especiais, parser e mensagens de
+// erro) em um formato binário versionado: um cabeçalho de tamanho fixo,
+// seções de inteiros de 16 bits e um bloco de strings terminadas em '\0',
+// na ordem de bytes da máquina que o gerou. A imagem é usada no lugar, sem
+// cópia nem conversão; na carga só são montadas as formas compactas do
+// scanner, das palavras reservadas e do parser.
+//
+// builtin() são as tabelas de Constants.cpp, compiladas no programa e
+// postas neste formato na primeira chamada. tools/gen_tables.cpp grava essa
+// mesma imagem em arquivo, que load() mapeia com mmap: assim um único
+// executável (compilado com TABLES_NO_BUILTIN, sem Constants.cpp) pode usar
+// várias versões da gramática.
+class Tables
+{
+public:
+    static const uint32_t VERSION = 1;
+
+    // Maior lado direito aceito numa produção. As do GALS têm poucas dezenas
+    // de símbolos; o limite impede que uma imagem corrompida faça o REDUCE
+    // desempilhar milhares de estados
+    static const int MAX_PRODUCTION_LENGTH = 255;
+
+    Tables();
+    ~Tables();
+
+    Tables(const Tables &) = delete;
+    Tables &operator=(const Tables &) = delete;
+
+    // Falsos se o arquivo não puder ser lido ou não for uma imagem válida
+    bool load(const std::string &path);
+    bool loadImage(InputSource image);
+
+    // Tabelas usadas por Lexico e Sintatico quando nenhuma é indicada. Com
+    // TABLES_NO_BUILTIN, setDefaults precisa ser chamado antes.
+    static const Tables &defaults();
+    static void setDefaults(const Tables &tables);
+
+#if ! defined(TABLES_NO_BUILTIN)
+    static const Tables &builtin();
+
+    // Imagem binária das tabelas de Constants.cpp
+    static std::string builtinImage();
+#endif
+
+    bool isLoaded() const { return scannerTable != 0; }
+    bool isBuiltin() const { return builtinTables; }
+
+    const void *imageData() const { return image.data(); }
+    std::size_t imageSize() const { return image.size(); }
+
+    //Scanner
+    int getStatesCount() const { return statesCount; }
+    int nextState(int state, unsigned char c) const { return scanner[state * 256 + c]; }
+    int tokenForState(int state) const { return tokenState[state]; }
+    const int16_t *getTokenStates() const { return tokenState; }
+    const char *scannerError(int state) const { return strings + scannerErrors[state]; }
+
+    //Casos especiais (palavras reservadas)
+    int getSpecialCasesCount() const { return specialCases; }
+    uint32_t getKeywordSeed() const { return keywordSeed; }
+    int getKeywordBits() const { return keywordBits; }
+    int getTokenCount() const { return tokenCount; }
+    int specialCasesBegin(int base) const { return specialIndexes[base]; }
+    int specialCasesEnd(int base) const { return specialIndexes[base + 1]; }
+    const char *specialCaseKey(int i) const { return strings + specialKeys[i]; }
+    int specialCaseValue(int i) const { return specialValues[i]; }
+
+    //Parser: cada entrada é o par (comando, valor) de PARSER_TABLE
+    int getParserStates() const { return parserStates; }
+    int getParserSymbols() const { return parserSymbols; }
+    int getFirstSemanticAction() const { return firstSemanticAction; }
+    const int16_t *parserEntry(int state, int symbol) const { return parser + (state * parserSymbols + symbol) * 2; }
+    int getProductionCount() const { return productionCount; }
+    const int16_t *production(int index) const { return productions + index * 2; }
+    const char *parserError(int state) const { return strings + parserErrors[state]; }
+
+    // Formas compactas, montadas na carga
+    const ScannerTable &getScanner() const { return *scannerTable; }
+    const KeywordTable &getKeywords() const { return *keywordTable; }
+    const ParserTable &getParser() const { return *parserTable; }
+
+private:
+    InputSource image;
+    bool builtinTables;
+
+    int statesCount;
+    int tokenCount;
+    int specialCases;
+    int parserStates;
+    int parserSymbols;
+    int productionCount;
+    int firstSemanticAction;
+    uint32_t keywordSeed;
+    int keywordBits;
+
+    const int16_t *scanner;
+    const int16_t *tokenState;
+    const int16_t *specialIndexes;
+    const int16_t *specialValues;
+    const uint32_t *specialKeys;
+    const uint32_t *scannerErrors;
+    const int16_t *productions;
+    const int16_t *parser;
+    const uint32_t *parserErrors;
+    const char *strings;
+
+    std::unique_ptr<ScannerTable> scannerTable;
+    std::unique_ptr<KeywordTable> keywordTable;
+    std::unique_ptr<ParserTable> parserTable;
+
+    bool validate();
+    void reset();
+};
+
+#endif
@@ -0,0 +1,137 @@
+#include "TaskPool.h"
+
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+//Faixa [next, end) de tarefas de uma thread, cada uma em sua linha de cache
+struct alignas(64) TaskRange
+{
+    std::mutex lock;
+    std::size_t next;
+    std::size_t end;
+};
+
+struct TaskFailure
+{
+    std::mutex lock;
+    std::size_t task;
+    std::exception_ptr error;
+};
+
+//Próxima tarefa da própria faixa
+static bool take(TaskRange &range, std::size_t &task)
+{
+    std::lock_guard<std::mutex> guard(range.lock);
+    if (range.next == range.end)
+        return false;
+    task = range.next++;
+    return true;
+}
+
+//Passa para a faixa de self (vazia) a metade final da maior faixa restante
+static bool steal(std::vector<TaskRange> &ranges, unsigned self)
+{
+    for (;;)
+    {
+        unsigned victim = self;
+        std::size_t most = 0;
+        for (unsigned w = 0; w < ranges.size(); w++)
+        {
+            std::lock_guard<std::mutex> guard(ranges[w].lock);
+            if (ranges[w].end - ranges[w].next > most)
+            {
+                most = ranges[w].end - ranges[w].next;
+                victim = w;
+            }
+        }
+        if (most == 0)
+            return false;
+
+        std::size_t from, end;
+        {
+            std::lock_guard<std::mutex> guard(ranges[victim].lock);
+            std::size_t left = ranges[victim].end - ranges[victim].next;
+            if (left == 0)
+                continue;   //Outra thread chegou antes
+
+            end = ranges[victim].end;
+            from = end - (left + 1) / 2;
+            ranges[victim].end = from;
+        }
+
+        std::lock_guard<std::mutex> guard(ranges[self].lock);
+        ranges[self].next = from;
+        ranges[self].end = end;
+        return true;
+    }
+}
+
+static void work(std::vector<TaskRange> &ranges, unsigned self, const TaskPool::Job &job, TaskFailure &failure)
+{
+    std::size_t task;
+    do
+    {
+        while (take(ranges[self], task))
+        {
+            try
+            {
+                job(task, self);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> guard(failure.lock);
+                if (! failure.error || task < failure.task)
+                {
+                    failure.task = task;
+                    failure.error = std::current_exception();
+                }
+            }
+        }
+    }
+    while (steal(ranges, self));
+}
+
+unsigned TaskPool::threadsFor(unsigned threads)
+{
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+    return threads > 0 ? threads : 1;
+}
+
+void TaskPool::run(std::size_t count, unsigned threads, const Job &job)
+{
+    threads = threadsFor(threads);
+    if (threads > count)
+        threads = static_cast<unsigned>(count > 0 ? count : 1);
+
+    std::vector<TaskRange> ranges(threads);
+    for (unsigned w = 0; w < threads; w++)
+    {
+        ranges[w].next = count * w / threads;
+        ranges[w].end = count * (w + 1) / threads;
+    }
+
+    TaskFailure failure;
+    std::vector<std::thread> workers;
+    for (unsigned w = 1; w < threads; w++)
+    {
+        try
+        {
+            workers.emplace_back(work, std::ref(ranges), w, std::cref(job), std::ref(failure));
+        }
+        catch (const std::system_error &)
+        {
+        }
+    }
+
+    work(ranges, 0, job, failure);
+
+    for (std::size_t k = 0; k < workers.size(); k++)
+        workers[k].join();
+
+    if (failure.error)
+        std::rethrow_exception(failure.error);
+}
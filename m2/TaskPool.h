@@ -0,0 +1,29 @@
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <cstddef>
+#include <functional>
+
+// Executa as tarefas 0, 1, ..., count - 1 em várias threads, com roubo de
+// trabalho. Cada thread começa com uma faixa contígua de tarefas e as faz em
+// ordem; quando a sua acaba, rouba a metade final da faixa de quem tiver mais
+// tarefas sobrando. Nenhuma tarefa cria outras: a thread que não acha nada
+// para roubar terminou. A thread atual é a de número 0; as que não puderem
+// ser criadas só deixam suas faixas para as outras roubarem.
+class TaskPool
+{
+public:
+    // worker (menor que o número de threads) identifica a thread que executa
+    // a tarefa, para quem precisa de um estado por thread
+    typedef std::function<void(std::size_t task, unsigned worker)> Job;
+
+    // threads = 0: uma por núcleo. Uma exceção lançada por job é relançada
+    // depois que todas as threads terminam (a da menor tarefa, se houver
+    // mais de uma)
+    static void run(std::size_t count, unsigned threads, const Job &job);
+
+    // Quantas threads run usa para um dado pedido (0: uma por núcleo)
+    static unsigned threadsFor(unsigned threads);
+};
+
+#endif
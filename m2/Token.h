@@ -3,22 +3,27 @@
 
 #include "Constants.h"
 
-#include <string>
+#include <string_view>
 
 class Token
 {
 public:
-    Token(TokenId id, const std::string &lexeme, int position)
+    Token() : id(EPSILON), position(-1) { }
+
+    // O lexema aponta para o buffer de entrada do Lexico (não é copiado);
+    // só é válido enquanto esse buffer existir. No modo stream do Lexico ele
+    // vale até que mais dois tokens sejam lidos.
+    Token(TokenId id, std::string_view lexeme, long long position)
       : id(id), lexeme(lexeme), position(position) { }
 
     TokenId getId() const { return id; }
-    const std::string &getLexeme() const { return lexeme; }
-    int getPosition() const { return position; }
+    std::string_view getLexeme() const { return lexeme; }
+    long long getPosition() const { return position; }
 
 private:
     TokenId id;
-    std::string lexeme;
-    int position;
+    std::string_view lexeme;
+    long long position;
 };
 
 #endif
@@ -0,0 +1,94 @@
+#ifndef TOKEN_BUFFER_H
+#define TOKEN_BUFFER_H
+
+#include "Token.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Tokens de uma entrada inteira em estrutura de arrays: ids, posições e
+// tamanhos ficam em vetores contíguos, e os lexemas continuam apontando para
+// o texto de entrada do Lexico que preencheu o buffer.
+class TokenBuffer
+{
+    //Alocador que não zera os elementos criados por resize: quem redimensiona
+    //escreve todos eles logo depois, e a memória só é tocada uma vez
+    template <typename T>
+    struct Uninitialized : std::allocator<T>
+    {
+        template <typename U> struct rebind { typedef Uninitialized<U> other; };
+
+        Uninitialized() { }
+        template <typename U> Uninitialized(const Uninitialized<U> &) { }
+
+        template <typename U>
+        void construct(U *p) { ::new (static_cast<void *>(p)) U; }
+
+        template <typename U, typename... Args>
+        void construct(U *p, Args &&...args) { ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...); }
+    };
+
+public:
+    TokenBuffer() : text(0) { }
+
+    void clear(const char *text)
+    {
+        this->text = text;
+        ids.clear();
+        positions.clear();
+        lengths.clear();
+    }
+
+    void reserve(std::size_t count)
+    {
+        ids.reserve(count);
+        positions.reserve(count);
+        lengths.reserve(count);
+    }
+
+    void push(TokenId id, long long position, int length)
+    {
+        ids.push_back(id);
+        positions.push_back(position);
+        lengths.push_back(length);
+    }
+
+    //Os tokens novos ficam com valores indefinidos até serem escritos por copy
+    void resize(std::size_t count)
+    {
+        ids.resize(count);
+        positions.resize(count);
+        lengths.resize(count);
+    }
+
+    //Copia os tokens de other a partir do índice from para cá, a partir de at
+    void copy(std::size_t at, const TokenBuffer &other, std::size_t from)
+    {
+        std::copy(other.ids.begin() + from, other.ids.end(), ids.begin() + at);
+        std::copy(other.positions.begin() + from, other.positions.end(), positions.begin() + at);
+        std::copy(other.lengths.begin() + from, other.lengths.end(), lengths.begin() + at);
+    }
+
+    std::size_t size() const { return ids.size(); }
+
+    TokenId getId(std::size_t i) const { return ids[i]; }
+    long long getPosition(std::size_t i) const { return positions[i]; }
+    int getLength(std::size_t i) const { return lengths[i]; }
+
+    Token token(std::size_t i) const
+    {
+        return Token(ids[i], std::string_view(text + positions[i], lengths[i]), positions[i]);
+    }
+
+private:
+    const char *text;
+    std::vector<TokenId, Uninitialized<TokenId> > ids;
+    std::vector<long long, Uninitialized<long long> > positions;
+    std::vector<int, Uninitialized<int> > lengths;
+};
+
+#endif
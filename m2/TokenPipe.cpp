@@ -0,0 +1,105 @@
+#include "TokenPipe.h"
+#include "Lexico.h"
+
+#include <system_error>
+
+//Espera curta: algumas voltas com pause e depois cede o processador, que com
+//um núcleo só é o que deixa o outro lado andar
+static void backoff(unsigned &spins)
+{
+    if (++spins < 64)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+        return;
+    }
+    std::this_thread::yield();
+}
+
+TokenPipe::TokenPipe(Lexico &scanner, std::size_t capacity)
+  : scanner(scanner), head(0), cachedTail(0), tail(0), cachedHead(0), done(false), stop(false)
+{
+    std::size_t size = 2;
+    while (size < capacity)
+        size *= 2;
+    ring.resize(size);
+    mask = size - 1;
+
+    try
+    {
+        thread = std::thread(&TokenPipe::produce, this);
+    }
+    catch (const std::system_error &)
+    {
+    }
+}
+
+TokenPipe::~TokenPipe()
+{
+    stop.store(true, std::memory_order_relaxed);
+    if (thread.joinable())
+        thread.join();
+}
+
+void TokenPipe::produce()
+{
+    std::size_t at = 0;
+    try
+    {
+        Token token;
+        while (scanner.nextToken(token))
+        {
+            //Anel cheio: espera o consumidor liberar uma posição
+            unsigned spins = 0;
+            while (at - cachedTail == ring.size())
+            {
+                if (stop.load(std::memory_order_relaxed))
+                    return;
+                backoff(spins);
+                cachedTail = tail.load(std::memory_order_acquire);
+            }
+
+            ring[at & mask] = token;
+            head.store(++at, std::memory_order_release);
+        }
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+    done.store(true, std::memory_order_release);
+}
+
+bool TokenPipe::next(Token &token)
+{
+    if (! thread.joinable())
+        return scanner.nextToken(token);
+
+    std::size_t at = tail.load(std::memory_order_relaxed);
+    if (at == cachedHead)
+    {
+        unsigned spins = 0;
+        for (;;)
+        {
+            //done é lido antes de head: se já estava marcado, head tem o
+            //último token publicado
+            bool finished = done.load(std::memory_order_acquire);
+            cachedHead = head.load(std::memory_order_acquire);
+            if (at != cachedHead)
+                break;
+
+            if (finished)
+            {
+                if (error)
+                    std::rethrow_exception(error);
+                return false;
+            }
+            backoff(spins);
+        }
+    }
+
+    token = ring[at & mask];
+    tail.store(at + 1, std::memory_order_release);
+    return true;
+}
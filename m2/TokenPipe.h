@@ -0,0 +1,63 @@
+#ifndef TOKEN_PIPE_H
+#define TOKEN_PIPE_H
+
+#include "Token.h"
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+class Lexico;
+
+// Lexico lido numa thread própria, que entrega os tokens por um anel sem
+// travas de um produtor e um consumidor (Sintatico::parsePipelined). Com o
+// anel cheio o produtor espera o consumidor andar; com ele vazio, o
+// contrário. Um LexicalError na thread de leitura é guardado e relançado por
+// next() depois do último token lido antes dele, no mesmo ponto em que a
+// leitura sequencial o lançaria.
+//
+// Só para entrada em memória, em que os lexemas apontam para o texto e o
+// Lexico não muda nada que outra thread consulte: durante a análise o
+// Sintatico (e o Semantico) podem chamar lineColumn, mas não mexer na
+// leitura. Se a thread não puder ser criada, next() lê no thread atual.
+class TokenPipe
+{
+public:
+    static const std::size_t DEFAULT_CAPACITY = 1 << 14;
+
+    // capacity é arredondada para uma potência de 2
+    explicit TokenPipe(Lexico &scanner, std::size_t capacity = DEFAULT_CAPACITY);
+
+    // Interrompe a leitura, se ainda não terminou, e espera a thread
+    ~TokenPipe();
+
+    TokenPipe(const TokenPipe &) = delete;
+    TokenPipe &operator=(const TokenPipe &) = delete;
+
+    // Como Lexico::nextToken
+    bool next(Token &token);
+
+private:
+    Lexico &scanner;
+    std::vector<Token> ring;
+    std::size_t mask;
+
+    //Cada lado em sua linha de cache: o índice que escreve e a última cópia
+    //que viu do índice do outro, relida só quando ela não basta
+    alignas(64) std::atomic<std::size_t> head;
+    std::size_t cachedTail;
+
+    alignas(64) std::atomic<std::size_t> tail;
+    std::size_t cachedHead;
+
+    alignas(64) std::atomic<bool> done;
+    std::atomic<bool> stop;
+    std::exception_ptr error;
+    std::thread thread;
+
+    void produce();
+};
+
+#endif
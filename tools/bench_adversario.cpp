@@ -0,0 +1,76 @@
+// Mede o Lexico em entradas feitas para forçar o retrocesso do DFA: um
+// padrão com "/*" sem fechamento repetido até o tamanho pedido. Sem as
+// marcas de Lexico::markFailed, cada token volta a percorrer o resto da
+// entrada e o tempo cresce com o quadrado do tamanho; com elas, o tempo
+// deve crescer como o tamanho. Também mostra o pico de memória do processo
+// (getrusage), que com um padrão só é o texto mais as marcas.
+//
+// Uso (da raiz do repositório):
+//     mkdir -p /tmp/bench && cp m2/* /tmp/bench/
+//     g++ -std=c++17 -O2 -I/tmp/bench tools/bench_adversario.cpp /tmp/bench/*.cpp -o bench_adversario -lpthread
+//     ./bench_adversario [kilobytes] [padrão...]
+//
+// Sem padrões, usa os quatro de PADROES; o tamanho padrão é 80 KB. Para o
+// pico de memória de um padrão, passe só ele (./bench_adversario 16384 "/* ").
+
+#include "Lexico.h"
+#include "bench_entradas.h"
+
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+static const char *const PADROES[] = { "/* ", "a/*", "x = a /* b;\n", "1/*x" };
+
+//Pico de memória residente do processo, em MB
+static double picoDeMemoria()
+{
+    struct rusage uso;
+    getrusage(RUSAGE_SELF, &uso);
+    return uso.ru_maxrss / 1024.0;
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t kilobytes = argc > 1 ? std::strtoul(argv[1], 0, 10) : 80;
+
+    std::vector<std::string> padroes;
+    for (int i = 2; i < argc; i++)
+        padroes.push_back(argv[i]);
+    if (padroes.empty())
+        padroes.assign(PADROES, PADROES + sizeof PADROES / sizeof PADROES[0]);
+
+    std::printf("%zu KB por entrada\n", kilobytes);
+    for (const std::string &padrao : padroes)
+    {
+        const std::string texto = entradas::repetir(padrao, kilobytes << 10);
+
+        Lexico lex(texto.c_str());
+        Token token;
+        long long tokens = 0;
+        std::string erro;
+
+        auto inicio = std::chrono::steady_clock::now();
+        try
+        {
+            while (lex.nextToken(token))
+                tokens++;
+        }
+        catch (const AnalysisError &e)
+        {
+            erro = std::string(" (") + e.getMessage() + " em " + std::to_string(e.getPosition()) + ")";
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+
+        std::string nome = padrao;
+        for (std::size_t p; (p = nome.find('\n')) != std::string::npos; )
+            nome.replace(p, 1, "\\n");
+        std::printf("%10.1f ms %10lld tokens %8.1f MB de pico  \"%s\"%s\n",
+                    ms, tokens, picoDeMemoria(), nome.c_str(), erro.c_str());
+    }
+    return 0;
+}
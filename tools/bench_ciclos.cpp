@@ -0,0 +1,91 @@
+// Mede o laço do scanner em ciclos por byte (rdtsc): leitura de todos os
+// tokens com Lexico::nextToken em código misto, num texto cheio de palavras
+// reservadas, em comentários de bloco, em identificadores e em espaços.
+// Cada entrada é lida algumas vezes, ficando com a menor contagem.
+//
+// Só usa a interface do Lexico; para comparar com outro commit, compile o
+// mesmo arquivo com o m2 dele (aqui, o de antes da sentinela):
+//     mkdir -p /tmp/antes_sentinela
+//     git archive $(git log -1 --format=%h --grep='Run the scanner hot loop over a NUL sentinel')^ m2 | tar -x -C /tmp/antes_sentinela
+//
+// Uso (da raiz do repositório, em x86):
+//     mkdir -p /tmp/bench && cp m2/* /tmp/bench/
+//     g++ -std=c++17 -O2 -I/tmp/bench tools/bench_ciclos.cpp /tmp/bench/*.cpp -o bench_ciclos -lpthread
+//     ./bench_ciclos [megabytes]
+//
+// Com -DSCANNER_DIRECT, mede também o scanner gerado (DirectScanner.cpp) ao
+// lado do laço de tabela. O Lexico só usa o código gerado com as tabelas
+// embutidas; a coluna da tabela usa uma cópia delas carregada da imagem
+// (Tables::loadImage), que o Lexico trata como tabelas de fora.
+
+#include "Lexico.h"
+#include "bench_entradas.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+//Menor número de ciclos por byte para ler todos os tokens do texto, com as
+//tabelas dadas ou, sem nenhuma, as padrão (sem citar Tables, para compilar
+//também com o m2 de antes dele)
+template <class... Tabelas>
+static double ciclosPorByte(const std::string &texto, const Tabelas &...tabelas)
+{
+    double melhor = 1e30;
+    for (int r = 0; r < 10; r++)
+    {
+        Lexico lex(texto.c_str(), tabelas...);
+        Token token;
+
+        unsigned long long inicio = __rdtsc();
+        while (lex.nextToken(token))
+            ;
+        double ciclos = static_cast<double>(__rdtsc() - inicio) / texto.size();
+        if (ciclos < melhor)
+            melhor = ciclos;
+    }
+    return melhor;
+}
+
+#if defined(SCANNER_DIRECT)
+static Tables copia;
+
+static void medir(const char *nome, const std::string &texto)
+{
+    std::printf("%8.2f %8.2f  %s\n", ciclosPorByte(texto, copia), ciclosPorByte(texto), nome);
+}
+#else
+static void medir(const char *nome, const std::string &texto)
+{
+    std::printf("%8.2f ciclos/byte  %s\n", ciclosPorByte(texto), nome);
+}
+#endif
+
+int main(int argc, char **argv)
+{
+    std::size_t megabytes = argc > 1 ? std::strtoul(argv[1], 0, 10) : 2;
+    std::size_t tamanho = megabytes << 20;
+
+#if defined(SCANNER_DIRECT)
+    if (! copia.loadImage(InputSource::own(Tables::builtinImage())))
+    {
+        std::fprintf(stderr, "imagem das tabelas inválida\n");
+        return 1;
+    }
+    std::printf("%zu MB por entrada, ciclos/byte: tabela, direto\n", megabytes);
+#else
+    std::printf("%zu MB por entrada\n", megabytes);
+#endif
+    medir("código misto", entradas::codigoMisto(tamanho, true));
+    medir("palavras reservadas", entradas::palavrasReservadas(tamanho));
+    medir("comentários de bloco", entradas::umaClasse(entradas::COMENTARIO_BLOCO, tamanho));
+    medir("identificadores", entradas::umaClasse(entradas::IDENTIFICADORES, tamanho));
+    medir("espaços", entradas::umaClasse(entradas::ESPACOS, tamanho));
+    return 0;
+}
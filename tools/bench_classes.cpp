@@ -0,0 +1,67 @@
+// Mede o Lexico em MB/s numa entrada de cada classe de token (espaços,
+// comentários de linha e de bloco, identificadores, strings) e em código
+// misto. São as classes em que o scanner fica num estado com laço, que
+// ScannerTable::skipLoop salta com SSE2 ou AVX2.
+//
+// A variante de skipLoop é escolhida na compilação: sem opções, SSE2 (em
+// x86-64); com -mavx2, AVX2. Para a medida de antes do skipLoop, compile
+// o mesmo arquivo com o m2 do commit anterior:
+//     mkdir -p /tmp/antes_skip
+//     git archive $(git log -1 --format=%h --grep='Skip self-looping scanner states')^ m2 | tar -x -C /tmp/antes_skip
+//
+// Uso (da raiz do repositório):
+//     mkdir -p /tmp/bench && cp m2/* /tmp/bench/
+//     g++ -std=c++17 -O2 [-mavx2] -I/tmp/bench tools/bench_classes.cpp /tmp/bench/*.cpp -o bench_classes -lpthread
+//     ./bench_classes [megabytes]
+
+#include "Lexico.h"
+#include "bench_entradas.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+//Melhor tempo de leitura de todos os tokens do texto, em segundos
+static double medir(const std::string &texto)
+{
+    double melhor = 1e30;
+    for (int r = 0; r < 7; r++)
+    {
+        Lexico lex(texto.c_str());
+        Token token;
+
+        auto inicio = std::chrono::steady_clock::now();
+        while (lex.nextToken(token))
+            ;
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        if (t < melhor)
+            melhor = t;
+    }
+    return melhor;
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t megabytes = argc > 1 ? std::strtoul(argv[1], 0, 10) : 8;
+    std::size_t tamanho = megabytes << 20;
+
+#if defined(__AVX2__)
+    std::printf("%zu MB por classe, AVX2\n", megabytes);
+#elif defined(__SSE2__) || defined(_M_X64)
+    std::printf("%zu MB por classe, SSE2\n", megabytes);
+#else
+    std::printf("%zu MB por classe, sem SIMD\n", megabytes);
+#endif
+
+    for (int c = 0; c < entradas::CLASSES; c++)
+    {
+        entradas::Classe classe = static_cast<entradas::Classe>(c);
+        const std::string texto = entradas::umaClasse(classe, tamanho);
+        std::printf("%8.1f MB/s  %s\n", texto.size() / medir(texto) / 1e6, entradas::nomeClasse(classe));
+    }
+
+    const std::string misto = entradas::codigoMisto(tamanho, true);
+    std::printf("%8.1f MB/s  código misto\n", misto.size() / medir(misto) / 1e6);
+    return 0;
+}
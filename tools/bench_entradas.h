@@ -0,0 +1,261 @@
+// Entradas geradas para os benchmarks de tools/. Cada função devolve um texto
+// de pelo menos `tamanho` bytes, sempre o mesmo para a mesma semente, para que
+// medições feitas em commits diferentes leiam exatamente a mesma entrada.
+
+#ifndef BENCH_ENTRADAS_H
+#define BENCH_ENTRADAS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace entradas
+{
+    //Gerador pequeno e determinístico em qualquer plataforma (xorshift64*)
+    class Sorteio
+    {
+    public:
+        explicit Sorteio(uint64_t semente) : estado(semente * 2 + 1) { }
+
+        uint64_t proximo()
+        {
+            estado ^= estado >> 12;
+            estado ^= estado << 25;
+            estado ^= estado >> 27;
+            return estado * 0x2545F4914F6CDD1DULL;
+        }
+
+        //Inteiro em [0, n)
+        int ate(int n) { return static_cast<int>(proximo() >> 33) % n; }
+
+        //Verdadeiro com probabilidade p / 100
+        bool chance(int p) { return ate(100) < p; }
+
+        template <std::size_t N>
+        const char *escolha(const char *const (&opcoes)[N]) { return opcoes[ate(static_cast<int>(N))]; }
+
+    private:
+        uint64_t estado;
+    };
+
+    namespace detalhe
+    {
+        inline std::string expressao(Sorteio &s, int d);
+
+        inline std::string aritmetica(Sorteio &s, int d)
+        {
+            static const char *const termos[] = { "a", "b", "x1", "42", "3.14", "\"str ing\"", "'c'",
+                                                  "0x1F", "0b101", "v[2]", "soma(a, b)" };
+            static const char *const operadores[] = { " + ", " - ", " * ", " / " };
+            int r = s.ate(10);
+            if (d > 2 || r < 3)
+                return s.escolha(termos);
+            if (r < 7)
+                return aritmetica(s, d + 1) + s.escolha(operadores) + aritmetica(s, d + 1);
+            return "(" + expressao(s, d + 1) + ")";
+        }
+
+        inline std::string expressao(Sorteio &s, int d)
+        {
+            static const char *const relacionais[] = { " < ", " == ", " >= ", " != " };
+            if (s.ate(10) < 6)
+                return aritmetica(s, d);
+            return aritmetica(s, d) + s.escolha(relacionais) + aritmetica(s, d);
+        }
+    }
+
+    // Código misto no estilo das entradas dos trabalhos: declarações globais
+    // e funções com atribuições, if/while/for, cout e return. Com comentarios,
+    // um décimo dos itens vira comentário de linha ou de bloco.
+    inline std::string codigoMisto(std::size_t tamanho, bool comentarios = false, uint64_t semente = 1)
+    {
+        Sorteio s(semente);
+        std::string texto;
+        for (int k = 1; texto.size() < tamanho; k++)
+        {
+            std::string n = std::to_string(k);
+            int r = s.ate(100);
+            if (r < 30)
+            {
+                texto += "int g" + n + ", h" + n + "[4];\n";
+                continue;
+            }
+            if (comentarios && r < 35)
+            {
+                texto += "// comentario de linha " + n + " com texto\n";
+                continue;
+            }
+            if (comentarios && r < 40)
+            {
+                texto += "/* bloco de comentario\n   numero " + n + " ** ok */\n";
+                continue;
+            }
+
+            texto += "int func_" + n + "(int a, float b) {\n";
+            int comandos = 1 + s.ate(8);
+            for (int j = 0; j < comandos; j++)
+            {
+                int t = s.ate(10);
+                if (t < 2)
+                    texto += "    int x" + std::to_string(j) + ";\n";
+                else if (t < 5)
+                    texto += "    a = " + detalhe::expressao(s, 0) + ";\n";
+                else if (t < 6)
+                    texto += "    if (" + detalhe::expressao(s, 0) + ") { b = " + detalhe::expressao(s, 0)
+                             + "; } else { a = b; }\n";
+                else if (t < 7)
+                    texto += "    while (a < 10) { a = a + 1; }\n";
+                else if (t < 8)
+                    texto += "    for (i = 0; i < 3; i++) { v[i] = i; }\n";
+                else if (t < 9)
+                    texto += "    cout << a << \"texto longo de saida\";\n";
+                else
+                    texto += "    return " + detalhe::expressao(s, 0) + ";\n";
+            }
+            texto += "}\n";
+        }
+        return texto;
+    }
+
+    // Palavras reservadas (todas as da linguagem) misturadas a identificadores
+    // curtos, números e pontuação: metade dos tokens são palavras reservadas.
+    // Só para o léxico; a sequência não é um programa válido.
+    inline std::string palavrasReservadas(std::size_t tamanho, uint64_t semente = 1)
+    {
+        static const char *const reservadas[] = {
+            "auto", "bool", "break", "case", "catch", "char", "cin", "class", "const", "continue", "cout",
+            "delete", "do", "double", "else", "elsif", "entao", "enum", "false", "final", "float", "for",
+            "goto", "if", "int", "long", "namespace", "new", "nullptr", "private", "protected", "public",
+            "register", "return", "se", "senao", "signed", "sizeof", "static", "string", "struct", "switch",
+            "template", "this", "true", "try", "typedef", "typename", "unsigned", "using", "void", "while" };
+        static const char *const outros[] = {
+            "i", "n", "x", "count", "valor", "buffer_len", "dobro", "intx", "format", "whiles",
+            "0", "42", ";", "(", ")", "{", "}", "=", "+" };
+        Sorteio s(semente);
+        std::string texto;
+        while (texto.size() < tamanho)
+        {
+            texto += s.chance(50) ? s.escolha(reservadas) : s.escolha(outros);
+            texto += s.ate(16) == 0 ? '\n' : ' ';
+        }
+        return texto;
+    }
+
+    // Funções feitas só de atribuições com expressões longas: a maior parte
+    // do parse são as cadeias de reduções <exp> -> ... -> <fator>
+    inline std::string expressoes(std::size_t tamanho, uint64_t semente = 1)
+    {
+        static const char *const termos[] = { "a", "x", "y1", "z", "3", "10", "v[2]", "(a)" };
+        static const char *const operadores[] = { " + ", " - ", " * ", " / " };
+        Sorteio s(semente);
+        std::string texto;
+        for (int f = 0; texto.size() < tamanho; f++)
+        {
+            texto += "int f" + std::to_string(f) + "(int a, int b) {\n";
+            for (int j = 0; j < 20; j++)
+            {
+                texto += "    a = ";
+                texto += s.escolha(termos);
+                int operacoes = s.ate(16);
+                for (int k = 0; k < operacoes; k++)
+                {
+                    texto += s.escolha(operadores);
+                    texto += s.escolha(termos);
+                }
+                texto += ";\n";
+            }
+            texto += "    return a;\n}\n";
+        }
+        return texto;
+    }
+
+    // Entradas de uma classe de token só, para medir cada laço do scanner:
+    // espaços e tabulações, comentários de linha, comentários de bloco,
+    // identificadores longos e strings. Os trechos têm tamanhos sorteados
+    // para que nenhum alinhamento se repita.
+    enum Classe { ESPACOS, COMENTARIO_LINHA, COMENTARIO_BLOCO, IDENTIFICADORES, STRINGS, CLASSES };
+
+    inline const char *nomeClasse(Classe classe)
+    {
+        static const char *const nomes[] = { "espaços", "comentário de linha", "comentário de bloco",
+                                             "identificadores", "strings" };
+        return nomes[classe];
+    }
+
+    inline std::string umaClasse(Classe classe, std::size_t tamanho, uint64_t semente = 1)
+    {
+        static const char letras[] = "abcdefghij0123_";
+        Sorteio s(semente);
+        std::string texto;
+        while (texto.size() < tamanho)
+        {
+            int vezes = 1 + s.ate(5);
+            switch (classe)
+            {
+                case ESPACOS:
+                    texto += std::string(s.ate(5), '\t') + "a" + std::string(1 + s.ate(40), ' ') + "\n";
+                    break;
+                case COMENTARIO_LINHA:
+                    texto += "//";
+                    for (int i = 0; i < vezes; i++)
+                        texto += " comentario de linha qualquer";
+                    texto += "\n";
+                    break;
+                case COMENTARIO_BLOCO:
+                    texto += "/*";
+                    for (int i = 0; i < vezes; i++)
+                        texto += " bloco com * e / no meio";
+                    texto += " */\n";
+                    break;
+                case IDENTIFICADORES:
+                    texto += "xident_";
+                    for (int i = 0, n = 1 + s.ate(30); i < n; i++)
+                        texto += letras[s.ate(static_cast<int>(sizeof letras - 1))];
+                    texto += " ";
+                    break;
+                case STRINGS:
+                    texto += "\"";
+                    for (int i = 0; i < vezes; i++)
+                        texto += "texto de string ";
+                    texto += "\" ";
+                    break;
+                default:
+                    return texto;
+            }
+        }
+        return texto;
+    }
+
+    // O padrão repetido até o tamanho pedido (entradas adversárias: cada
+    // cópia de "/*" abre um comentário que nunca fecha)
+    inline std::string repetir(const std::string &padrao, std::size_t tamanho)
+    {
+        std::string texto;
+        texto.reserve(tamanho + padrao.size());
+        while (texto.size() < tamanho)
+            texto += padrao;
+        return texto;
+    }
+
+    // Programa que passa também pelas análises semânticas do T4 e do
+    // Taryck: funções com nomes distintos, cada nome declarado antes do uso,
+    // e um main no fim
+    inline std::string programaDeclarado(std::size_t tamanho)
+    {
+        std::string texto;
+        for (int f = 0; texto.size() < tamanho; f++)
+        {
+            std::string n = std::to_string(f);
+            texto += "int g" + n + ";\n"
+                     "int f" + n + "(int a" + n + ") {\n"
+                     "  int x" + n + ";\n"
+                     "  x" + n + " = a" + n + " + " + n + ";\n"
+                     "  return x" + n + ";\n"
+                     "}\n";
+        }
+        texto += "int main() {\n  int r;\n  r = 2;\n  return r;\n}\n";
+        return texto;
+    }
+}
+
+#endif
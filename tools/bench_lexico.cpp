@@ -0,0 +1,207 @@
+// Mede o Lexico em tokens por segundo e em alocações por token numa entrada
+// de vários megabytes, token a token (nextToken), de uma vez num TokenBuffer
+// (tokenizeAll) e em pedaços paralelos (tokenizeParallel, que também é
+// conferido contra tokenizeAll), e o custo da tabela do scanner sozinha: o
+// mesmo percurso do DFA feito na SCANNER_TABLE original (STATES_COUNT x 256
+// ints) e no ScannerTable (classes de bytes, linhas de int16_t).
+//
+// A entrada é código misto gerado (tools/bench_entradas.h), com comentários,
+// sempre a mesma para o mesmo tamanho. Cada medida é a melhor de algumas
+// execuções.
+//
+// Para comparar com o m2 de antes da compressão, use este arquivo como
+// estava no commit dela, que também compila com aquele m2 (e nele só mede o
+// Lexico e o percurso na tabela original):
+//     mkdir -p /tmp/antes_compressao
+//     c=$(git log -1 --format=%h --grep='Compress SCANNER_TABLE')
+//     git archive $c^ m2 | tar -x -C /tmp/antes_compressao
+//     git show $c:tools/bench_lexico.cpp > /tmp/antes_compressao/bench_lexico.cpp
+//
+// Uso (da raiz do repositório):
+//     mkdir -p /tmp/bench && cp m2/* /tmp/bench/
+//     g++ -std=c++17 -O2 -I/tmp/bench tools/bench_lexico.cpp /tmp/bench/*.cpp -o bench_lexico -lpthread
+//     ./bench_lexico [megabytes] [threads]
+//
+// tokenizeParallel mostra o tempo de relógio e o de CPU de todos os threads
+// juntos; numa máquina de um núcleo só o segundo diz alguma coisa.
+
+#include "Lexico.h"
+#include "bench_entradas.h"
+
+#if __has_include("ScannerTable.h")
+#include "ScannerTable.h"
+#endif
+
+#include <chrono>
+#include <ctime>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+//Contagem das alocações do programa todo (operator new global)
+static long long alocacoes = 0;
+
+void *operator new(std::size_t tamanho)
+{
+    alocacoes++;
+    if (void *p = std::malloc(tamanho ? tamanho : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+static double segundos(std::chrono::steady_clock::time_point inicio)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+//Percorre o texto só com a função de transição: num erro, conta um token e
+//recomeça do estado 0 no mesmo byte. Devolve o melhor tempo
+template <class Transicao>
+static double percorrer(const std::string &texto, Transicao proximo, long long &tokens)
+{
+    double melhor = 1e30;
+    for (int r = 0; r < 7; r++)
+    {
+        const unsigned char *p = reinterpret_cast<const unsigned char *>(texto.data());
+        const unsigned char *fim = p + texto.size();
+        long long n = 0;
+        int estado = 0;
+
+        auto inicio = std::chrono::steady_clock::now();
+        while (p < fim)
+        {
+            int seguinte = proximo(*p, estado);
+            if (seguinte < 0)
+            {
+                n++;
+                seguinte = proximo(*p, 0);
+                if (seguinte < 0)
+                {
+                    estado = 0;
+                    p++;
+                    continue;
+                }
+            }
+            estado = seguinte;
+            p++;
+        }
+        double t = segundos(inicio);
+        if (t < melhor)
+            melhor = t;
+        tokens = n;
+    }
+    return melhor;
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t megabytes = argc > 1 ? std::strtoul(argv[1], 0, 10) : 20;
+    unsigned threads = argc > 2 ? std::strtoul(argv[2], 0, 10) : 4;
+    const std::string texto = entradas::codigoMisto(megabytes << 20, true);
+    const double mb = texto.size() / 1e6;
+
+    double melhor = 1e30;
+    long long tokens = 0;
+    long long alocado = 0;
+    for (int r = 0; r < 5; r++)
+    {
+        Lexico lex(texto.c_str());
+        Token token;
+        long long n = 0;
+
+        long long antes = alocacoes;
+        auto inicio = std::chrono::steady_clock::now();
+        while (lex.nextToken(token))
+            n++;
+        double t = segundos(inicio);
+        if (t < melhor)
+            melhor = t;
+        tokens = n;
+        alocado = alocacoes - antes;
+    }
+    std::printf("%zu bytes, %lld tokens\n", texto.size(), tokens);
+    std::printf("nextToken     %8.1f ms %8.2f Mtok/s %8.1f MB/s %8.2f alocações/token\n",
+                melhor * 1e3, tokens / melhor / 1e6, mb / melhor, static_cast<double>(alocado) / tokens);
+
+    TokenBuffer sequencial;
+    double cpuSequencial = 1e30;
+    melhor = 1e30;
+    for (int r = 0; r < 5; r++)
+    {
+        Lexico lex(texto.c_str());
+        TokenBuffer buffer;
+
+        std::clock_t cpu = std::clock();
+        auto inicio = std::chrono::steady_clock::now();
+        lex.tokenizeAll(buffer);
+        double t = segundos(inicio);
+        double c = static_cast<double>(std::clock() - cpu) / CLOCKS_PER_SEC;
+        if (t < melhor)
+            melhor = t;
+        if (c < cpuSequencial)
+            cpuSequencial = c;
+        if (r == 0)
+            sequencial = std::move(buffer);
+    }
+    std::printf("tokenizeAll   %8.1f ms %8.2f Mtok/s %8.1f MB/s %8.1f ms de CPU\n",
+                melhor * 1e3, tokens / melhor / 1e6, mb / melhor, cpuSequencial * 1e3);
+
+    double cpuParalelo = 1e30;
+    melhor = 1e30;
+    for (int r = 0; r < 5; r++)
+    {
+        Lexico lex(texto.c_str());
+        TokenBuffer buffer;
+
+        std::clock_t cpu = std::clock();
+        auto inicio = std::chrono::steady_clock::now();
+        lex.tokenizeParallel(buffer, threads);
+        double t = segundos(inicio);
+        double c = static_cast<double>(std::clock() - cpu) / CLOCKS_PER_SEC;
+        if (t < melhor)
+            melhor = t;
+        if (c < cpuParalelo)
+            cpuParalelo = c;
+
+        bool igual = buffer.size() == sequencial.size();
+        for (std::size_t i = 0; igual && i < buffer.size(); i++)
+            igual = buffer.getId(i) == sequencial.getId(i) && buffer.getPosition(i) == sequencial.getPosition(i)
+                 && buffer.getLength(i) == sequencial.getLength(i);
+        if (! igual)
+        {
+            std::printf("tokenizeParallel difere de tokenizeAll\n");
+            return 1;
+        }
+    }
+    std::printf("tokenizeParallel(%u) %8.1f ms %8.2f Mtok/s %8.1f MB/s %8.1f ms de CPU\n",
+                threads, melhor * 1e3, tokens / melhor / 1e6, mb / melhor, cpuParalelo * 1e3);
+
+    long long nOriginal = 0;
+    double original = percorrer(texto, [](unsigned char c, int estado) { return SCANNER_TABLE[estado][c]; },
+                                nOriginal);
+    std::printf("DFA original  %8.1f ms %8.1f MB/s %8zu bytes de tabela, %lld tokens\n",
+                original * 1e3, mb / original, sizeof SCANNER_TABLE, nOriginal);
+
+#if __has_include("ScannerTable.h")
+    const ScannerTable &tabela = Tables::defaults().getScanner();
+    long long nCompacta = 0;
+    double compacta = percorrer(texto, [&](unsigned char c, int estado)
+                                {
+                                    //Como no laço do Lexico: uma leitura, sem os bits ACCEPT/LOOP
+                                    int entrada = tabela.step(c, estado);
+                                    return entrada < 0 ? -1 : entrada & ScannerTable::STATE_MASK;
+                                }, nCompacta);
+    std::printf("DFA compacta  %8.1f ms %8.1f MB/s %8zu bytes de tabela, %d classes\n",
+                compacta * 1e3, mb / compacta, tabela.sizeInBytes(), tabela.getClassCount());
+    if (nOriginal != nCompacta)
+    {
+        std::printf("as duas tabelas divergem (%lld e %lld tokens)\n", nOriginal, nCompacta);
+        return 1;
+    }
+#endif
+    return 0;
+}
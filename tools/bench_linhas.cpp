@@ -0,0 +1,86 @@
+// Mede Lexico::lineColumn, que converte posições em linha/coluna para as
+// mensagens de erro: o tempo para converter a posição de cada token de uma
+// entrada grande, pelo índice de inícios de linha, contra o jeito ingênuo
+// de contar as quebras de linha desde o início do texto a cada consulta.
+//
+// Uso (da raiz do repositório):
+//     mkdir -p /tmp/bench && cp m2/* /tmp/bench/
+//     g++ -std=c++17 -O2 -I/tmp/bench tools/bench_linhas.cpp /tmp/bench/*.cpp -o bench_linhas -lpthread
+//     ./bench_linhas [megabytes] [consultas ingênuas]
+
+#include "Lexico.h"
+#include "bench_entradas.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+static double segundos(std::chrono::steady_clock::time_point inicio)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t megabytes = argc > 1 ? std::strtoul(argv[1], 0, 10) : 2;
+    std::size_t ingenuas = argc > 2 ? std::strtoul(argv[2], 0, 10) : 2000;
+    const std::string texto = entradas::codigoMisto(megabytes << 20, true);
+
+    std::vector<long long> posicoes;
+    {
+        Lexico lex(texto.c_str());
+        Token token;
+        while (lex.nextToken(token))
+            posicoes.push_back(token.getPosition());
+    }
+    std::printf("%zu bytes, %zu linhas, %zu tokens\n", texto.size(),
+                static_cast<std::size_t>(std::count(texto.begin(), texto.end(), '\n')) + 1, posicoes.size());
+
+    //Um Lexico novo: o índice é montado durante as próprias consultas
+    Lexico lex(texto.c_str());
+    long long soma = 0;
+    auto inicio = std::chrono::steady_clock::now();
+    for (long long pos : posicoes)
+    {
+        LineColumn lc = lex.lineColumn(pos);
+        soma += lc.line + lc.column;
+    }
+    double indice = segundos(inicio);
+    std::printf("índice    %8.1f ms para %zu consultas (%.0f ns cada)\n",
+                indice * 1e3, posicoes.size(), indice * 1e9 / posicoes.size());
+
+    //Consultas espalhadas pelo texto, cada uma recontando desde o início
+    ingenuas = std::min(ingenuas, posicoes.size());
+    long long somaIngenua = 0, somaIndice = 0;
+    inicio = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < ingenuas; i++)
+    {
+        long long pos = posicoes[i * posicoes.size() / ingenuas];
+        long long linha = 1, inicioLinha = 0;
+        for (long long p = 0; p < pos; p++)
+            if (texto[p] == '\n')
+            {
+                linha++;
+                inicioLinha = p + 1;
+            }
+        somaIngenua += linha + (pos - inicioLinha + 1);
+    }
+    double ingenuo = segundos(inicio);
+    std::printf("ingênuo   %8.1f ms para %zu consultas (%.0f ns cada)\n",
+                ingenuo * 1e3, ingenuas, ingenuo * 1e9 / ingenuas);
+
+    for (std::size_t i = 0; i < ingenuas; i++)
+    {
+        LineColumn lc = lex.lineColumn(posicoes[i * posicoes.size() / ingenuas]);
+        somaIndice += lc.line + lc.column;
+    }
+    if (somaIngenua != somaIndice)
+    {
+        std::printf("o índice e a contagem ingênua divergem\n");
+        return 1;
+    }
+    return soma == 0;
+}
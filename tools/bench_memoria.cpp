@@ -0,0 +1,119 @@
+// Mede o pico de memória (RSS) do Lexico ao analisar um arquivo inteiro,
+// conforme a forma como o texto chega a ele:
+//     copia  lê o arquivo numa std::string e a passa a setInput(const char *),
+//            que faz mais uma cópia (o caminho de antes do InputSource)
+//     mapa   mapeia o arquivo com InputSource::mapFile, sem cópia
+//     fluxo  lê o arquivo (ou a entrada padrão, com "-") por setStream, numa
+//            janela de tamanho fixo; o pico não depende do tamanho do arquivo
+//
+// Cada modo roda num processo à parte, porque o pico de RSS só cresce. O
+// modo gerar escreve um arquivo de código misto (tools/bench_entradas.h)
+// com o tamanho pedido, para servir de entrada.
+//
+// Uso (da raiz do repositório):
+//     mkdir -p /tmp/bench && cp m2/* /tmp/bench/
+//     g++ -std=c++17 -O2 -I/tmp/bench tools/bench_memoria.cpp /tmp/bench/*.cpp -o bench_memoria -lpthread
+//     ./bench_memoria gerar /tmp/fonte.txt 20
+//     ./bench_memoria copia /tmp/fonte.txt
+//     ./bench_memoria mapa /tmp/fonte.txt
+//     ./bench_memoria fluxo /tmp/fonte.txt
+//     (for i in $(seq 250); do cat /tmp/fonte.txt; done) | ./bench_memoria fluxo -
+
+#include "Lexico.h"
+#include "InputSource.h"
+#include "bench_entradas.h"
+
+#include <fcntl.h>
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+static long picoKB()
+{
+    rusage uso;
+    getrusage(RUSAGE_SELF, &uso);
+    return uso.ru_maxrss;
+}
+
+static int analisar(Lexico &lex, const char *modo, long long bytes)
+{
+    Token token;
+    long long tokens = 0;
+    long long ultimo = 0;
+
+    auto inicio = std::chrono::steady_clock::now();
+    while (lex.nextToken(token))
+    {
+        tokens++;
+        ultimo = token.getPosition();
+    }
+    double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    //No fluxo o tamanho não é conhecido antes: usa a posição do último token
+    if (bytes < 0)
+        bytes = ultimo;
+    std::printf("%-6s %lld bytes, %lld tokens, %.1f ms, pico de RSS %ld KB (%.2fx o arquivo)\n",
+                modo, bytes, tokens, t * 1e3, picoKB(), picoKB() * 1024.0 / bytes);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 4 && !std::strcmp(argv[1], "gerar"))
+    {
+        std::ofstream saida(argv[2], std::ios::binary);
+        saida << entradas::codigoMisto(std::strtoul(argv[3], 0, 10) << 20, true);
+        return saida ? 0 : 1;
+    }
+    if (argc != 3)
+    {
+        std::fprintf(stderr, "uso: %s gerar <arquivo> <megabytes> | copia|mapa|fluxo <arquivo>\n", argv[0]);
+        return 2;
+    }
+
+    if (!std::strcmp(argv[1], "copia"))
+    {
+        std::ifstream entrada(argv[2], std::ios::binary);
+        std::ostringstream conteudo;
+        conteudo << entrada.rdbuf();
+        const std::string texto = conteudo.str();
+
+        Lexico lex(texto.c_str());
+        return analisar(lex, "copia", static_cast<long long>(texto.size()));
+    }
+    if (!std::strcmp(argv[1], "mapa"))
+    {
+        InputSource fonte;
+        if (!fonte.mapFile(argv[2]))
+        {
+            std::fprintf(stderr, "não foi possível mapear %s\n", argv[2]);
+            return 1;
+        }
+        long long bytes = fonte.size();
+
+        Lexico lex;
+        lex.setInput(std::move(fonte));
+        return analisar(lex, "mapa", bytes);
+    }
+    if (!std::strcmp(argv[1], "fluxo"))
+    {
+        int fd = std::strcmp(argv[2], "-") ? open(argv[2], O_RDONLY) : 0;
+        if (fd < 0)
+        {
+            std::fprintf(stderr, "não foi possível abrir %s\n", argv[2]);
+            return 1;
+        }
+
+        Lexico lex;
+        lex.setStream(fd);
+        return analisar(lex, "fluxo", -1);
+    }
+    std::fprintf(stderr, "modo desconhecido: %s\n", argv[1]);
+    return 2;
+}
@@ -0,0 +1,155 @@
+// Mede a reanálise a partir dos pontos de retomada (Sintatico::reparse) com
+// o Semantico do T4 no nível Trace, em que ele guarda uma mensagem por ação
+// (o pior caso para as cópias dos pontos de retomada): o parse completo sem e
+// com os pontos, e a reanálise depois de uma edição de um byte (um '+' que
+// vira '-') a 99%, 90%, 50% e 10% do texto. Cada reanálise é conferida com
+// um parse completo do texto editado: tabela de símbolos e mensagens.
+//
+// A entrada é tools/bench_entradas.h (programaDeclarado), que passa pela
+// análise semântica do T4. O cerr vai para um buffer nulo: o que se mede é
+// montar e guardar as mensagens, não o terminal. Cada medida é a melhor de
+// algumas execuções.
+//
+// Uso (da raiz do repositório; o Semantico do T4 substitui o do m2, como no
+// projeto do T4):
+//     mkdir -p /tmp/bench && cp m2/* /tmp/bench/ && cp T4/Semantico.* /tmp/bench/
+//     g++ -std=c++17 -O2 -I/tmp/bench tools/bench_reparse.cpp /tmp/bench/*.cpp -o bench_reparse -lpthread
+//     ./bench_reparse [kilobytes]
+
+#include "Lexico.h"
+#include "Sintatico.h"
+#include "Semantico.h"
+#include "bench_entradas.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+//Descarta tudo o que recebe
+class NullBuffer : public std::streambuf
+{
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+};
+
+static double segundos(std::chrono::steady_clock::time_point inicio)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+//Tabela de símbolos e mensagens, para comparar duas análises
+static std::string estado(const Semantico &sem)
+{
+    std::ostringstream saida;
+    for (const Simbolo &s : sem.tabelaSimbolo)
+        saida << s << '\n';
+    for (const std::string &m : sem.mensagens())
+        saida << m << '\n';
+    return saida.str();
+}
+
+//Melhor tempo do parse completo sem e com os pontos de retomada, medidos
+//alternadamente para que a ordem não favoreça nenhum dos dois
+static void completo(const std::string &texto, double (&melhor)[2])
+{
+    melhor[0] = melhor[1] = 1e30;
+    for (int r = 0; r < 5; r++)
+        for (int pontos = 0; pontos < 2; pontos++)
+        {
+            Lexico lex(texto.c_str());
+            Sintatico sint;
+            Semantico sem;
+            sem.setNivelLog(NivelLog::Trace);
+            sint.setCheckpoints(pontos != 0);
+
+            auto inicio = std::chrono::steady_clock::now();
+            sint.parse(&lex, &sem);
+            double t = segundos(inicio);
+            if (t < melhor[pontos])
+                melhor[pontos] = t;
+        }
+}
+
+//Melhor tempo da reanálise de editado depois do parse de texto; confere
+//o resultado com o parse completo de editado
+static double reanalise(const std::string &texto, const std::string &editado, std::size_t alterado, bool &igual)
+{
+    std::string esperado;
+    {
+        Lexico lex(editado.c_str());
+        Sintatico sint;
+        Semantico sem;
+        sem.setNivelLog(NivelLog::Trace);
+        sint.parse(&lex, &sem);
+        esperado = estado(sem);
+    }
+
+    double melhor = 1e30;
+    igual = true;
+    for (int r = 0; r < 5; r++)
+    {
+        Lexico lex(texto.c_str());
+        Sintatico sint;
+        Semantico sem;
+        sem.setNivelLog(NivelLog::Trace);
+        sint.setCheckpoints(true);
+        sint.parse(&lex, &sem);
+
+        Lexico novo(editado.c_str());
+        auto inicio = std::chrono::steady_clock::now();
+        sint.reparse(&novo, &sem, alterado);
+        double t = segundos(inicio);
+        if (t < melhor)
+            melhor = t;
+
+        igual = igual && estado(sem) == esperado;
+    }
+    return melhor;
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t kilobytes = argc > 1 ? std::strtoul(argv[1], 0, 10) : 150;
+    const std::string texto = entradas::programaDeclarado(kilobytes << 10);
+
+    NullBuffer nulo;
+    std::streambuf *cerr = std::cerr.rdbuf(&nulo);
+
+    int falhas = 0;
+    try
+    {
+        std::printf("%zu bytes\n", texto.size());
+        double parse[2];
+        completo(texto, parse);
+        std::printf("parse completo             %8.2f ms\n", parse[0] * 1e3);
+        std::printf("parse completo com pontos  %8.2f ms\n", parse[1] * 1e3);
+
+        const int alturas[] = { 99, 90, 50, 10 };
+        for (int pct : alturas)
+        {
+            std::string editado = texto;
+            std::size_t alterado = editado.find(" + ", editado.size() * pct / 100) + 1;
+            editado[alterado] = '-';
+
+            bool igual;
+            double t = reanalise(texto, editado, alterado, igual);
+            std::printf("reanálise a %2d%%            %8.2f ms%s\n", pct, t * 1e3,
+                        igual ? "" : "  DIFERE do parse completo");
+            falhas += ! igual;
+        }
+    }
+    catch (const AnalysisError &e)
+    {
+        std::cerr.rdbuf(cerr);
+        std::fprintf(stderr, "erro: %s (%lld)\n", e.getMessage(), e.getPosition());
+        return 1;
+    }
+
+    std::cerr.rdbuf(cerr);
+    return falhas != 0;
+}
@@ -0,0 +1,53 @@
+// Mede o Lexico em MB/s e tokens por segundo num texto cheio de palavras
+// reservadas (metade dos tokens) e em código misto, as duas entradas em que
+// o reconhecimento das palavras reservadas pesa.
+//
+// Só usa a interface do Lexico, e por isso compila também com o m2 de
+// antes do hash perfeito, para a comparação:
+//     mkdir -p /tmp/antes_hash
+//     git archive $(git log -1 --format=%h --grep='Recognise keywords with a perfect hash')^ m2 | tar -x -C /tmp/antes_hash
+//
+// Uso (da raiz do repositório):
+//     mkdir -p /tmp/bench && cp m2/* /tmp/bench/
+//     g++ -std=c++17 -O2 -I/tmp/bench tools/bench_reservadas.cpp /tmp/bench/*.cpp -o bench_reservadas -lpthread
+//     ./bench_reservadas [megabytes]
+
+#include "Lexico.h"
+#include "bench_entradas.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+static void medir(const char *nome, const std::string &texto)
+{
+    double melhor = 1e30;
+    long long tokens = 0;
+    for (int r = 0; r < 7; r++)
+    {
+        Lexico lex(texto.c_str());
+        Token token;
+        long long n = 0;
+
+        auto inicio = std::chrono::steady_clock::now();
+        while (lex.nextToken(token))
+            n++;
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        if (t < melhor)
+            melhor = t;
+        tokens = n;
+    }
+    std::printf("%8.1f MB/s %8.2f Mtok/s  %s\n", texto.size() / melhor / 1e6, tokens / melhor / 1e6, nome);
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t megabytes = argc > 1 ? std::strtoul(argv[1], 0, 10) : 20;
+    std::size_t tamanho = megabytes << 20;
+
+    std::printf("%zu MB por entrada\n", megabytes);
+    medir("palavras reservadas", entradas::palavrasReservadas(tamanho));
+    medir("código misto", entradas::codigoMisto(tamanho));
+    return 0;
+}
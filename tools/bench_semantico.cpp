@@ -0,0 +1,80 @@
+// Mede o custo da análise semântica do T4 em cada nível de mensagens
+// (Semantico::setNivelLog).
+//
+// A entrada é tools/bench_entradas.h (programaDeclarado: funções com
+// declarações, atribuições e usos, com nomes distintos), analisada algumas
+// vezes em cada nível, ficando com o menor tempo. O cerr vai para um buffer nulo: o que se mede é montar e
+// guardar as mensagens, não o terminal. Para ver o custo sem o código das
+// mensagens, compile de novo com -DSEMANTICO_NIVEL_LOG=0.
+//
+// Uso (da raiz do repositório; o Semantico do T4 substitui o do m2, como no
+// projeto do T4):
+//     mkdir -p /tmp/bench && cp m2/* /tmp/bench/ && cp T4/Semantico.* /tmp/bench/
+//     g++ -std=c++17 -O2 -I/tmp/bench tools/bench_semantico.cpp /tmp/bench/*.cpp -o bench_semantico -lpthread
+//     ./bench_semantico [kilobytes]
+
+#include "Lexico.h"
+#include "Sintatico.h"
+#include "Semantico.h"
+#include "bench_entradas.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <streambuf>
+#include <string>
+
+//Descarta tudo o que recebe
+class NullBuffer : public std::streambuf
+{
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+};
+
+int main(int argc, char **argv)
+{
+    std::size_t kilobytes = argc > 1 ? std::strtoul(argv[1], 0, 10) : 150;
+    const std::string fonte = entradas::programaDeclarado(kilobytes << 10);
+
+    NullBuffer nulo;
+    std::streambuf *cerr = std::cerr.rdbuf(&nulo);
+
+    const char *nomes[] = { "Nenhum", "Aviso", "Debug", "Trace" };
+    const NivelLog niveis[] = { NivelLog::Nenhum, NivelLog::Aviso, NivelLog::Debug, NivelLog::Trace };
+
+    std::printf("%zu bytes, SEMANTICO_NIVEL_LOG=%d\n", fonte.size(), SEMANTICO_NIVEL_LOG);
+    for (int k = 0; k < 4; k++)
+    {
+        double melhor = 1e30;
+        std::size_t mensagens = 0;
+        for (int r = 0; r < 5; r++)
+        {
+            Lexico lex(fonte.c_str());
+            Sintatico sint;
+            Semantico sem;
+            sem.setNivelLog(niveis[k]);
+
+            auto t0 = std::chrono::steady_clock::now();
+            try
+            {
+                sint.parse(&lex, &sem);
+            }
+            catch (const AnalysisError &e)
+            {
+                std::cerr.rdbuf(cerr);
+                std::fprintf(stderr, "erro: %s (%lld)\n", e.getMessage(), e.getPosition());
+                return 1;
+            }
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+            if (ms < melhor)
+                melhor = ms;
+            mensagens = sem.mensagens().size();
+        }
+        std::printf("%-7s %9.2f ms %9zu mensagens\n", nomes[k], melhor, mensagens);
+    }
+
+    std::cerr.rdbuf(cerr);
+    return 0;
+}
@@ -0,0 +1,166 @@
+// Mede o Sintatico sozinho: o texto é lido antes (Lexico::tokenizeAll) e o
+// parse consome o TokenBuffer, com o Semantico nulo de tools/nulo (só conta
+// as ações). Mede também léxico e parse juntos (parse(Lexico *, ...), e
+// parsePipelined, com o léxico numa outra thread), e mostra o tamanho da
+// tabela do parser e o tempo de carga das tabelas.
+//
+// As entradas são geradas (tools/bench_entradas.h), sempre as mesmas para o
+// mesmo tamanho: código misto, e funções só de expressões longas, em que a
+// maior parte do parse são cadeias de reduções. Cada medida é a melhor de
+// algumas execuções.
+//
+// Uso (da raiz do repositório; o Semantico nulo substitui o do m2):
+//     mkdir -p /tmp/bench && cp m2/* /tmp/bench/ && rm /tmp/bench/Semantico.cpp
+//     cp tools/nulo/Semantico.h /tmp/bench/
+//     g++ -std=c++17 -O2 -I/tmp/bench tools/bench_sintatico.cpp /tmp/bench/*.cpp -o bench_sintatico -lpthread
+//     ./bench_sintatico [megabytes]
+//
+// Compila também com o m2 de antes da tabela compacta e com o de antes das
+// cadeias de reduções, para as comparações (com /tmp/antes_comb ou
+// /tmp/antes_cadeias no lugar de /tmp/bench nos comandos acima):
+//     mkdir -p /tmp/antes_comb /tmp/antes_cadeias
+//     git archive $(git log -1 --format=%h --grep="Pack the parser's ACTION/GOTO tables")^ m2 | tar -x -C /tmp/antes_comb
+//     git archive $(git log -1 --format=%h --grep="Collapse reduction chains after gotos")^ m2 | tar -x -C /tmp/antes_cadeias
+//
+// Com -DPARSER_DIRECT, mede também o parser gerado (DirectParser.cpp) ao
+// lado do laço de tabela. O Sintatico só usa o código gerado com as tabelas
+// embutidas; a coluna da tabela usa uma cópia delas carregada da imagem
+// (Tables::loadImage), que o Sintatico trata como tabelas de fora.
+
+#include "Lexico.h"
+#include "Sintatico.h"
+#include "Semantico.h"
+#include "bench_entradas.h"
+
+#if __has_include("ParserTable.h")
+#include "ParserTable.h"
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+static double segundos(std::chrono::steady_clock::time_point inicio)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+//Melhor tempo do parse do TokenBuffer, com as tabelas dadas ou, sem
+//nenhuma, as padrão; acoes recebe o número de ações semânticas
+template <class... Tabelas>
+static double parseTokens(const TokenBuffer &tokens, long long &acoes, const Tabelas &...tabelas)
+{
+    double melhor = 1e30;
+    for (int r = 0; r < 7; r++)
+    {
+        Sintatico sint(tabelas...);
+        Semantico sem;
+
+        auto inicio = std::chrono::steady_clock::now();
+        sint.parse(tokens, &sem);
+        double t = segundos(inicio);
+        if (t < melhor)
+            melhor = t;
+        acoes = sem.acoes;
+    }
+    return melhor;
+}
+
+//Melhor tempo de léxico e parse juntos, com o Lexico na mesma thread ou,
+//com paralelo, na sua (parsePipelined); o Lexico usa sempre as tabelas
+//padrão, só o Sintatico recebe as dadas
+template <class... Tabelas>
+static double parseTexto(const std::string &texto, bool paralelo, const Tabelas &...tabelas)
+{
+    double melhor = 1e30;
+    for (int r = 0; r < 5; r++)
+    {
+        Lexico lex(texto.c_str());
+        Sintatico sint(tabelas...);
+        Semantico sem;
+
+        auto inicio = std::chrono::steady_clock::now();
+#if __has_include("TokenPipe.h")
+        if (paralelo)
+            sint.parsePipelined(&lex, &sem);
+        else
+#endif
+            sint.parse(&lex, &sem);
+        double t = segundos(inicio);
+        if (t < melhor)
+            melhor = t;
+    }
+    return melhor;
+}
+
+#if defined(PARSER_DIRECT)
+static Tables copia;
+#endif
+
+static void medir(const char *nome, const std::string &texto)
+{
+    TokenBuffer tokens;
+    Lexico lex(texto.c_str());
+    lex.tokenizeAll(tokens);
+
+    long long acoes = 0;
+#if defined(PARSER_DIRECT)
+    double tabela = parseTokens(tokens, acoes, copia);
+    double direto = parseTokens(tokens, acoes);
+    std::printf("%8.1f %8.1f ms  %s (%zu tokens, %lld ações)\n",
+                tabela * 1e3, direto * 1e3, nome, tokens.size(), acoes);
+    std::printf("%8.1f %8.1f ms  %s, léxico + parse\n",
+                parseTexto(texto, false, copia) * 1e3, parseTexto(texto, false) * 1e3, nome);
+#else
+    double melhor = parseTokens(tokens, acoes);
+    std::printf("%8.1f ms %8.2f Mtok/s  %s (%zu tokens, %lld ações)\n",
+                melhor * 1e3, tokens.size() / melhor / 1e6, nome, tokens.size(), acoes);
+
+    melhor = parseTexto(texto, false);
+    std::printf("%8.1f ms %8.2f Mtok/s  %s, léxico + parse\n", melhor * 1e3, tokens.size() / melhor / 1e6, nome);
+#if __has_include("TokenPipe.h")
+    melhor = parseTexto(texto, true);
+    std::printf("%8.1f ms %8.2f Mtok/s  %s, léxico + parse em paralelo\n", melhor * 1e3, tokens.size() / melhor / 1e6, nome);
+#endif
+#endif
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t megabytes = argc > 1 ? std::strtoul(argv[1], 0, 10) : 20;
+
+    const Tables &tabelas = Tables::defaults();
+#if __has_include("ParserTable.h")
+    std::size_t tabela = tabelas.getParser().sizeInBytes();
+#else
+    std::size_t tabela = static_cast<std::size_t>(tabelas.getParserStates()) * tabelas.getParserSymbols() * 2 * 2;
+#endif
+
+    //Carga de uma imagem já pronta: validação e montagem das formas compactas
+    const std::string imagem = Tables::builtinImage();
+    double carga = 1e30;
+    for (int r = 0; r < 7; r++)
+    {
+        Tables copia;
+        auto inicio = std::chrono::steady_clock::now();
+        copia.loadImage(InputSource::borrow(imagem.data(), imagem.size()));
+        double t = segundos(inicio);
+        if (t < carga)
+            carga = t;
+    }
+    std::printf("tabela do parser: %zu bytes; carga das tabelas: %.2f ms\n", tabela, carga * 1e3);
+
+#if defined(PARSER_DIRECT)
+    if (! copia.loadImage(InputSource::own(Tables::builtinImage())))
+    {
+        std::fprintf(stderr, "imagem das tabelas inválida\n");
+        return 1;
+    }
+    std::printf("parse em ms: tabela, direto\n");
+#endif
+
+    medir("código misto", entradas::codigoMisto(megabytes << 20));
+    medir("expressões", entradas::expressoes(megabytes << 19));
+    return 0;
+}
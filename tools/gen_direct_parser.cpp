@@ -0,0 +1,198 @@
+// Gera m2/DirectParser.cpp (Sintatico::runDirect) a partir de PARSER_TABLE e
+// PRODUCTIONS.
+//
+// É a tabela do parser em código direto, como máquina de estados com goto.
+// Cada estado tem um rótulo dN com um switch sobre o token atual, e cada
+// entrada válida (estado, terminal) tem um braço eN_T com a ação:
+//  - um shift empilha, lê o próximo token e salta para o rótulo do novo
+//    estado;
+//  - uma ação semântica chama executeAction e salta direto para o braço do
+//    estado de destino com o mesmo terminal, que continua sendo o atual;
+//  - uma redução vazia faz o mesmo, porque o estado exposto é conhecido;
+//  - as demais reduções desempilham e passam por um bloco gA_T, que escolhe
+//    o desvio pelo estado exposto (um switch, com o destino mais comum no
+//    default) e também salta direto para o braço do terminal atual.
+// Só os rótulos usados são emitidos.
+//
+// Uso (da raiz do repositório, depois de regenerar Constants.cpp no GALS):
+//     g++ -std=c++17 -Im2 tools/gen_direct_parser.cpp m2/Constants.cpp -o gen_direct_parser
+//     ./gen_direct_parser > m2/DirectParser.cpp
+
+#include "Constants.h"
+
+#include <cstdio>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+static const int STATES = sizeof PARSER_TABLE / sizeof PARSER_TABLE[0];
+static const int PRODUCTIONS_COUNT = sizeof PRODUCTIONS / sizeof PRODUCTIONS[0];
+
+//Colunas dos terminais; a do token id é id - 1
+static int terminals;
+
+static std::set<std::pair<int, int> > arms;
+static std::set<std::pair<int, int> > gotoBlocks;
+
+static int command(int state, int column) { return PARSER_TABLE[state][column][0]; }
+static int value(int state, int column) { return PARSER_TABLE[state][column][1]; }
+
+static std::string label(char kind, int a, int b)
+{
+    return kind + std::to_string(a) + "_" + std::to_string(b);
+}
+
+//Já com target no topo da pilha e o terminal da coluna t ainda por tratar
+static std::string jump(int target, int t)
+{
+    if (command(target, t) == ERROR)
+        return "        errorState = " + std::to_string(target) + ";\n        goto error;\n";
+
+    arms.insert(std::make_pair(target, t));
+    return "        goto " + label('e', target, t) + ";\n";
+}
+
+static std::string armCode(int state, int t)
+{
+    int v = value(state, t);
+    std::string code;
+
+    switch (command(state, t))
+    {
+        case SHIFT:
+            code = "        stack.push(" + std::to_string(v) + ");\n"
+                   "        shiftedTokens++;\n"
+                   "        previousToken = currentToken;\n"
+                   "        readToken();\n"
+                   "        goto d" + std::to_string(v) + ";\n";
+            break;
+
+        case REDUCE:
+        {
+            int lhs = PRODUCTIONS[v][0] - 1;
+            int length = PRODUCTIONS[v][1];
+            if (length == 0)
+            {
+                int target = value(state, lhs);
+                code = "        stack.push(" + std::to_string(target) + ");\n" + jump(target, t);
+            }
+            else
+            {
+                gotoBlocks.insert(std::make_pair(lhs, t));
+                code = "        stack.pop(" + std::to_string(length) + ");\n"
+                       "        goto " + label('g', lhs, t) + ";\n";
+            }
+            break;
+        }
+
+        case ACTION:
+        {
+            int target = value(state, FIRST_SEMANTIC_ACTION + v - 1);
+            code = "        stack.push(" + std::to_string(target) + ");\n"
+                   "        semanticAnalyser->executeAction(" + std::to_string(v) +
+                   ", previousToken.getId() != EPSILON ? &previousToken : 0);\n" + jump(target, t);
+            break;
+        }
+
+        case ACCEPT:
+            code = "        return;\n";
+            break;
+    }
+    return code;
+}
+
+int main()
+{
+    //Todo não-terminal é lado esquerdo de alguma produção: o menor deles é
+    //o primeiro, e vem logo depois do último terminal
+    terminals = PRODUCTIONS[0][0];
+    for (int p = 1; p < PRODUCTIONS_COUNT; p++)
+        if (PRODUCTIONS[p][0] < terminals)
+            terminals = PRODUCTIONS[p][0];
+    terminals--;
+
+    //Os braços de cada estado, e a partir deles os rótulos e blocos usados
+    std::vector<std::map<int, std::string> > states(STATES);
+    for (int s = 0; s < STATES; s++)
+        for (int t = 0; t < terminals; t++)
+            if (command(s, t) != ERROR)
+                states[s][t] = armCode(s, t);
+
+    std::map<std::pair<int, int>, std::string> blocks;
+    for (std::set<std::pair<int, int> >::const_iterator b = gotoBlocks.begin(); b != gotoBlocks.end(); ++b)
+    {
+        int lhs = b->first;
+        int t = b->second;
+
+        std::map<int, std::vector<int> > targets;
+        for (int s = 0; s < STATES; s++)
+            if (command(s, lhs) == GO_TO)
+                targets[value(s, lhs)].push_back(s);
+
+        int fallback = -1;
+        std::size_t largest = 0;
+        for (std::map<int, std::vector<int> >::const_iterator g = targets.begin(); g != targets.end(); ++g)
+        {
+            if (g->second.size() > largest)
+            {
+                largest = g->second.size();
+                fallback = g->first;
+            }
+        }
+
+        std::string code = label('g', lhs, t) + ":\n    switch (stack.top())\n    {\n";
+        for (std::map<int, std::vector<int> >::const_iterator g = targets.begin(); g != targets.end(); ++g)
+        {
+            if (g->first == fallback)
+                continue;
+
+            const std::vector<int> &from = g->second;
+            for (std::size_t i = 0; i < from.size(); i++)
+                code += (i % 8 == 0 ? "    case " : "case ") + std::to_string(from[i]) + ":" +
+                        (i % 8 == 7 || i + 1 == from.size() ? "\n" : " ");
+            code += "        stack.push(" + std::to_string(g->first) + ");\n" + jump(g->first, t);
+        }
+        code += "    default:\n        stack.push(" + std::to_string(fallback) + ");\n" + jump(fallback, t) + "    }\n\n";
+        blocks[*b] = code;
+    }
+
+    std::printf("// Gerado por tools/gen_direct_parser.cpp a partir de Constants.cpp. Não editar:\n"
+                "// depois de regenerar as tabelas no GALS, gere este arquivo de novo.\n\n"
+                "#include \"Sintatico.h\"\n\n"
+                "static_assert(FIRST_SEMANTIC_ACTION == %d && sizeof PARSER_TABLE / sizeof PARSER_TABLE[0] == %d,\n"
+                "              \"DirectParser.cpp não corresponde a Constants.cpp\");\n\n",
+                FIRST_SEMANTIC_ACTION, STATES);
+
+    std::printf("void Sintatico::runDirect()\n"
+                "{\n"
+                "    int errorState;\n\n"
+                "    //Começa (ou retoma) no estado do topo da pilha\n"
+                "    switch (stack.top())\n"
+                "    {\n");
+    for (int s = 0; s < STATES; s++)
+        std::printf("    case %d: goto d%d;\n", s, s);
+    std::printf("    }\n\n");
+
+    for (int s = 0; s < STATES; s++)
+    {
+        std::printf("d%d:\n    switch (currentToken.getId())\n    {\n", s);
+        for (std::map<int, std::string>::const_iterator a = states[s].begin(); a != states[s].end(); ++a)
+        {
+            std::printf("    case %d:\n", a->first + 1);
+            if (arms.count(std::make_pair(s, a->first)))
+                std::printf("    %s:\n", label('e', s, a->first).c_str());
+            std::printf("%s", a->second.c_str());
+        }
+        std::printf("    default:\n        errorState = %d;\n        goto error;\n    }\n\n", s);
+    }
+
+    for (std::map<std::pair<int, int>, std::string>::const_iterator b = blocks.begin(); b != blocks.end(); ++b)
+        std::printf("%s", b->second.c_str());
+
+    std::printf("error:\n"
+                "    throw SyntacticError(PARSER_ERROR[errorState], currentToken.getPosition());\n"
+                "}\n");
+    return 0;
+}
@@ -0,0 +1,199 @@
+// Gera m2/DirectScanner.cpp a partir de SCANNER_TABLE e TOKEN_STATE.
+//
+// Cada estado do DFA vira um rótulo com um switch sobre o próximo byte; os
+// bytes que levam ao mesmo estado dividem o mesmo braço, e o destino mais
+// comum vira o default. Estados finais têm um segundo rótulo, antes do
+// switch, que anota o último estado final visto. Os laços de um estado em si
+// mesmo (espaços, identificadores, corpo de comentário) viram um do/while
+// sobre um mapa de bits por byte, como no re2c, antes do switch.
+//
+// Uso (da raiz do repositório, depois de regenerar Constants.cpp no GALS):
+//     g++ -std=c++17 -Im2 tools/gen_direct_scanner.cpp m2/Constants.cpp -o gen_direct_scanner
+//     ./gen_direct_scanner > m2/DirectScanner.cpp
+
+#include "Constants.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+static std::string byteLabel(int c)
+{
+    char buffer[16];
+    if (c == '\'' || c == '\\')
+        std::snprintf(buffer, sizeof buffer, "'\\%c'", c);
+    else if (c >= 32 && c < 127)
+        std::snprintf(buffer, sizeof buffer, "'%c'", c);
+    else
+        std::snprintf(buffer, sizeof buffer, "%d", c);
+    return buffer;
+}
+
+static std::vector<int> loopStates;
+
+//Índice do estado no mapa de bits dos laços, ou -1 se não tem laço
+static int loopIndex(int state)
+{
+    for (std::size_t i = 0; i < loopStates.size(); i++)
+        if (loopStates[i] == state)
+            return static_cast<int>(i);
+    return -1;
+}
+
+static bool accepting(int state)
+{
+    return TOKEN_STATE[state] >= 0;
+}
+
+//Rótulo de chegada em um estado: o que anota o estado final, se houver
+static std::string arrival(int state)
+{
+    return (accepting(state) ? "a" : "s") + std::to_string(state);
+}
+
+static void emitTransition(int from, int to)
+{
+    if (to < 0)
+        std::printf("        oldState = %d;\n        pos++;\n        goto dead;\n", from);
+    else
+        std::printf("        oldState = %d;\n        pos++;\n        goto %s;\n", from, arrival(to).c_str());
+}
+
+static void emitState(int state)
+{
+    //Bytes agrupados por destino; o '\0' é tratado à parte (sentinela) e os
+    //do laço já foram consumidos antes do switch
+    std::map<int, std::vector<int> > targets;
+    for (int c = 1; c < 256; c++)
+        if (SCANNER_TABLE[state][c] != state)
+            targets[SCANNER_TABLE[state][c]].push_back(c);
+
+    int fallback = -1;
+    std::size_t largest = 0;
+    for (std::map<int, std::vector<int> >::const_iterator t = targets.begin(); t != targets.end(); ++t)
+    {
+        if (t->second.size() > largest)
+        {
+            largest = t->second.size();
+            fallback = t->first;
+        }
+    }
+
+    if (accepting(state))
+        std::printf("a%d:\n    endState = %d;\n    endLength = pos - start;\n", state, state);
+    std::printf("s%d:\n", state);
+
+    int loop = loopIndex(state);
+    if (loop >= 0)
+    {
+        std::printf("    if (LOOPS[static_cast<unsigned char>(text[pos])] & %#x)\n    {\n"
+                    "        do\n            pos++;\n"
+                    "        while (LOOPS[static_cast<unsigned char>(text[pos])] & %#x);\n"
+                    "        oldState = %d;\n", 1u << loop, 1u << loop, state);
+        if (accepting(state))
+            std::printf("        endState = %d;\n        endLength = pos - start;\n", state);
+        std::printf("    }\n");
+    }
+
+    std::printf("    switch (static_cast<unsigned char>(text[pos]))\n    {\n");
+
+    for (std::map<int, std::vector<int> >::const_iterator t = targets.begin(); t != targets.end(); ++t)
+    {
+        if (t->first == fallback)
+            continue;
+
+        const std::vector<int> &bytes = t->second;
+        for (std::size_t i = 0; i < bytes.size(); i++)
+            std::printf("%s%s:%s", i % 8 == 0 ? "    case " : "case ", byteLabel(bytes[i]).c_str(),
+                        i % 8 == 7 || i + 1 == bytes.size() ? "\n" : " ");
+        emitTransition(state, t->first);
+    }
+
+    std::printf("    case 0:\n        if (pos == length)\n        {\n            state = %d;\n            goto end;\n        }\n", state);
+    if (SCANNER_TABLE[state][0] != fallback)
+    {
+        emitTransition(state, SCANNER_TABLE[state][0]);
+        std::printf("    default:\n");
+    }
+    else
+        std::printf("        //fall through\n    default:\n");
+    emitTransition(state, fallback);
+    std::printf("    }\n\n");
+}
+
+//Bit i de LOOPS[c]: o byte c mantém o i-ésimo estado com laço
+static void emitLoops()
+{
+    for (int s = 0; s < STATES_COUNT; s++)
+        for (int c = 1; c < 256; c++)
+            if (SCANNER_TABLE[s][c] == s)
+            {
+                loopStates.push_back(s);
+                break;
+            }
+
+    if (loopStates.size() > 16)
+    {
+        std::fprintf(stderr, "estados com laço demais para LOOPS (%d)\n", static_cast<int>(loopStates.size()));
+        std::exit(1);
+    }
+
+    std::printf("//Bit i de LOOPS[c]: o byte c mantém o estado");
+    for (std::size_t i = 0; i < loopStates.size(); i++)
+        std::printf(" %d", loopStates[i]);
+    std::printf(", nesta ordem\nstatic const uint16_t LOOPS[256] =\n{");
+
+    for (int c = 0; c < 256; c++)
+    {
+        unsigned bits = 0;
+        for (std::size_t i = 0; i < loopStates.size(); i++)
+            if (c != 0 && SCANNER_TABLE[loopStates[i]][c] == loopStates[i])
+                bits |= 1u << i;
+        std::printf("%s%#6x%s", c % 8 == 0 ? "\n    " : " ", bits, c < 255 ? "," : "\n};\n\n");
+    }
+}
+
+int main()
+{
+    std::printf("// Gerado por tools/gen_direct_scanner.cpp a partir de Constants.cpp. Não editar:\n"
+                "// depois de regenerar as tabelas no GALS, gere este arquivo de novo.\n\n"
+                "#include \"DirectScanner.h\"\n\n#include <cstdint>\n\n"
+                "static_assert(STATES_COUNT == %d, \"DirectScanner.cpp não corresponde a Constants.cpp\");\n\n",
+                STATES_COUNT);
+    emitLoops();
+
+    std::printf("bool DirectScanner::run(const char *text, std::size_t length, std::size_t start, std::size_t &position,\n"
+                "                        int &stateRef, int &oldStateRef, int &endStateRef, std::size_t &endLengthRef)\n"
+                "{\n"
+                "    //Cópias locais, para ficarem em registradores\n"
+                "    std::size_t pos = position;\n"
+                "    int state = stateRef;\n"
+                "    int oldState = oldStateRef;\n"
+                "    int endState = endStateRef;\n"
+                "    std::size_t endLength = endLengthRef;\n\n"
+                "    //Retoma do estado em que a última chamada parou\n"
+                "    if (state == 0)\n"
+                "        goto s0;\n"
+                "    switch (state)\n"
+                "    {\n");
+    for (int s = 0; s < STATES_COUNT; s++)
+        std::printf("    case %d: goto s%d;\n", s, s);
+    std::printf("    default: goto dead;\n    }\n\n");
+
+    for (int s = 0; s < STATES_COUNT; s++)
+        emitState(s);
+
+    std::printf("dead:\n"
+                "    state = -1;\n"
+                "end:\n"
+                "    position = pos;\n"
+                "    stateRef = state;\n"
+                "    oldStateRef = oldState;\n"
+                "    endStateRef = endState;\n"
+                "    endLengthRef = endLength;\n"
+                "    return state < 0;\n"
+                "}\n");
+    return 0;
+}
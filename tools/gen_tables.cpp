@@ -0,0 +1,52 @@
+// Grava as tabelas de Constants.cpp no formato binário de Tables, para serem
+// carregadas com Tables::load por um executável compilado com outra (ou
+// sem nenhuma) gramática embutida.
+//
+// Uso (da raiz do repositório, depois de regenerar Constants.cpp no GALS):
+//     g++ -std=c++17 -Im2 -o gen_tables tools/gen_tables.cpp m2/Tables.cpp
+//         m2/ScannerTable.cpp m2/KeywordTable.cpp m2/ParserTable.cpp m2/InputSource.cpp
+//         m2/Constants.cpp
+//     ./gen_tables gramatica.tbl
+
+#include "Tables.h"
+
+#include <cstdio>
+#include <string>
+
+int main(int argc, char **argv)
+{
+    if (argc != 2)
+    {
+        std::fprintf(stderr, "uso: %s <arquivo de saída>\n", argv[0]);
+        return 2;
+    }
+
+    std::string image = Tables::builtinImage();
+
+    //A imagem precisa ser aceita pela mesma validação usada na carga
+    Tables check;
+    if (! check.loadImage(InputSource::borrow(image.data(), image.size())))
+    {
+        std::fprintf(stderr, "imagem inválida\n");
+        return 1;
+    }
+
+    std::FILE *out = std::fopen(argv[1], "wb");
+    if (out == 0)
+    {
+        std::perror(argv[1]);
+        return 1;
+    }
+
+    bool ok = std::fwrite(image.data(), 1, image.size(), out) == image.size();
+    ok = std::fclose(out) == 0 && ok;
+    if (! ok)
+    {
+        std::perror(argv[1]);
+        return 1;
+    }
+
+    std::printf("%s: %zu bytes, %d estados no scanner, %d no parser\n",
+                argv[1], image.size(), check.getStatesCount(), check.getParserStates());
+    return 0;
+}
@@ -0,0 +1,19 @@
+#ifndef SEMANTICO_H
+#define SEMANTICO_H
+
+#include "Token.h"
+#include "SemanticError.h"
+
+// Semantico que não analisa nada, para os benchmarks do parser: só conta as
+// ações recebidas. Substitui o do m2 na compilação (o Semantico.cpp do m2 fica
+// de fora), para que o tempo medido seja só o do Sintatico, e para que o
+// parser aceite programas gerados que usam nomes não declarados.
+class Semantico
+{
+public:
+    void executeAction(int, const Token *) { acoes++; }
+
+    long long acoes = 0;
+};
+
+#endif